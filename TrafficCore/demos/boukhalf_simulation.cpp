@@ -17,9 +17,13 @@
 #include <filesystem>
 #include "Vehicules/ModelManager.h"
 #include "Vehicules/EmergencyManager.h"
+#include "Vehicules/EmergencyModels.h"
 #include "PathFinder.h"
 #include <map>
 #include "MapLoader.h"
+#include "core/AssetManager.h"
+#include "core/FileWatcher.h"
+#include "StaticProps.h"
 #include <random>
 #include <ctime>
 
@@ -683,7 +687,23 @@ std::vector<Vector3> GenerateTreesOnSidewalks(const RoadNetwork& network, float
 
 
 // ==================== CONFIGURATION MENU ====================
-SimulationConfig ShowConfigurationMenu() {
+// Premier dossier de modèles trouvé depuis le répertoire courant
+std::string FindAssetDirectory() {
+    const char* candidateDirs[] = {
+        "assets/models",
+        "../assets/models",
+        "../../assets/models",
+        "../TrafficCore/assets/models",
+        "TrafficCore/assets/models"
+    };
+    std::error_code ec;
+    for (const char* dir : candidateDirs) {
+        if (std::filesystem::is_directory(dir, ec)) return dir;
+    }
+    return "assets/models";
+}
+
+SimulationConfig ShowConfigurationMenu(const AssetManifest& manifest) {
     SimulationConfig config;
     
     // Only present three vehicle types in the UI
@@ -692,43 +712,10 @@ SimulationConfig ShowConfigurationMenu() {
     // Initialiser les compteurs à 0
     for (const auto& type : vehicleTypes) config.vehicleCounts[type] = 0;
 
-    // Prepare model lists by scanning assets/models (filter into categories)
-    std::vector<std::string> carModels;
-    std::vector<std::string> busModels;
-    std::vector<std::string> truckModels;
-    std::vector<std::string> candidateDirs = {
-        "assets/models",
-        "../assets/models",
-        "../../assets/models",
-        "../TrafficCore/assets/models",
-        "TrafficCore/assets/models"
-    };
-    for (const auto& dir : candidateDirs) {
-        try {
-            if (!std::filesystem::exists(dir)) continue;
-            for (const auto& entry : std::filesystem::directory_iterator(dir)) {
-                if (!entry.is_regular_file()) continue;
-                auto path = entry.path();
-                if (path.has_extension() && (path.extension() == ".glb" || path.extension() == ".GLB")) {
-                    std::string filename = path.filename().string();
-                    std::string lower = filename;
-                    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c){ return std::tolower(c); });
-
-                    // Classify by keyword in filename while excluding common non-vehicle assets
-                    if (lower.find("bus") != std::string::npos && lower.find("busstop") == std::string::npos && lower.find("bus_station") == std::string::npos && lower.find("abribus") == std::string::npos && lower.find("stop") == std::string::npos) {
-                        // Accept many bus model filenames
-                        busModels.push_back(std::filesystem::absolute(path).string());
-                    } else if (lower.find("truck") != std::string::npos) {
-                        truckModels.push_back(std::filesystem::absolute(path).string());
-                    } else if (lower.find("taxi") != std::string::npos || lower.find("car") != std::string::npos || lower.find("convertible") != std::string::npos || lower.find("model") != std::string::npos) {
-                        // Broad car classifier to include more car models (but may include other vehicles named 'car')
-                        carModels.push_back(std::filesystem::absolute(path).string());
-                    }
-                }
-            }
-            break;
-        } catch (...) {}
-    }
+    // Model lists from the asset manifest (categories assigned when the directory is indexed)
+    std::vector<std::string> carModels = manifest.GetPaths("CAR");
+    std::vector<std::string> busModels = manifest.GetPaths("BUS");
+    std::vector<std::string> truckModels = manifest.GetPaths("TRUCK");
 
     // Variables UI
     int screenWidth = 1200;
@@ -881,10 +868,17 @@ DrawText("Choisissez le nombre de vehicules pour chaque type:",
 }
 
 void LoadNetworkFlexible(RoadNetwork& network) {
-    // 1. Try Loading from JSON
-    std::cout << "Attempting to load configuration from: config/configuration.json" << std::endl;
+    // 1. Try Loading from JSON (or its compiled .scmap when smartcity-mapc was run after the last edit)
+    std::string mapPath = "config/configuration.json";
+    std::error_code ec;
+    const std::string compiledPath = "config/configuration.scmap";
+    if (std::filesystem::exists(compiledPath, ec) &&
+        std::filesystem::last_write_time(compiledPath, ec) >= std::filesystem::last_write_time(mapPath, ec) && !ec) {
+        mapPath = compiledPath;
+    }
+    std::cout << "Attempting to load configuration from: " << mapPath << std::endl;
     // Ensure accurate path (cwd is usually project root)
-    if (MapLoader::LoadFromFile("config/configuration.json", network)) {
+    if (MapLoader::LoadFromFile(mapPath, network)) {
         std::cout << "SUCCESS: Network loaded from JSON. Nodes: " << network.GetNodes().size() << std::endl;
         if (network.GetNodes().empty()) {
              std::cerr << "WARNING: JSON loaded but empty! Falling back to hardcoded network." << std::endl;
@@ -898,38 +892,51 @@ void LoadNetworkFlexible(RoadNetwork& network) {
     }
 }
 
+// Noeuds de flux : scenario.spawn_points de la carte (JSON ou .scmap), sinon repérés par leur
+// position sur le réseau codé en dur (N1, N3, N7, N9, N10)
+std::vector<int> FindFluxNodeIds(const RoadNetwork& network) {
+    if (!network.GetSpawnNodeIds().empty()) return network.GetSpawnNodeIds();
+
+    std::vector<int> fluxNodeIds;
+    const std::vector<Vector3> targetPos = {
+        {1050.0f, 0.0f, -450.0f}, // N1
+        {700.0f, 0.0f, -250.0f},  // N3
+        {0.0f, 0.0f, -600.0f},    // N7
+        {0.0f, 0.0f, 150.0f},     // N9
+        {-150.0f, 0.0f, 0.0f}     // N10
+    };
+    for (const auto& n : network.GetNodes()) {
+        Vector3 p = n->GetPosition();
+        for (const auto& t : targetPos) {
+            // Check X and Z with tolerance (ignore Y)
+            if (fabs(p.x - t.x) < 5.0f && fabs(p.z - t.z) < 5.0f) {
+                fluxNodeIds.push_back(n->GetId());
+                break;
+            }
+        }
+    }
+    return fluxNodeIds;
+}
+
 int main() {
-    SimulationConfig config = ShowConfigurationMenu();
+    // Index des modèles (catégories, boîtes englobantes) relu depuis manifest.json : pas de parcours
+    // complet du dossier ni de chargement avant le menu
+    AssetManager assets;
+    if (!assets.OpenManifest(FindAssetDirectory())) {
+        std::cerr << "Asset manifest unavailable: " << assets.GetManifest().GetError() << std::endl;
+    }
+    SimulationConfig config = ShowConfigurationMenu(assets.GetManifest());
     if (!config.isConfigured) return 0;
     
     // ==================== INITIALIZATION ====================
     InitWindow(1600, 900, "SMART CITY - Traffic Core Simulator");
     SetTargetFPS(60);
     
-    std::vector<std::string> vehicleTypes = { "Car", "Bus", "Truck" };
+    // Modèles empaquetés par smartcity-assetpack servis depuis l'archive projetée ; les autres sont
+    // chargés en tâche de fond : vehicules et décor apparaissent au fil des frames
+    assets.OpenArchive(assets.GetManifest().GetDirectory() + "/" + ModelArchive::kFileName);
+    ModelManager::getInstance().setAssetManager(&assets);
 
-    // Prepare model lists
-    std::vector<std::string> carModels, busModels, truckModels;
-    std::vector<std::string> candidateDirs = { "assets/models", "../assets/models", "../../assets/models", "../TrafficCore/assets/models", "TrafficCore/assets/models" };
-    for (const auto& dir : candidateDirs) {
-        try {
-            if (!std::filesystem::exists(dir)) continue;
-            for (const auto& entry : std::filesystem::directory_iterator(dir)) {
-                if (!entry.is_regular_file()) continue;
-                auto path = entry.path();
-                if (path.has_extension() && (path.extension() == ".glb" || path.extension() == ".GLB")) {
-                    std::string lower = path.filename().string();
-                    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
-                    if (lower.find("bus") != std::string::npos && lower.find("stop") == std::string::npos && lower.find("station") == std::string::npos) busModels.push_back(std::filesystem::absolute(path).string());
-                    else if (lower.find("truck") != std::string::npos) truckModels.push_back(std::filesystem::absolute(path).string());
-                    else if (lower.find("car") != std::string::npos || lower.find("taxi") != std::string::npos || lower.find("convertible") != std::string::npos) carModels.push_back(std::filesystem::absolute(path).string());
-                }
-            }
-            break;
-        } catch (...) {}
-    }
-
-    
     InitCamera();
     
     int sampleCountPerSegment = 12;
@@ -967,27 +974,9 @@ int main() {
     }
 
 
-    // Spawn initial vehicles using ONLY the flux nodes (N1, N3, N7, N9, N10)
+    // Spawn initial vehicles using ONLY the flux nodes (scenario.spawn_points)
     if (!nodes.empty()) {
-        // Identify flux nodes by position
-        std::vector<int> fluxNodeIds;
-        std::vector<Vector3> targetPos = {
-            {1050.0f, 0.0f, -450.0f}, // N1
-            {700.0f, 0.0f, -250.0f},  // N3
-            {0.0f, 0.0f, -600.0f},    // N7
-            {0.0f, 0.0f, 150.0f},     // N9
-            {-150.0f, 0.0f, 0.0f}     // N10
-        };
-        
-        for (const auto& n : nodes) {
-            Vector3 p = n->GetPosition();
-            for (const auto& t : targetPos) {
-                if (fabs(p.x - t.x) < 5.0f && fabs(p.z - t.z) < 5.0f) {
-                    fluxNodeIds.push_back(n->GetId());
-                    break;
-                }
-            }
-        }
+        std::vector<int> fluxNodeIds = FindFluxNodeIds(network);
         
         if (fluxNodeIds.size() >= 2) {
             static std::mt19937 rng((unsigned)time(nullptr));
@@ -1033,27 +1022,27 @@ int main() {
     for (auto const& [type, count] : config.vehicleCounts) desiredVehicles += count;
 
     // --- LOAD FOUNTAIN MODEL ---
-    Model fountainModel = LoadModel("../TrafficCore/assets/models/fountain_water_simulation.glb");
+    ModelHandle fountainModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/fountain_water_simulation.glb");
     Vector3 fountainPos = {0.0f, 0.1f, -450.0f}; // Node n6 position
     float fountainScale = 45.0f; // Légèrement augmenté
 
     // --- LOAD SCHOOL MODEL ---
-    Model schoolModel = LoadModel("../TrafficCore/assets/models/school_building.glb");
+    ModelHandle schoolModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/school_building.glb");
     Vector3 schoolPos = {900.0f, 0.0f, -250.0f}; // Ajusté: "plus haut en z à l'extrémité"
     float schoolScale = 150.0f; // Augmenté značablement (était 80.0f)
 
     // --- LOAD SH MODEL (Using Tree.glb on user request) ---
-    Model shModel = LoadModel("../TrafficCore/assets/models/Tree.glb");
+    ModelHandle shModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/Tree.glb");
     Vector3 shPos = {525.0f, 0.0f, -125.0f}; // Between n3 and n5
     float shScale = 20.0f; // Adjusted scale for a single tree module
 
     // --- LOAD TREES ---
-    Model treeModel = LoadModel("../TrafficCore/assets/models/Tree.glb");
+    ModelHandle treeModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/Tree.glb");
     float treeSpacing = 60.0f; // Distance entre les arbres
     std::vector<Vector3> treePositions = GenerateTreesOnSidewalks(network, treeSpacing);
     
     // --- LOAD PLANTS ---
-    Model plantModel = LoadModel("../TrafficCore/assets/models/Plant Big.glb");
+    ModelHandle plantModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/Plant Big.glb");
     Vector3 n5Pos = {350.0f, 0.1f, 0.0f}; // Position du rond-point n5
     std::vector<Vector3> plantPositions;
     for (int i = 0; i < 8; i++) {
@@ -1069,37 +1058,37 @@ int main() {
     plantPositions.push_back({n5Pos.x, 0.2f, n5Pos.z});
 
     // --- LOAD ABRIBUS ---
-    Model abribusModel = LoadModel("../TrafficCore/assets/models/abribus_bus_stop_bus_station.glb");
+    ModelHandle abribusModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/abribus_bus_stop_bus_station.glb");
     Vector3 abribusPos = {313.6f, 0.0f, -80.0f}; // De l'autre côté de la route (X=350 - 36.4)
     float abribusRotation = 0.0f; // Face à la route
 
     // --- LOAD BUS STOP (Beside Abribus) ---
-    Model busStopModel2 = LoadModel("../TrafficCore/assets/models/busstop.glb");
+    ModelHandle busStopModel2 = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/busstop.glb");
     Vector3 busStop2Pos = { abribusPos.x, abribusPos.y, abribusPos.z - 15.0f }; // À gauche (décalé en Z)
     float busStop2Rotation = 0.0f;
 
     // --- LOAD LARGE BUILDINGS ---
-    Model buildingModel0 = LoadModel("../TrafficCore/assets/models/Large Building 0.glb");
+    ModelHandle buildingModel0 = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/Large Building 0.glb");
     Vector3 building0Pos = { 110.0f, 0.0f, 75.0f }; // Entre n8 (0,0,0) et n9 (0,0,150)
     float building0Scale = 60.0f;
 
-    Model stadiumModel = LoadModel("../TrafficCore/assets/models/stadium.glb");
+    ModelHandle stadiumModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/stadium.glb");
     Vector3 stadiumPos = { 265.0f, 0.0f, -55.0f }; // X: 250, Z: -75
     float stadiumScale = 8.0f; 
 
     // --- LOAD RESTAURANT ---
-    Model restaurantModel = LoadModel("../TrafficCore/assets/models/restaurant.glb");
+    ModelHandle restaurantModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/restaurant.glb");
     Vector3 restaurantPos = { 60.0f, 0.0f, -225.0f }; // Between n8 (0,0,0) and n6 (0,0,-450)
     float restaurantScale = 5.0f;
 
     // --- LOAD HOTEL ---
-    Model hotelModel = LoadModel("../TrafficCore/assets/models/hotel.glb");
+    ModelHandle hotelModel = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/hotel.glb");
     Vector3 hotelPos = { -75.0f, 0.0f, 35.0f }; // Near n8 and n10, offset from road
     float hotelScale = 15.0f;
 
     bool returnToMenu = false;
 
-    Model buildingModel3 = LoadModel("../TrafficCore/assets/models/Large Building 3.glb");
+    ModelHandle buildingModel3 = ModelManager::getInstance().acquireAsync("../TrafficCore/assets/models/Large Building 3.glb");
     float building3Scale = 40.0f;
     std::vector<Vector3> building3Positions;
     // Row between n2 (x=700) and n4 (x=350)
@@ -1107,13 +1096,65 @@ int main() {
         building3Positions.push_back({ x, 0.0f, -520.0f });
     }
 
+    // --- DÉCOR : grille de culling et niveaux de détail ---
+    // Petits objets (arbres, plantes, abribus) coupés au-delà de propCutoff ; LOD générés au chargement
+    const float propCutoff = 450.0f;
+    StaticProps scenery; // regroupé par case et par modèle, un appel instancié par maillage
+    // Objets dont le modèle se charge encore : ajoutés à scenery une fois prêts, boîte d'attente d'ici là
+    struct PendingProp {
+        ModelHandle model;
+        Vector3 position;
+        float rotation;
+        float scale;
+        float maxDistance;
+        Matrix transform; // comme DrawModelEx, pour la boîte d'attente
+    };
+    std::vector<PendingProp> pendingProps;
+    auto addProp = [&](const ModelHandle& model, Vector3 pos, float rotation, float scale, float maxDistance) {
+        Matrix transform = MatrixMultiply(MatrixMultiply(MatrixScale(scale, scale, scale), MatrixRotateY(rotation * DEG2RAD)),
+                                          MatrixTranslate(pos.x, pos.y, pos.z));
+        pendingProps.push_back({model, pos, rotation, scale, maxDistance, transform});
+    };
+    addProp(fountainModel, fountainPos, 0.0f, fountainScale, 0.0f);
+    addProp(schoolModel, schoolPos, 0.0f, schoolScale, 0.0f);
+    addProp(shModel, shPos, 0.0f, shScale, 0.0f);
+    for (const auto& pos : treePositions) addProp(treeModel, pos, 0.0f, 6.0f, propCutoff); // Taille réduite (6.0f)
+    addProp(buildingModel0, building0Pos, 0.0f, building0Scale, 0.0f);
+    addProp(stadiumModel, stadiumPos, 90.0f, stadiumScale, 0.0f); // Rotated 90 degrees
+    addProp(restaurantModel, restaurantPos, 180.0f, restaurantScale, 0.0f);
+    addProp(hotelModel, hotelPos, 0.0f, hotelScale, 0.0f);
+    for (const auto& pos : building3Positions) addProp(buildingModel3, pos, 0.0f, building3Scale, 0.0f);
+    for (const auto& pos : plantPositions) addProp(plantModel, pos, 0.0f, 15.0f, propCutoff);
+    addProp(abribusModel, abribusPos, abribusRotation, 5.0f, propCutoff);
+    addProp(busStopModel2, busStop2Pos, busStop2Rotation, 8.0f, propCutoff); // next to Abribus
+
     // ==================== LOOP ====================
     bool paused = false;
     float simTime = 0.0f;
+    // Carte éditée pendant la simulation : seules les différences sont appliquées au réseau
+    FileWatcher configWatcher;
+    if (!configWatcher.Watch("config/configuration.json")) {
+        std::cerr << "Hot reload disabled: " << configWatcher.GetError() << std::endl;
+    }
     while (!WindowShouldClose() && !returnToMenu) {
         float dt = GetFrameTime();
         if (!paused) simTime += dt;
         
+        // Quelques millisecondes de chargement par frame, puis le décor prêt rejoint les lots instanciés
+        assets.Update();
+        for (auto it = pendingProps.begin(); it != pendingProps.end();) {
+            if (it->model.isPending()) {
+                ++it;
+                continue;
+            }
+            const Model& model = it->model.get();
+            if (model.meshCount > 0) {
+                scenery.Add(model, ModelManager::getInstance().getLod(model), it->position, it->rotation, it->scale,
+                            it->maxDistance);
+            }
+            it = pendingProps.erase(it); // échec de chargement : rien à dessiner
+        }
+        
         // Input
         if (IsKeyPressed(KEY_SPACE)) paused = !paused;
         
@@ -1125,35 +1166,20 @@ int main() {
         // Caméra
         UpdateCamera(trafficMgr, dt);
 
+        if (configWatcher.Poll()) {
+            MapLoader::ReloadStats stats;
+            if (MapLoader::ReloadFromFile("config/configuration.json", network, &stats)) {
+                std::cout << "Configuration reloaded: nodes +" << stats.nodesAdded << " -" << stats.nodesRemoved
+                          << " ~" << stats.nodesChanged << ", routes +" << stats.segmentsAdded << " -"
+                          << stats.segmentsRemoved << " ~" << stats.segmentsChanged << ", restrictions "
+                          << stats.restrictionsChanged << ", vehicle types " << stats.vehicleTypesChanged << std::endl;
+            }
+        }
+
         // Ajouter véhicule (Touche V)
         if (IsKeyPressed(KEY_V)) {
-            const auto& nodes = network.GetNodes();
-            static std::vector<int> validSpawnIds;
-            
-            // Initialisation unique des 5 points de Flux (Entrée/Sortie)
-            if (validSpawnIds.empty() && nodes.size() >= 2) {
-                 std::vector<Vector3> targetPos = {
-                     {1050.0f, 0.0f, -450.0f}, // N1
-                     {700.0f, 0.0f, -250.0f},  // N3
-                     {0.0f, 0.0f, -600.0f},    // N7
-                     {0.0f, 0.0f, 150.0f},     // N9
-                     {-150.0f, 0.0f, 0.0f}     // N10
-                 };
-                 
-                 std::cout << "Identification des Noeuds de Flux (N1, N3, N7, N9, N10) :" << std::endl;
-                 
-                 for (const auto& n : nodes) {
-                     Vector3 p = n->GetPosition();
-                     for (const auto& t : targetPos) {
-                         // Check X and Z with tolerance (ignore Y)
-                         if (fabs(p.x - t.x) < 5.0f && fabs(p.z - t.z) < 5.0f) {
-                             validSpawnIds.push_back(n->GetId());
-                             std::cout << " - Flux Node Identified: ID " << n->GetId() << std::endl;
-                             break;
-                         }
-                     }
-                 }
-            }
+            // Relus à chaque appui : un rechargement à chaud peut changer les noeuds de flux
+            const std::vector<int> validSpawnIds = FindFluxNodeIds(network);
 
             if (!validSpawnIds.empty()) {
                 static std::mt19937 rng((unsigned)time(nullptr));
@@ -1223,6 +1249,9 @@ int main() {
                 normalVehicles.push_back(v.get());
             }
             emergencySystem.yieldToEmergencyVehicle(normalVehicles);
+
+            // Trafic et urgences ont pris en compte les éditions du réseau
+            network.ReleaseRetired();
             
             // Spawn automatique désactivé : Utiliser la touche V pour ajouter des véhicules
             // (garantit que seuls les nœuds de flux N1, N3, N7, N9, N10 sont utilisés)
@@ -1249,63 +1278,51 @@ int main() {
             Vector2 randomDest = {GetRandomValue(-200, 800), GetRandomValue(-600, 200)};
             emergencySystem.dispatchEmergencyVehicle(2, randomDest); // 2 = POLICE
         }
+        if (IsKeyPressed(KEY_F8) && network.GetRoadSegmentCount() > 0) {
+            // Fermer / rouvrir une route au hasard : les urgences en mission replanifient
+            const auto& segs = network.GetRoadSegments();
+            RoadSegment* seg = segs[GetRandomValue(0, (int)segs.size() - 1)].get();
+            bool closed = !network.IsSegmentClosed(seg);
+            network.SetSegmentClosed(seg, closed);
+            std::cout << "[ROUTE] Segment " << seg->GetStartNode()->GetId() << " -> " << seg->GetEndNode()->GetId()
+                      << (closed ? " ferme" : " rouvert") << std::endl;
+        }
+        if (IsKeyPressed(KEY_F9)) {
+            // Couverture de l'hôpital : off -> 30 s -> 60 s -> 3 min -> off
+            static const float budgets[] = {30.0f, 60.0f, 180.0f};
+            static int budgetStep = -1;
+            budgetStep = (budgetStep + 2) % 4 - 1;
+            emergencySystem.setCoverageOverlay(budgetStep >= 0, budgetStep >= 0 ? budgets[budgetStep] : 0.0f);
+        }
 
 
         // ==================== DRAW ====================
         BeginDrawing();
         
+        const Frustum view = Frustum::FromCamera(g_camera, (float)GetScreenWidth() / (float)std::max(1, GetScreenHeight()));
+        LodSelector::SetView(g_camera, GetScreenHeight());
         BeginMode3D(g_camera);
             DrawEnvironment();
-            network.Draw();
+            network.Draw(&view);
+            
+            // Barrières sur les routes fermées (F8)
+            for (const auto& seg : network.GetRoadSegments()) {
+                if (!network.IsSegmentClosed(seg.get())) continue;
+                Vector3 mid = Vector3Lerp(seg->GetStartPos(), seg->GetEndPos(), 0.5f);
+                DrawCube({mid.x, 2.0f, mid.z}, 6.0f, 4.0f, 6.0f, RED);
+            }
             
             // Draw Blue Circle Base (Water/Pool)
             DrawCylinder(fountainPos, 40.0f, 40.0f, 1.0f, 32, BLUE);
 
-            // Draw Fountain
-            DrawModel(fountainModel, fountainPos, fountainScale, WHITE);
-            
-            // Draw School
-            DrawModel(schoolModel, schoolPos, schoolScale, WHITE);
-            
-            // Draw SH Module
-            DrawModel(shModel, shPos, shScale, WHITE);
-            
-            // Draw Trees
-            for (const auto& pos : treePositions) {
-                DrawModel(treeModel, pos, 6.0f, WHITE); // Taille réduite (6.0f)
-            }
-
-            // Draw Large Building 0
-            DrawModel(buildingModel0, building0Pos, building0Scale, WHITE);
-
-            // Draw Stadium (Rotated 90 degrees)
-            DrawModelEx(stadiumModel, stadiumPos, {0, 1, 0}, 90.0f, {stadiumScale, stadiumScale, stadiumScale}, WHITE);
-
-            // Draw Restaurant
-            DrawModelEx(restaurantModel, restaurantPos, { 0.0f, 1.0f, 0.0f }, 180.0f, { restaurantScale, restaurantScale, restaurantScale }, WHITE);
-
-            // Draw Hotel
-            DrawModelEx(hotelModel, hotelPos, { 0.0f, 1.0f, 0.0f }, 0.0f, { hotelScale, hotelScale, hotelScale }, WHITE);
-
-            // Draw Large Building 3 instances
-            for (const auto& pos : building3Positions) {
-                DrawModel(buildingModel3, pos, building3Scale, WHITE);
-            }
-
-            // Draw Plants at n5
-            for (const auto& pos : plantPositions) {
-                DrawModel(plantModel, pos, 15.0f, WHITE);
+            // Décor visible (fontaine, école, arbres, bâtiments, stade, restaurant, hôtel, plantes, abribus)
+            scenery.Draw(view);
+            for (const auto& prop : pendingProps) {
+                if (prop.model.hasBounds()) DrawBoundingBox(TransformBounds(prop.model.getBounds(), prop.transform), LIGHTGRAY);
+                else DrawCubeWires(prop.position, 4.0f, 4.0f, 4.0f, LIGHTGRAY);
             }
 
-            // Draw Abribus
-            DrawModelEx(abribusModel, abribusPos, {0, 1, 0}, abribusRotation, {5.0f, 5.0f, 5.0f}, WHITE);
-
-            // Draw Bus Stop (next to Abribus)
-            DrawModelEx(busStopModel2, busStop2Pos, {0, 1, 0}, busStop2Rotation, {8.0f, 8.0f, 8.0f}, WHITE);
-
-            for (const auto& car : trafficMgr.getVehicles()) {
-                car->draw();
-            }
+            trafficMgr.draw(&view); // un appel instancié par modèle de véhicule, véhicules hors champ sautés
             
             // Dessiner le système d'urgence (hôpital et véhicules d'urgence)
             emergencySystem.updateAndDraw(dt);
@@ -1318,6 +1335,10 @@ int main() {
         DrawText(TextFormat("Time: %.1f s", simTime), 20, 75, 16, SKYBLUE);
         DrawText(paused ? "PAUSED" : "RUNNING", 20, 100, 16, paused ? RED : GREEN);
         DrawCameraInfo();
+        DrawText(TextFormat("Culled: vehicles %d  decor %d  tiles %d",
+                            trafficMgr.getRenderer().GetCullStats().GetCulled(), scenery.GetStats().GetCulled(),
+                            network.GetRoadMesh().GetCullStats().GetCulled()),
+                 20, 170, 13, LIGHTGRAY);
         
         DrawUIPanel(10, 200, 350, 400, "CONTROLES");
         DrawText("SPACE     : Pause/Resume", 20, 225, 13, WHITE);
@@ -1328,18 +1349,32 @@ int main() {
         DrawText("1 / 2 / 3 : Camera Modes", 20, 328, 13, YELLOW);
         DrawText("WASD/ZQSD : Move", 20, 403, 12, GREEN);
         
-        DrawUIPanel(10, 610, 350, 140, "URGENCES");
+        DrawUIPanel(10, 610, 350, 158, "URGENCES");
         DrawText("F5        : Ambulance", 20, 635, 13, RED);
         DrawText("F6        : Pompiers", 20, 653, 13, Color{255, 140, 0, 255});
         DrawText("F7        : Police", 20, 671, 13, BLUE);
+        DrawText("F8        : Fermer/Rouvrir route", 20, 689, 13, LIGHTGRAY);
+        DrawText("F9        : Couverture hopital", 20, 707, 13, GREEN);
         DrawText(TextFormat("Urgences: %d", (int)emergencySystem.getEmergencyVehicles().size()), 
-                 20, 707, 13, YELLOW);
+                 20, 725, 13, YELLOW);
+        if (emergencySystem.isCoverageOverlayVisible()) {
+            const ReachResult& reach = emergencySystem.getHospitalCoverage(emergencySystem.getCoverageBudget());
+            DrawText(TextFormat("Couverture %.0f s : %d noeuds", reach.budgetSeconds, reach.GetReachedNodeCount()),
+                     20, 743, 13, GREEN);
+        }
         
         DrawFPS(1450, 870);
         EndDrawing();
     }
     
     EnableCursor();
+    LodSelector::ClearView();
+    scenery.Release();
+    EmergencyModels::Release();
+    InstanceBatch::ReleaseShader();
+    ModelManager::getInstance().setAssetManager(nullptr);
+    ModelManager::getInstance().unloadAll(); // modèles partagés et LOD, tant que le contexte existe
+    if (!assets.GetManifest().Save()) std::cerr << assets.GetManifest().GetError() << std::endl;
     CloseWindow();
     
     // Si l'utilisateur a appuyé sur M, recommencer avec un nouveau menu
@@ -0,0 +1,68 @@
+#ifndef CITYGENERATOR_H
+#define CITYGENERATOR_H
+
+#include "Node.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class RoadNetwork;
+
+// Paramètres d'une ville générée. nodeCount est une cible : la disposition l'arrondit
+// (grille carrée, anneaux complets) à quelques pourcents près.
+struct CityParams {
+    enum class Layout { Grid, Radial, RandomPlanar };
+    static constexpr int kMinNodes = 4;
+    static constexpr int kMaxNodes = 1000000;
+
+    Layout layout = Layout::Grid;
+    int nodeCount = 100;            // de 100 à 1 000 000
+    float spacing = 300.0f;         // distance typique entre carrefours (>= 150 pour les ronds-points)
+    uint32_t seed = 1;
+    float roundaboutRatio = 0.05f;  // part des carrefours (degré >= 3) en rond-point
+    float trafficLightRatio = 0.25f; // part des carrefours (degré >= 3) à feux
+    float arterialRatio = 0.2f;     // part des rues à 4 voies (les autres en ont 2)
+    int spawnCount = 8;             // noeuds de flux en périphérie
+};
+
+// Plan de ville : topologie seule, sans géométrie (quelques octets par élément même à 1M noeuds).
+// Les ids de noeuds valent index + 1. Chaque rue à double sens donne deux routes ; la seconde
+// est invisible (une seule chaussée dessinée), comme dans configuration.json.
+struct CityPlan {
+    struct PlanNode {
+        int id;
+        float x, z;
+        NodeType type;
+        float radius;
+    };
+    struct PlanRoad {
+        int from, to; // ids
+        int lanes;
+        bool curved;  // raccord courbe vers un rond-point
+        bool visible;
+    };
+
+    std::vector<PlanNode> nodes;
+    std::vector<PlanRoad> roads;
+    std::vector<int> spawnNodeIds; // flux : origines / destinations des véhicules
+
+    int CountNodes(NodeType type) const;
+};
+
+// CityGenerator : villes synthétiques déterministes (même graine = même plan sur toute plateforme)
+// - Grid : quadrillage, une rangée / colonne d'artères à 4 voies toutes les 1 / arterialRatio rues
+// - Radial : rond-point central, anneaux concentriques (artères selon le même pas), rayons doublés
+//   quand les arcs s'allongent ; les 6 rayons d'origine sont des artères
+// - RandomPlanar : points répartis par cellules, voisins + diagonales, arbre couvrant aléatoire
+//   conservé (connexité) puis une partie des autres rues
+class CityGenerator {
+public:
+    static CityPlan Generate(const CityParams& params);
+
+    // Crée noeuds, segments et noeuds de flux dans un réseau vide
+    static bool Build(const CityPlan& plan, RoadNetwork& outNetwork);
+    // Même format que configuration.json (topology + scenario.spawn_points)
+    static bool WriteJson(const CityPlan& plan, const std::string& path, std::string* error = nullptr);
+};
+
+#endif // CITYGENERATOR_H
@@ -0,0 +1,82 @@
+#ifndef DSTARLITE_H
+#define DSTARLITE_H
+
+#include "RoutingGraph.h"
+#include "TravelTimeTable.h"
+#include <memory>
+#include <queue>
+#include <vector>
+
+// DStarLite : replanification incrémentale (D* Lite, Koenig & Likhachev) sur le graphe des arcs.
+// - Recherche arrière depuis la destination : g(arc) = temps restant une fois l'arc parcouru
+// - Le départ suit le véhicule (correctif km) ; seuls les états touchés par un changement
+//   de poids (congestion, fermeture) sont réparés, l'arbre de recherche est conservé
+// - État virtuel "au noeud de départ" tant que le véhicule n'est engagé sur aucun arc
+// Autonome (instantanés partagés) : peut être construit sur un worker puis utilisé sur le thread de simulation.
+class DStarLite {
+public:
+    DStarLite(std::shared_ptr<const RoutingGraph> graph, std::shared_ptr<const EdgeWeights> weights,
+              int startNode, int goalNode);
+
+    // Le véhicule est engagé sur cet arc (index CSR) : le départ de la recherche s'y déplace
+    void MoveStart(int arc);
+    // Nouveaux poids publiés : répare les arcs modifiés
+    void UpdateWeights(std::shared_ptr<const EdgeWeights> newWeights);
+    // Répare l'arbre jusqu'à ce que le départ soit cohérent ; false si destination inatteignable
+    bool ComputeShortestPath();
+
+    // Segments à suivre après le départ courant (vide si arrivé ou sans chemin)
+    std::vector<int> ExtractRoute() const;
+    bool HasPath() const;
+    float GetRemainingSeconds() const;
+
+    const RoutingGraph& GetGraph() const { return *graph; }
+    uint64_t GetWeightsVersion() const { return weights->version; }
+    int GetExpandedCount() const { return expanded; } // cumul, mesure le coût des réparations
+
+private:
+    struct Key {
+        float k1, k2;
+        bool operator<(const Key& o) const { return k1 < o.k1 || (k1 == o.k1 && k2 < o.k2); }
+        bool operator==(const Key& o) const { return k1 == o.k1 && k2 == o.k2; }
+    };
+    struct HeapItem {
+        Key key;
+        int state;
+        bool operator>(const HeapItem& o) const { return o.key < key; }
+    };
+
+    void Reset();
+    bool IsGoal(int s) const;
+    Vector3 StatePosition(int s) const;
+    float Heuristic(int from, int to) const;
+    Key CalcKey(int s) const;
+    // Coût de l'état s (arc ou départ virtuel) vers l'arc successeur f : manoeuvre + parcours de f
+    float Cost(int s, int f) const;
+    float BestSuccessor(int s, int* bestArc) const;
+    void UpdateVertex(int s);
+    void Push(int s);
+    bool TopKey(Key& out);
+
+    // Visite les prédécesseurs de l'arc f (arcs entrants autorisés + départ virtuel)
+    template <class Fn> void ForEachPredecessor(int f, Fn&& fn) const;
+
+    std::shared_ptr<const RoutingGraph> graph;
+    std::shared_ptr<const EdgeWeights> weights;
+    int startNode;
+    int goalNode;
+    int virtualStart; // = nombre d'arcs
+    int start;
+    int last;
+    float km = 0.0f;
+    float invSpeed = 0.0f; // heuristique : distance / EdgeWeights::speedBound au moment du Reset
+
+    std::vector<float> g;
+    std::vector<float> rhs;
+    std::vector<Key> queuedKey;
+    std::vector<char> inQueue;
+    std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<HeapItem>> open;
+    int expanded = 0;
+};
+
+#endif // DSTARLITE_H
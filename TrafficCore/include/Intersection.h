@@ -10,7 +10,8 @@ class Vehicule;
 class Intersection {
 public:
     Intersection(Node* node);
-    void Draw() const;
+    void Bake(RoadMeshBuilder& out) const; // rond-point ou dalle du carrefour (maillage statique)
+    void Draw() const;                     // éléments animés (feux)
     // Gestion de l'occupation
     bool CanEnter(Vehicule* vehicle) const;
     void Enter(Vehicule* v);
@@ -18,6 +19,8 @@ public:
     
     bool IsOccupied() const { return !occupants.empty(); }
     void Update(float deltaTime);
+    // Noeud modifié (type, position, rayon) : géométrie du rond-point recalculée
+    void Rebuild();
     
     // Accesseurs
     Node* GetNode() const { return node; }
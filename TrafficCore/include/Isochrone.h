@@ -0,0 +1,37 @@
+#ifndef ISOCHRONE_H
+#define ISOCHRONE_H
+
+#include <cstdint>
+#include <vector>
+
+class RoutingGraph;
+struct EdgeWeights;
+
+// Résultat d'une recherche un-vers-tous bornée : temps d'arrivée depuis la source la plus proche.
+// - nodeSeconds : par index de noeud du RoutingGraph, infini hors budget
+// - segmentSeconds : par RoadSegment::GetIndex(), arrivée au bout du segment ; infini si le
+//   segment n'est pas entamé dans le budget. Une valeur > budget = segment couvert en partie.
+struct ReachResult {
+    uint64_t topologyVersion = 0;
+    uint64_t weightsVersion = 0;
+    float budgetSeconds = 0.0f;
+    std::vector<float> nodeSeconds;
+    std::vector<float> segmentSeconds;
+    std::vector<float> segmentTravel; // temps de parcours utilisé pour chaque segment
+
+    bool IsNodeReached(int node) const { return nodeSeconds[node] <= budgetSeconds; }
+    // Part du segment (0..1) atteinte dans le budget
+    float SegmentCoverage(int segmentIndex) const;
+    int GetReachedNodeCount() const;
+};
+
+// Isochrone : Dijkstra multi-sources sur le graphe des arcs (manoeuvres comprises),
+// arrêté dès que le temps dépasse le budget. Lit uniquement les instantanés :
+// utilisable depuis un worker, résultats réutilisables tant que les versions ne changent pas.
+class Isochrone {
+public:
+    static ReachResult Compute(const RoutingGraph& graph, const EdgeWeights& weights,
+                               const std::vector<int>& sources, float budgetSeconds);
+};
+
+#endif // ISOCHRONE_H
@@ -0,0 +1,35 @@
+#ifndef MAPBINARY_H
+#define MAPBINARY_H
+
+#include "RoadNetwork.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// MapBinary : carte compilée (.scmap), produite par smartcity-mapc à partir du JSON.
+// Disposition pensée pour mmap : en-tête fixe, table des sections, puis chaque section
+// alignée sur 16 octets et stockée sous forme de tableau d'enregistrements à taille fixe
+// (petit-boutiste). Le chargement ne fait que recopier ces tableaux :
+// - noeuds (id, type, position, rayon), segments (extrémités, voies, visibilité)
+// - géométrie figée : points de contrôle de la chaussée et tracés des trottoirs
+// - restrictions de manoeuvre, paramètres des types de véhicules, noeuds de flux
+// - graphe de routage CSR complet (arcs, CSR inverse, table de manoeuvres), adopté tel quel
+// - index spatial (R-tree des noeuds et des tracés), adopté de même
+// Toute nouvelle donnée = nouvelle section ; une section inconnue est ignorée.
+class MapBinary {
+public:
+    static constexpr char kMagic[8] = {'S', 'C', 'M', 'A', 'P', 0, 0, 0};
+    static constexpr uint32_t kVersion = 1;
+
+    // Les 8 premiers octets portent la signature d'une carte compilée
+    static bool IsBinary(std::string_view data);
+
+    // Sérialise le réseau (et son graphe de routage courant) ; error reçoit la cause d'échec
+    static bool Write(const RoadNetwork& network, const std::string& path, std::string* error = nullptr);
+    static std::string Serialize(const RoadNetwork& network);
+
+    // Recharge un contenu produit par Write ; le réseau doit être vide
+    static bool Load(std::string_view data, RoadNetwork& outNetwork, std::string* error = nullptr);
+};
+
+#endif // MAPBINARY_H
@@ -3,10 +3,42 @@
 
 #include "RoadNetwork.h"
 #include <string>
+#include <string_view>
 
 class MapLoader {
 public:
+    // Différences appliquées par un rechargement à chaud
+    struct ReloadStats {
+        int nodesAdded = 0;
+        int nodesRemoved = 0;
+        int nodesChanged = 0;     // position, type ou rayon
+        int segmentsAdded = 0;
+        int segmentsRemoved = 0;
+        int segmentsChanged = 0;  // voies, raccord courbe ou visibilité
+        int restrictionsChanged = 0;
+        int vehicleTypesChanged = 0;
+        bool uTurnsChanged = false;
+        bool spawnPointsChanged = false;
+
+        bool IsEmpty() const {
+            return nodesAdded + nodesRemoved + nodesChanged + segmentsAdded + segmentsRemoved + segmentsChanged
+                + restrictionsChanged + vehicleTypesChanged == 0 && !uTurnsChanged && !spawnPointsChanged;
+        }
+    };
+
+    // Fichier projeté en mémoire puis lu en flux (JsonReader), sans arbre intermédiaire.
+    // Une carte compilée (.scmap, voir MapBinary) est reconnue à sa signature et recopiée telle quelle.
     static bool LoadFromFile(const std::string& path, RoadNetwork& outNetwork);
+    // Même lecture depuis un texte déjà en mémoire ; error reçoit "ligne L, colonne C : message"
+    static bool LoadFromMemory(std::string_view json, RoadNetwork& outNetwork, std::string* error = nullptr);
+
+    // Rechargement à chaud d'une configuration JSON déjà chargée dans network : seules les
+    // différences sont appliquées (éditions de RoadNetwork, VehiculeFactory::setDefaultParams),
+    // le trafic continue. Noeuds appariés par id, routes par couple (from, to).
+    // Texte invalide : false, réseau intact.
+    static bool ReloadFromFile(const std::string& path, RoadNetwork& network, ReloadStats* stats = nullptr);
+    static bool ReloadFromMemory(std::string_view json, RoadNetwork& network, ReloadStats* stats = nullptr,
+                                 std::string* error = nullptr);
 };
 
 #endif
@@ -0,0 +1,63 @@
+#ifndef NETWORKPARTITION_H
+#define NETWORKPARTITION_H
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+class RoadNetwork;
+
+// NetworkPartition : découpage du réseau en régions spatiales pour la simulation parallèle.
+// - Bissection récursive des positions (axe le plus étendu, médiane pondérée), puis affinage
+//   des frontières : un noeud change de région s'il y gagne des segments internes, dans la
+//   limite d'équilibre kImbalance
+// - Poids d'un noeud = 1 + segments entrants ; un segment appartient à la région de son noeud
+//   d'arrivée (là où ses véhicules attendent), une intersection à celle de son noeud
+// - Segment coupé : départ et arrivée dans deux régions ; chaque paire (départ, arrivée) des
+//   segments coupés est une frontière, franchie par les véhicules qui s'y engagent
+// Index de noeud / segment : ceux de RoadNetwork (même convention que le RoutingGraph).
+// Après une édition à chaud, Patch() garde la région des noeuds intacts ; un noeud noté au
+// journal rejoint la région majoritaire de ses voisins (pas de nouvelle bissection).
+class NetworkPartition {
+public:
+    static constexpr float kImbalance = 0.05f; // écart de poids toléré par rapport à la moyenne
+
+    static std::shared_ptr<const NetworkPartition> Build(const RoadNetwork& network, int regionCount,
+                                                         uint64_t topologyVersion);
+    // touchedNodes : RoadNetwork::GetEditsSince(previous.GetVersion(), ...)
+    static std::shared_ptr<const NetworkPartition> Patch(const NetworkPartition& previous, const RoadNetwork& network,
+                                                         const std::vector<int>& touchedNodes,
+                                                         uint64_t topologyVersion);
+
+    uint64_t GetVersion() const { return version; }
+    // Peut être inférieur au nombre demandé (réseau plus petit que le nombre de régions)
+    int GetRegionCount() const { return regionCount; }
+
+    int RegionOfNode(int nodeIndex) const { return nodeRegions[nodeIndex]; }
+    int RegionOfSegment(int segmentIndex) const { return segmentRegions[segmentIndex]; }
+    const std::vector<int>& GetRegionNodes(int region) const { return regionNodes[region]; }
+    const std::vector<int>& GetRegionSegments(int region) const { return regionSegments[region]; }
+    float GetRegionWeight(int region) const { return regionWeights[region]; }
+
+    int GetCutSegmentCount() const { return cutSegments; }
+    // Paires (région de départ, région d'arrivée), triées
+    const std::vector<std::pair<int, int>>& GetBoundaries() const { return boundaries; }
+
+private:
+    // Segments, listes par région, poids et frontières déduits de nodeRegions
+    void Assign(const RoadNetwork& network, const std::vector<int>& segmentStart, const std::vector<int>& segmentEnd,
+                const std::vector<float>& weights);
+
+    uint64_t version = 0;
+    int regionCount = 1;
+    std::vector<int> nodeRegions;
+    std::vector<int> segmentRegions;
+    std::vector<std::vector<int>> regionNodes;
+    std::vector<std::vector<int>> regionSegments;
+    std::vector<float> regionWeights;
+    int cutSegments = 0;
+    std::vector<std::pair<int, int>> boundaries;
+};
+
+#endif // NETWORKPARTITION_H
@@ -4,6 +4,8 @@
 #include "raylib.h"
 #include <vector>
 
+class RoadMeshBuilder;
+
 enum NodeType { 
     SIMPLE_INTERSECTION, 
     ROUNDABOUT, 
@@ -16,6 +18,14 @@ enum TrafficLightState {
     LIGHT_GREEN
 };
 
+// Feu à un coin du carrefour : poteau, boîtier et face éclairée
+struct TrafficLightProp {
+    Vector3 pole;        // pied du poteau (cylindre de kPoleHeight)
+    Vector3 box;         // centre du boîtier
+    bool faceX;          // boîtier tourné vers ±X (sinon ±Z)
+    Vector3 lampOffset;  // des lampes par rapport au boîtier, vers la face éclairée
+};
+
 class Node {
 private:
     int id;
@@ -33,6 +43,8 @@ private:
     bool emergencyOverride;  // Force le feu au vert pour les urgences
     float emergencyOverrideTimer;
     
+    float GetPadHalfSize() const; // demi-côté du carrefour, selon la route la plus large
+    
 public:
     Node(int id, Vector3 position, NodeType type = SIMPLE_INTERSECTION, float radius = 5.0f);
     
@@ -48,9 +60,12 @@ public:
     
     // Setters
     void SetPosition(Vector3 pos) { position = pos; }
+    void SetType(NodeType t) { type = t; }
+    void SetRadius(float r) { radius = r; }
     
     // Gestion des connexions
     void AddConnectedRoad(RoadSegment* road);
+    void RemoveConnectedRoad(RoadSegment* road);
     
     // Pour calculer les tangentes aux connexions (utile pour les courbes)
     Vector3 GetConnectionTangent(Vector3 direction) const;
@@ -59,7 +74,16 @@ public:
     void UpdateTrafficLight(float deltaTime);
     void SetEmergencyOverride(bool override, float duration = 5.0f);
     
+    // Dalle du carrefour (maillage statique) ; Draw() ne dessine que les feux, dont l'état change
+    void Bake(RoadMeshBuilder& out) const;
     void Draw() const;
+    BoundingBox GetLightBounds() const; // poteaux et boîtiers des feux (culling)
+    
+    // Mobilier des feux, partagé par Draw() et le rendu instancié (RoadMesh) : 4 feux, 0 sans feux
+    static constexpr float kPoleHeight = 13.0f;
+    static constexpr float kLampSpacing = 1.8f; // rouge au-dessus, vert au-dessous
+    int GetLightProps(TrafficLightProp out[4]) const;
+    void GetLampColors(Color out[3]) const; // rouge, orange, vert (éteints en transparence)
 };
 
 #endif
\ No newline at end of file
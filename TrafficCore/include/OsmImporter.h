@@ -0,0 +1,43 @@
+#ifndef OSMIMPORTER_H
+#define OSMIMPORTER_H
+
+#include "RoadNetwork.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+struct OsmImportOptions {
+    float unitsPerMeter = 4.5f;   // voie OSM ~3,5 m <-> laneWidth 16 unités
+    float mergeDistance = 15.0f;  // m : carrefours plus proches fusionnés (chaussées séparées, bretelles)
+    bool includeService = false;  // highway=service (parkings, accès privés)
+};
+
+struct OsmImportStats {
+    size_t osmNodes = 0;      // noeuds lus dans le fichier
+    size_t osmWays = 0;
+    size_t drivableWays = 0;
+    size_t roundabouts = 0;   // anneaux junction=roundabout réduits à un noeud
+    size_t trafficLights = 0;
+};
+
+// OsmImporter : extrait OpenStreetMap (.osm XML) -> RoadNetwork.
+// - Lecture en flux sur le fichier projeté (XmlReader) : deux passes, les voies puis les seuls
+//   noeuds qu'elles référencent ; la mémoire suit la taille du réseau routier, pas du fichier
+// - Voies carrossables uniquement (highway=motorway..residential, liens, living_street)
+// - Carrefours simplifiés : noeud OSM partagé ou extrémité de voie = carrefour ; carrefours à
+//   moins de mergeDistance fusionnés ; anneau junction=roundabout = un noeud ROUNDABOUT
+//   (centre et rayon de l'anneau) ; highway=traffic_signals = TRAFFIC_LIGHT
+// - Une voie est découpée en RoadSegment droits entre carrefours ; voies : tag lanes, sinon classe
+// - Double sens = aller visible + retour invisible (convention de configuration.json), oneway respecté
+// Le format .osm.pbf (protobuf compressé) n'est pas lu : le convertir en .osm au préalable.
+class OsmImporter {
+public:
+    static bool ImportFile(const std::string& path, RoadNetwork& outNetwork,
+                           const OsmImportOptions& options = OsmImportOptions(),
+                           OsmImportStats* stats = nullptr, std::string* error = nullptr);
+    static bool ImportMemory(std::string_view xml, RoadNetwork& outNetwork,
+                             const OsmImportOptions& options = OsmImportOptions(),
+                             OsmImportStats* stats = nullptr, std::string* error = nullptr);
+};
+
+#endif // OSMIMPORTER_H
@@ -1,20 +1,42 @@
 #ifndef PATHFINDER_H
 #define PATHFINDER_H
 
+#include <deque>
 #include <vector>
 #include "Node.h"
 
 class RoadNetwork;
+class RoadSegment;
+class RoutingGraph;
+struct EdgeWeights;
 
 // PathFinder : implémentation A* simple mais extensible.
-// - Respecte le graphe (Noeuds = intersections, Arêtes = RoadSegment)
-// - Coût principal : longueur de segment
-// - Coût additionnel : préférence pour routes larges (plus de voies)
+// - Respecte le graphe (Noeuds = intersections, Arêtes = RoadSegment orientés start -> end)
+// - Recherche par arcs : coût de manoeuvre à chaque noeud (virage, rond-point), restrictions respectées
+// - Coût : temps de parcours estimé (TravelTimeTable), lissé à partir du trafic réel
+// - Réseau vide de trafic : temps fluide, qui garde la préférence pour les routes larges
 // - API courte : conserve FindPath(start,end)
 class PathFinder {
 public:
     explicit PathFinder(const RoadNetwork* network);
     std::vector<Node*> FindPath(Node* start, Node* end) const;
+    // Même recherche, renvoie directement les segments à suivre
+    std::deque<RoadSegment*> FindRoute(Node* start, Node* end) const;
+
+    // Coeur A* sur un instantané : n'accède ni au RoadNetwork ni aux Node,
+    // peut donc tourner sur un thread worker. Renvoie les index de segments.
+    static std::vector<int> Search(const RoutingGraph& graph, const EdgeWeights& weights, int from, int to);
+
+    // Source la plus proche (en temps) de la destination parmi plusieurs candidates
+    struct SourceMatch {
+        int source = -1;       // index du noeud retenu dans le graphe, -1 si aucun n'atteint la destination
+        float seconds = 0.0f;  // temps de trajet estimé
+        std::vector<int> route; // segments depuis la source
+    };
+    // Une seule recherche arrière depuis la destination (Dijkstra multi-sources sur les arcs) :
+    // s'arrête dès que la première source est atteinte, quel que soit le nombre de candidates.
+    static SourceMatch SearchNearestSource(const RoutingGraph& graph, const EdgeWeights& weights,
+                                           const std::vector<int>& sources, int to);
 
 private:
     const RoadNetwork* network;
@@ -0,0 +1,56 @@
+#ifndef PATHSERVICE_H
+#define PATHSERVICE_H
+
+#include "core/ThreadPool.h"
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+
+class Node;
+class RoadSegment;
+class RoadNetwork;
+class DStarLite;
+struct RouteSet;
+
+// Résultat d'une requête : les pointeurs de segments ne sont valides que tant que
+// la topologie du réseau n'a pas changé (comparer topologyVersion avant usage).
+struct RouteResult {
+    uint64_t topologyVersion = 0;
+    std::deque<RoadSegment*> route; // vide si aucun chemin
+};
+
+using RouteTicket = std::shared_future<RouteResult>;
+// Planificateur incrémental déjà résolu une première fois (nullptr si requête invalide)
+using PlannerTicket = std::shared_future<std::shared_ptr<DStarLite>>;
+// Itinéraires alternatifs d'un couple origine/destination (nullptr si requête invalide)
+using RouteSetTicket = std::shared_future<std::shared_ptr<const RouteSet>>;
+
+// PathService : calcul d'itinéraires asynchrone.
+// RequestRoute() fige l'instantané (RoutingGraph + EdgeWeights) sur le thread appelant,
+// puis l'A* tourne sur un worker. L'appelant interroge son ticket à chaque frame.
+class PathService {
+public:
+    static PathService& GetInstance();
+
+    explicit PathService(unsigned workerCount = 0);
+
+    // À appeler depuis le thread de simulation (lecture de la topologie)
+    RouteTicket RequestRoute(const RoadNetwork& network, Node* start, Node* end);
+    // Recherche initiale d'un D* Lite sur un worker ; le planificateur est ensuite réparé par son propriétaire
+    PlannerTicket RequestPlanner(const RoadNetwork& network, Node* start, Node* goal);
+    // Jusqu'à k itinéraires sans boucle (méthode des pénalités), calculés sur un worker
+    RouteSetTicket RequestRouteSet(const RoadNetwork& network, Node* start, Node* end, int k);
+
+    template <class T>
+    static bool IsReady(const std::shared_future<T>& ticket) {
+        return ticket.valid() && ticket.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    }
+    size_t GetQueuedCount() const { return pool.GetQueuedCount(); }
+
+private:
+    ThreadPool pool;
+};
+
+#endif // PATHSERVICE_H
@@ -0,0 +1,85 @@
+#ifndef ROADMESH_H
+#define ROADMESH_H
+
+#include "raylib.h"
+#include "geometry/Frustum.h"
+#include "geometry/InstanceBatch.h"
+#include "geometry/RoadMeshBuilder.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+class RoadNetwork;
+class Node;
+
+// RoadMesh : partie statique du réseau (routes, marquages, trottoirs, passages piétons, carrefours,
+// ronds-points) cuite en Mesh raylib, un par tuile de kTileSize unités : quelques appels de rendu
+// au lieu de milliers de rlVertex3f / DrawLine3D par frame.
+// - Sync() compare la version de topologie : après une édition, seules les tuiles des emplacements
+//   notés dans le journal de RoadNetwork sont recuites (toutes si le journal ne suffit pas)
+// - l'envoi au GPU est différé au Draw() suivant (Sync() n'a pas besoin de contexte graphique)
+// - Draw(view) saute les tuiles dont la boîte englobante est hors du champ de la caméra
+// Les feux tricolores (poteaux, boîtiers, lampes) sont rangés par tuile en InstanceBatch à la cuisson :
+// trois appels instanciés par tuile visible, seules les couleurs des lampes changent d'une frame à
+// l'autre. Sans instanciation, DrawLights() renvoie false et les feux sont dessinés un par un.
+class RoadMesh {
+public:
+    static constexpr float kTileSize = 1024.0f;
+
+    RoadMesh() = default;
+    ~RoadMesh();
+
+    RoadMesh(const RoadMesh&) = delete;
+    RoadMesh& operator=(const RoadMesh&) = delete;
+
+    // Nombre de tuiles recuites (0 : déjà à jour)
+    int Sync(const RoadNetwork& network);
+    void Draw(const Frustum* view = nullptr);
+    bool DrawLights(const Frustum* view = nullptr);
+    // Libère les buffers GPU (contexte encore ouvert) ; tout sera recuit au prochain Sync()
+    void Release();
+
+    uint64_t GetVersion() const { return version; }
+    int GetTileCount() const { return static_cast<int>(tiles.size()); }
+    int GetDrawCallCount() const; // tuiles non vides
+    int GetVertexCount() const;
+    int GetLightCount() const; // carrefours à feux cuits
+    const CullStats& GetCullStats() const { return stats; } // tuiles du dernier Draw()
+
+private:
+    struct Tile {
+        RoadMeshBuilder geometry; // en attente d'envoi, vidé ensuite
+        int vertexCount = 0;
+        BoundingBox bounds = {};
+        Mesh mesh = {};
+        bool uploaded = false;
+        std::vector<int> segments;      // emplacements dans RoadNetwork
+        std::vector<int> intersections;
+        // Feux : noeuds dans l'ordre des instances (4 coins, 3 lampes par coin)
+        std::vector<const Node*> lightNodes;
+        InstanceBatch poles;
+        InstanceBatch boxes;
+        InstanceBatch lamps;
+    };
+
+    std::unordered_map<int64_t, Tile> tiles;
+    std::vector<int64_t> segmentTile; // tuile de chaque emplacement au dernier Sync()
+    std::vector<int64_t> nodeTile;
+    uint64_t version = 0;
+    Material material = {};
+    bool hasMaterial = false;
+    CullStats stats;
+    enum LightPart { kPole, kBox, kLamp, kLightPartCount };
+    Mesh lightMeshes[kLightPartCount] = {};
+    Material lightMaterials[kLightPartCount] = {};
+    bool hasLightMeshes = false;
+    std::vector<Color> lampColors; // tampon réutilisé d'une tuile à l'autre
+
+    static int64_t TileOf(Vector3 position);
+    static void Upload(Tile& tile);
+    static void Unload(Tile& tile);
+    static void BakeLights(Tile& tile, const RoadNetwork& network);
+    void ReleaseLightMeshes();
+};
+
+#endif // ROADMESH_H
@@ -4,17 +4,75 @@
 #include "Node.h"
 #include "RoadSegment.h"
 #include "Intersection.h"
+#include "TravelTimeTable.h"
+#include "RoutingGraph.h"
+#include "SpatialIndex.h"
+#include "RoadMesh.h"
 #include <vector>
+#include <limits>
 #include <memory>
 #include <string>
+#include <unordered_map>
+
+// Manoeuvre interdite : entrer par from -> via puis sortir vers via -> to (ids de noeuds)
+struct TurnRestriction {
+    int fromNodeId;
+    int viaNodeId;
+    int toNodeId;
+};
 
 class RoadNetwork {
 private:
     std::vector<std::unique_ptr<Node>> nodes;
     std::vector<std::unique_ptr<RoadSegment>> roadSegments;
     std::vector<std::unique_ptr<Intersection>> intersections;
+    TravelTimeTable travelTimes;
+    std::vector<TurnRestriction> turnRestrictions;
+    bool uTurnsAllowed = false;
+    std::vector<int> spawnNodeIds;
+    
+    int nextNodeId; // toujours > plus grand id utilisé
+    
+    // Index id -> position dans nodes : tableau direct pour les ids compacts (cas courant),
+    // table de hachage pour les ids épars (imports OSM...). -1 = case libre.
+    static constexpr int kDenseIdSlack = 1024;
+    std::vector<int> denseNodeIndex;
+    std::unordered_map<int, int> sparseNodeIndex;
+    bool IndexNode(int id, int position);
+    void UnindexNode(int id);
+    RoadSegment* RegisterSegment(std::unique_ptr<RoadSegment> segment);
+    
+    // Incrémenté à chaque changement de topologie ; invalide l'instantané de routage
+    uint64_t topologyVersion = 1;
+    mutable std::shared_ptr<const RoutingGraph> routingGraph;
+    mutable std::shared_ptr<const SpatialIndex> spatialIndex;
+    
+    // Journal des éditions : emplacements (index de noeud / de segment) dont le contenu a changé,
+    // datés par la version de topologie ; les instantanés s'en servent pour se corriger localement.
+    // Un emplacement est noté dès que ce qu'il désigne change : ajout, retrait, échange avec le
+    // dernier, déplacement, et pour un noeud, tout changement d'un segment qui le touche.
+    struct Edit {
+        uint64_t version;
+        int index;
+        bool segment; // sinon noeud
+    };
+    static constexpr size_t kEditJournalLimit = 4096;
+    std::vector<Edit> editJournal;
+    uint64_t journalStart = 1; // instantanés plus anciens : journal incomplet
+    void TouchNode(int index);
+    void TouchSegment(int index);
+    void ResetJournal();
+    void TrimJournal();
+    void RemoveSegmentAt(int index);
+    void RebuildAround(int nodeIndex);
+    void RefreshSegment(RoadSegment* segment); // journal + temps fluide après changement de géométrie
     
-    int nextNodeId;
+    // Éléments retirés : encore désignés par des véhicules ou des instantanés jusqu'à ReleaseRetired()
+    std::vector<std::unique_ptr<Node>> retiredNodes;
+    std::vector<std::unique_ptr<RoadSegment>> retiredSegments;
+    std::vector<std::unique_ptr<Intersection>> retiredIntersections;
+    
+    mutable RoadMesh roadMesh; // rendu statique, recuit au premier Draw() qui suit une édition
     
 public:
     RoadNetwork();
@@ -22,22 +80,80 @@ public:
     
     // Construction du réseau
     Node* AddNode(Vector3 position, NodeType type = SIMPLE_INTERSECTION, float radius = 5.0f);
+    // Id imposé (fichier de carte) ; nullptr si l'id est déjà pris ou au-delà de kMaxNodeId
+    static constexpr int kMaxNodeId = std::numeric_limits<int>::max() - 1; // nextNodeId = id + 1 reste un int
+    Node* AddNodeWithId(int id, Vector3 position, NodeType type = SIMPLE_INTERSECTION, float radius = 5.0f);
     RoadSegment* AddRoadSegment(Node* start, Node* end, int lanes, bool curved = true);
+    // Segment à géométrie précalculée (carte compilée, voir MapBinary)
+    RoadSegment* AddBakedRoadSegment(Node* start, Node* end, int lanes, const Vector3* controls, int controlCount,
+                                     std::vector<RoadSegment::Sidewalk> sidewalks);
     Intersection* AddIntersection(Node* node);
     
+    // Restrictions de manoeuvre (prises en compte par le routage)
+    void AddTurnRestriction(int fromNodeId, int viaNodeId, int toNodeId);
+    bool RemoveTurnRestriction(int fromNodeId, int viaNodeId, int toNodeId);
+    const std::vector<TurnRestriction>& GetTurnRestrictions() const { return turnRestrictions; }
+    // Demi-tours hors ronds-points et impasses (interdits par défaut)
+    void SetUTurnsAllowed(bool allowed);
+    bool AreUTurnsAllowed() const { return uTurnsAllowed; }
+    // Noeuds de flux (scenario.spawn_points) : origines / destinations des véhicules, ids de noeuds
+    void SetSpawnNodeIds(std::vector<int> ids) { spawnNodeIds = std::move(ids); }
+    const std::vector<int>& GetSpawnNodeIds() const { return spawnNodeIds; }
+    
+    // Édition à chaud (éditeur, scénarios), sans Clear() : la géométrie des segments touchés est
+    // recalculée tout de suite, routage et index spatial sont corrigés localement à la lecture.
+    // Un retrait échange l'élément avec le dernier (un seul index déplacé). Les éléments retirés
+    // restent valides jusqu'à ReleaseRetired(), le temps que les véhicules soient replanifiés.
+    bool RemoveRoadSegment(RoadSegment* segment);
+    bool RemoveNode(Node* node); // avec ses segments, son intersection et ses restrictions
+    bool MoveNode(Node* node, Vector3 position);
+    bool SetNodeShape(Node* node, NodeType type, float radius);
+    bool SetSegmentLanes(RoadSegment* segment, int lanes);
+    bool SetSegmentCurved(RoadSegment* segment, bool curved); // raccord courbe vers un rond-point
+    bool SetSegmentVisible(RoadSegment* segment, bool visible); // après le premier rendu (maillage statique)
+    // Fin de frame, une fois trafic et urgences mis à jour
+    void ReleaseRetired();
+    
+    // Emplacements modifiés depuis une version (triés, sans doublon). false : journal incomplet ou
+    // changements trop étendus, l'appelant reconstruit entièrement.
+    bool GetEditsSince(uint64_t version, std::vector<int>& nodeSlots, std::vector<int>& segmentSlots) const;
+    
     // Accès aux éléments
     const std::vector<std::unique_ptr<Node>>& GetNodes() const { return nodes; }
     const std::vector<std::unique_ptr<RoadSegment>>& GetRoadSegments() const { return roadSegments; }
     const std::vector<std::unique_ptr<Intersection>>& GetIntersections() const { return intersections; }
     
-    // Trouver un noeud par ID
+    // Trouver un noeud par ID (O(1))
     Node* FindNodeById(int id) const;
+    // Position dans GetNodes() (O(1)), -1 si le noeud n'appartient pas (ou plus) au réseau
+    int GetNodeIndex(const Node* node) const;
+    // Segment toujours présent (pas retiré par une édition)
+    bool IsLive(const RoadSegment* segment) const;
     
     // Pathfinding is now handled by PathFinder class.
     
+    // Temps de parcours vivants (coût de routage)
+    void RecordTraversal(const RoadSegment* segment, float seconds);
+    // Fermeture / réouverture d'un segment : publiée immédiatement
+    void SetSegmentClosed(const RoadSegment* segment, bool closed);
+    bool IsSegmentClosed(const RoadSegment* segment) const;
+    void PublishTravelTimes() { travelTimes.Publish(); }
+    std::shared_ptr<const EdgeWeights> GetEdgeWeights() const { return travelTimes.GetWeights(); }
+    const TravelTimeTable& GetTravelTimes() const { return travelTimes; }
+    
+    // Instantané immuable pour le routage (reconstruit au besoin, thread de simulation)
+    std::shared_ptr<const RoutingGraph> GetRoutingGraph() const;
+    // Instantané construit ailleurs (carte compilée) : retenu s'il porte la version courante
+    bool AdoptRoutingGraph(std::shared_ptr<const RoutingGraph> graph);
+    // Index spatial (plus proche noeud / segment, requêtes par rayon), même cycle de vie
+    std::shared_ptr<const SpatialIndex> GetSpatialIndex() const;
+    bool AdoptSpatialIndex(std::shared_ptr<const SpatialIndex> index);
+    uint64_t GetTopologyVersion() const { return topologyVersion; }
+    
     // Mise à jour et rendu
     void Update(float deltaTime);
-    void Draw() const;
+    void Draw(const Frustum* view = nullptr) const; // view : tuiles et feux hors champ sautés
+    const RoadMesh& GetRoadMesh() const { return roadMesh; }
     
     // Statistiques
     int GetNodeCount() const { return static_cast<int>(nodes.size()); }
@@ -6,6 +6,8 @@
 #include <memory>
 #include <vector>
 
+class RoadMeshBuilder;
+
 class RoadSegment {
 private:
     Node* startNode;
@@ -13,7 +15,11 @@ private:
     int lanes;
     float laneWidth;
     std::unique_ptr<RoadGeometryStrategy> geometry;
+    Vector3 controlPoints[4];     // Définition de la géométrie : 2 points (droite) ou 4 (Bézier)
+    int controlPointCount = 0;
+    bool curvedConnection = true; // raccord en courbe vers les ronds-points (reconstruction)
     bool visible = true; // Default to true
+    int index = -1;      // Position dans RoadNetwork (clé des tables de routage)
 
 public:
     struct Sidewalk {
@@ -27,18 +33,32 @@ private:
     std::vector<Sidewalk> sidewalks;
 
     void CreateGeometry(bool useCurvedConnection);
+    void SetGeometry(const Vector3* controls, int count);
     void CreateSidewalks();
-    void DrawSidewalk(const Sidewalk& sidewalk) const;
-    void DrawCrosswalk(Vector3 position, Vector3 direction, float roadWidth) const;  // AJOUTÉ
+    void BakeSidewalk(RoadMeshBuilder& out, const Sidewalk& sidewalk) const;
+    void BakeCrosswalk(RoadMeshBuilder& out, Vector3 position, Vector3 direction, float roadWidth) const;
     
     float CalculateIntersectionClearance(Node* node) const;
 
 public:
     RoadSegment(Node* start, Node* end, int lanes, bool useCurvedConnection = true);
+    // Géométrie précalculée (carte compilée) : ni calcul de raccord ni génération des trottoirs
+    RoadSegment(Node* start, Node* end, int lanes, const Vector3* controls, int controlCount,
+                std::vector<Sidewalk> bakedSidewalks);
 
-    void Draw() const;
-    void SetVisible(bool v) { visible = v; }
+    // Route, trottoirs et passages piétons ajoutés au maillage statique (RoadMesh)
+    void Bake(RoadMeshBuilder& out) const;
+    void SetVisible(bool v) { visible = v; } // réseau déjà rendu : RoadNetwork::SetSegmentVisible
     bool IsVisible() const { return visible; }
+    void SetIndex(int i) { index = i; }
+    int GetIndex() const { return index; }
+
+    // Édition à chaud (RoadNetwork) : géométrie et trottoirs recalculés depuis les noeuds
+    void SetLanes(int count);
+    void SetCurved(bool curved) { curvedConnection = curved; } // pris en compte au prochain Rebuild()
+    bool IsCurved() const { return curvedConnection; }
+    void Rebuild();
+    void Detach(); // retire le segment des routes connectées de ses deux noeuds
 
     Node* GetStartNode() const { return startNode; }
     Node* GetEndNode() const { return endNode; }
@@ -46,6 +66,8 @@ public:
     float GetWidth() const { return lanes * laneWidth; }
     float GetLength() const;
     RoadGeometryStrategy* GetGeometry() const { return geometry.get(); }
+    const Vector3* GetControlPoints() const { return controlPoints; }
+    int GetControlPointCount() const { return controlPointCount; }
 
     Vector3 GetLanePosition(int laneIndex, float t) const;
 
@@ -0,0 +1,36 @@
+#ifndef ROUTESET_H
+#define ROUTESET_H
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+class RoutingGraph;
+struct EdgeWeights;
+
+// RouteSet : itinéraires alternatifs sans boucle pour un couple origine/destination.
+// - Générés par pénalités : chaque A* renchérit les segments déjà utilisés, ce qui pousse
+//   la recherche suivante vers un autre couloir ; on écarte les doublons et les détours trop longs
+// - Valables pour une version de topologie (index de segments), indépendants des temps de parcours :
+//   le choix au moment du spawn se fait sur les coûts courants (logit)
+struct RouteSet {
+    static constexpr float kPenalty = 1.5f;     // multiplicateur sur les segments déjà empruntés
+    static constexpr float kMaxStretch = 1.4f;  // détour max. par rapport au plus court (coût réel)
+    static constexpr float kLogitScale = 8.0f;  // sensibilité du choix à l'écart de coût relatif
+
+    uint64_t topologyVersion = 0;
+    int from = -1;
+    int to = -1;
+    std::vector<std::vector<int>> routes; // index de segments, le premier est le plus court au calcul
+
+    static std::shared_ptr<const RouteSet> Build(const RoutingGraph& graph, const EdgeWeights& weights,
+                                                 int from, int to, int k);
+    // Temps d'un itinéraire (parcours + manoeuvres) avec les poids donnés ; infini si fermé ou interdit
+    static float RouteSeconds(const RoutingGraph& graph, const EdgeWeights& weights, const std::vector<int>& route);
+
+    // Tirage logit : P(i) ~ exp(-kLogitScale * coût_i / coût_min) ; -1 si aucun itinéraire praticable
+    int Choose(const RoutingGraph& graph, const EdgeWeights& weights, std::mt19937& rng) const;
+};
+
+#endif // ROUTESET_H
@@ -0,0 +1,98 @@
+#ifndef ROUTINGGRAPH_H
+#define ROUTINGGRAPH_H
+
+#include "raylib.h"
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+class Node;
+class RoadSegment;
+class RoadNetwork;
+
+// RoutingGraph : instantané immuable de la topologie pour le routage (format CSR).
+// - Noeuds indexés densément, positions copiées (heuristique A* sans toucher aux Node)
+// - Un arc orienté start -> end par RoadSegment, clé = RoadSegment::GetIndex()
+// - Table de manoeuvres par noeud (arc entrant x arc sortant) : coût de virage quantifié
+//   sur 16 bits, kForbidden pour les manoeuvres interdites. Taille = somme(degré entrant x degré sortant).
+// Construit sur le thread de simulation, lu sans verrou par les workers du PathService.
+// Après une édition à chaud, Patch() recopie les lignes intactes de l'instantané précédent et
+// ne recalcule que celles des noeuds notés au journal (même résultat que Build()).
+class RoutingGraph {
+public:
+    static constexpr uint16_t kForbidden = 0xFFFF;
+    static constexpr float kMovementQuantum = 0.01f; // secondes par unité
+
+    static std::shared_ptr<const RoutingGraph> Build(const RoadNetwork& network, uint64_t topologyVersion);
+    // touchedNodes : RoadNetwork::GetEditsSince(previous.GetVersion(), ...)
+    static std::shared_ptr<const RoutingGraph> Patch(const RoutingGraph& previous, const RoadNetwork& network,
+                                                     const std::vector<int>& touchedNodes, uint64_t topologyVersion);
+
+    // Temps de manoeuvre au noeud intermédiaire (temps fluide, même modèle que Vehicule::updatePhysics)
+    static float ComputeMovementSeconds(const Node& via, const RoadSegment& in, const RoadSegment& out);
+
+    uint64_t GetVersion() const { return version; }
+    int GetNodeCount() const { return static_cast<int>(nodes.size()); }
+    int GetEdgeCount() const { return static_cast<int>(targets.size()); }
+
+    int IndexOf(const Node* node) const; // -1 si le noeud n'appartient pas à l'instantané
+    Node* GetNode(int index) const { return nodes[index]; }
+    const Vector3& GetPosition(int index) const { return positions[index]; }
+
+    // Arcs sortants de u : [EdgeBegin(u), EdgeEnd(u))
+    int EdgeBegin(int u) const { return offsets[u]; }
+    int EdgeEnd(int u) const { return offsets[u + 1]; }
+    int EdgeTarget(int e) const { return targets[e]; }
+    int EdgeSegment(int e) const { return edgeSegments[e]; }
+    int EdgeSource(int e) const { return sources[e]; }
+    int ArcOfSegment(int segmentIndex) const { return segmentArcs[segmentIndex]; } // -1 si hors graphe
+
+    // Arcs entrants de v (CSR inverse) : InEdge(i) pour i dans [InEdgeBegin(v), InEdgeEnd(v))
+    int InEdgeBegin(int v) const { return inOffsets[v]; }
+    int InEdgeEnd(int v) const { return inOffsets[v + 1]; }
+    int InEdge(int i) const { return inArcs[i]; }
+
+    // Manoeuvre inArc -> outArc (outArc doit partir du noeud d'arrivée de inArc)
+    uint16_t GetMovement(int inArc, int outArc) const {
+        int v = targets[inArc];
+        int outDegree = offsets[v + 1] - offsets[v];
+        return movements[movementOffsets[v] + inLocal[inArc] * outDegree + (outArc - offsets[v])];
+    }
+    static bool IsForbidden(uint16_t movement) { return movement == kForbidden; }
+    static float MovementSeconds(uint16_t movement) { return movement * kMovementQuantum; }
+    int GetMovementCount() const { return static_cast<int>(movements.size()); }
+
+    RoadSegment* GetSegment(int segmentIndex) const { return segments[segmentIndex]; }
+
+private:
+    friend class MapBinary; // sérialise / recharge les tableaux CSR tels quels
+
+    // Arcs entrants, rangs et tailles des tables de manoeuvres, d'après le CSR sortant
+    void IndexIncoming();
+    void FillMovements(int v, const std::set<std::tuple<int, int, int>>& restricted, bool uTurnsAllowed);
+
+    uint64_t version = 0;
+    std::vector<Node*> nodes;
+    std::vector<Vector3> positions;
+    // Table complète partagée entre instantanés corrigés ; movedNodes la complète (noeuds
+    // ajoutés ou déplacés depuis). Entrées vérifiées contre nodes : les noeuds retirés y traînent.
+    std::shared_ptr<const std::unordered_map<const Node*, int>> nodeIndex;
+    std::unordered_map<const Node*, int> movedNodes;
+
+    std::vector<int> offsets;      // taille nodes + 1
+    std::vector<int> targets;      // noeud d'arrivée de chaque arc
+    std::vector<int> edgeSegments; // segment porté par chaque arc
+    std::vector<int> sources;      // noeud de départ de chaque arc
+    std::vector<int> segmentArcs;  // segment -> arc
+    std::vector<int> inLocal;      // rang de l'arc parmi les arcs entrant dans sa cible
+    std::vector<int> inOffsets;    // taille nodes + 1
+    std::vector<int> inArcs;
+    std::vector<int> movementOffsets; // taille nodes + 1
+    std::vector<uint16_t> movements;
+    std::vector<RoadSegment*> segments;
+};
+
+#endif // ROUTINGGRAPH_H
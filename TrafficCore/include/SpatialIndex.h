@@ -0,0 +1,125 @@
+#ifndef SPATIALINDEX_H
+#define SPATIALINDEX_H
+
+#include "raylib.h"
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+class RoadNetwork;
+class RoadSegment;
+
+// Résultat d'un recalage sur la chaussée
+struct SegmentMatch {
+    int segment = -1;        // RoadSegment::GetIndex(), -1 si rien à portée
+    float t = 0.0f;          // progression 0..1 le long du tracé (même mesure que ComputeProgressOnSegment)
+    int lane = 0;            // voie de GetTrafficLanePosition la plus proche du point
+    float distance = 0.0f;   // distance à l'axe de la chaussée
+    Vector3 position = {0.0f, 0.0f, 0.0f}; // projeté sur l'axe
+};
+
+// SpatialIndex : R-tree statique (plan XZ) sur les positions des noeuds et les tracés des segments.
+// - Rangement STR (tri par tranches en x puis en z), 16 entrées par boîte, tableaux contigus
+// - Les tracés sont découpés en morceaux (paires de points consécutifs de la géométrie)
+// - Plus proche voisin : parcours du meilleur d'abord ; requêtes par rayon : descente élaguée
+// Instantané immuable comme le RoutingGraph : les index de noeud sont ceux de
+// RoadNetwork::GetNodes() (donc du RoutingGraph de même version).
+// Après une édition à chaud, Patch() garde les arbres (partagés avec l'instantané précédent),
+// y masque les emplacements notés au journal et range leur nouveau contenu dans de courtes
+// listes parcourues linéairement ; au-delà de kLooseLimit éléments, reconstruction complète.
+class SpatialIndex {
+public:
+    static constexpr int kFanout = 16;
+    static constexpr size_t kLooseLimit = 2048;
+
+    static std::shared_ptr<const SpatialIndex> Build(const RoadNetwork& network, uint64_t topologyVersion);
+    // touchedNodes / touchedSegments : RoadNetwork::GetEditsSince(previous.GetVersion(), ...)
+    static std::shared_ptr<const SpatialIndex> Patch(const SpatialIndex& previous, const RoadNetwork& network,
+                                                     const std::vector<int>& touchedNodes,
+                                                     const std::vector<int>& touchedSegments, uint64_t topologyVersion);
+
+    uint64_t GetVersion() const { return version; }
+    int GetNodeCount() const;
+    int GetPieceCount() const;
+    bool IsPatched() const { return patched; }
+
+    // Index du noeud le plus proche, -1 si réseau vide
+    int NearestNode(Vector3 position) const;
+    // Segment dont l'axe passe au plus près (au-delà de maxDistance : segment = -1).
+    // Double sens superposé (aller + retour) : le sens dont le point est à droite l'emporte.
+    SegmentMatch NearestSegment(Vector3 position,
+                                float maxDistance = std::numeric_limits<float>::infinity()) const;
+
+    // Éléments à moins de radius (ordre quelconque, out est vidé)
+    void QueryNodes(Vector3 center, float radius, std::vector<int>& out) const;
+    void QuerySegments(Vector3 center, float radius, std::vector<int>& out) const; // sans doublon
+
+private:
+    friend class MapBinary; // sérialise / recharge les arbres tels quels
+
+    struct Box {
+        float minX, minZ, maxX, maxZ;
+    };
+
+    // Morceau de tracé [a, b], t0/t1 : progression aux extrémités
+    struct Piece {
+        float ax, ay, az, bx, by, bz;
+        float t0, t1;
+        int32_t segment;
+    };
+
+    // Boîtes rangées par niveau : feuilles d'abord, racine en dernier.
+    // Feuille : éléments items[first, first + count) ; sinon boîtes filles [first, first + count).
+    struct Tree {
+        std::vector<Box> boxes;
+        std::vector<int32_t> first;
+        std::vector<int32_t> count;
+        int32_t leafCount = 0;
+        std::vector<int32_t> items;    // identifiants dans l'ordre de rangement
+        std::vector<Box> itemBoxes;    // boîte de chaque élément, même ordre
+
+        void Pack(const std::vector<Box>& elementBoxes);
+        bool IsValid(int elementCount) const; // cohérence d'un arbre rechargé
+        int Root() const { return static_cast<int>(boxes.size()) - 1; }
+    };
+
+    // Arbres figés à l'empaquetage ; emplacement = index de noeud / segment à ce moment-là
+    struct Packed {
+        Tree nodeTree;
+        Tree segmentTree; // éléments = index dans pieces (rangés par segment croissant)
+        std::vector<Piece> pieces;
+        std::vector<RoadSegment*> segments;
+    };
+
+    // Contenu courant d'un emplacement modifié depuis l'empaquetage
+    struct LooseNode {
+        int index;
+        float x, z;
+    };
+    struct LoosePiece {
+        Piece piece; // piece.segment = index courant
+        RoadSegment* segment;
+    };
+
+    // itemDistSq(k) : distance au carré du k-ième élément rangé, infinie s'il est masqué
+    template <class ItemDistance>
+    int Nearest(const Tree& tree, float x, float z, float maxDistSq, ItemDistance itemDistSq, float& bestDistSq) const;
+    void Query(const Tree& tree, float x, float z, float radius, std::vector<int>& out) const;
+    float PieceDistSq(const Piece& p, float x, float z, float& u) const;
+    static void CutPieces(const RoadSegment& segment, int32_t segmentIndex, std::vector<Piece>& out);
+    bool NodeMasked(int slot) const { return !maskedNodes.empty() && maskedNodes[slot]; }
+    bool SegmentMasked(int slot) const { return !maskedSegments.empty() && maskedSegments[slot]; }
+
+    uint64_t version = 0;
+    std::shared_ptr<const Packed> packed;
+    bool patched = false;
+    std::vector<char> maskedNodes;    // vides tant que rien n'est masqué
+    std::vector<char> maskedSegments;
+    int maskedNodeCount = 0;
+    int maskedPieceCount = 0;
+    std::vector<LooseNode> looseNodes;
+    std::vector<LoosePiece> loosePieces;
+};
+
+#endif // SPATIALINDEX_H
@@ -0,0 +1,89 @@
+#ifndef STATICPROPS_H
+#define STATICPROPS_H
+
+#include "raylib.h"
+#include "Vehicules/ModelLod.h"
+#include "geometry/Frustum.h"
+#include "geometry/InstanceBatch.h"
+#include "geometry/RenderGrid.h"
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+// StaticProps : décor immobile (arbres, plantes, abribus, bâtiments) regroupé par case de
+// RenderGrid::kCellSize unités et par modèle. Chaque groupe garde ses matrices dans des InstanceBatch
+// envoyés une fois au GPU : un appel instancié par maillage du modèle et par groupe visible, au lieu
+// d'un DrawModelEx par objet.
+// - culling et distance de coupure par groupe (boîte des objets du groupe) ; un groupe visible est
+//   dessiné en entier
+// - niveau de détail par groupe, d'après le point du groupe le plus proche de la caméra
+// - sans instanciation (InstanceBatch::IsAvailable() false), rendu objet par objet (RenderGrid +
+//   DrawModelLod) comme avant
+// Les modèles et leurs LOD restent à leur propriétaire (ModelManager, démo) et doivent lui survivre.
+class StaticProps {
+public:
+    StaticProps() = default;
+    ~StaticProps();
+    StaticProps(const StaticProps&) = delete;
+    StaticProps& operator=(const StaticProps&) = delete;
+
+    // Même placement que DrawModelEx (rotation en degrés autour de Y, échelle uniforme) ;
+    // maxDistance <= 0 : toujours dessiné s'il est dans le champ
+    int Add(const Model& model, const ModelLod* lod, Vector3 position, float rotation, float scale,
+            float maxDistance = 0.0f);
+    void Clear();
+
+    // Rendu dans BeginMode3D (LodSelector::SetView au préalable pour les niveaux de détail)
+    void Draw(const Frustum& view);
+    // Groupes à dessiner, par indice croissant ; compteurs (en objets) dans GetStats()
+    void QueryBatches(const Frustum& view, std::vector<int>& visible);
+    // Libère les tampons GPU (contexte encore ouvert) ; ils seront renvoyés au prochain Draw()
+    void Release();
+
+    const CullStats& GetStats() const { return stats; }
+    int GetCount() const { return static_cast<int>(props.size()); }
+    int GetBatchCount() const { return static_cast<int>(batches.size()); }
+    int GetBatchSize(int batch) const { return static_cast<int>(batches[batch].props.size()); }
+    LodLevel GetBatchLevel(int batch) const { return batches[batch].level; }
+    int GetDrawCallCount() const { return drawCalls; } // dernier Draw()
+
+private:
+    struct Prop {
+        const Model* model;
+        const ModelLod* lod;
+        Vector3 position;
+        float rotation;
+        float scale;
+        LodLevel level;
+    };
+    struct Batch {
+        const Model* model;
+        const ModelLod* lod;
+        BoundingBox bounds;
+        float maxDistance; // comme RenderGrid : 0 dès qu'un objet n'a pas de coupure
+        float radius;      // plus grande sphère englobante d'un objet (choix du LOD)
+        std::vector<int> props;
+        LodLevel level = LodLevel::Full;
+        bool dirty = true;     // matrices à recalculer
+        InstanceBatch models;  // modèle complet ou simplifié (même repère)
+        InstanceBatch boxes;   // niveau Box : cube unité, couleur moyenne par instance
+    };
+
+    std::vector<Prop> props;
+    std::vector<Batch> batches;
+    std::map<std::pair<int64_t, const Model*>, int> batchIndex;
+    RenderGrid grid; // rendu objet par objet, sans instanciation
+    std::vector<int> visible;
+    CullStats stats;
+    int drawCalls = 0;
+    Mesh unitCube = {};
+    Material boxMaterial = {};
+    bool hasBoxMesh = false;
+
+    static Matrix PropTransform(const Prop& prop);
+    void Bake(Batch& batch);
+    void DrawFallback(const Frustum& view);
+};
+
+#endif // STATICPROPS_H
@@ -0,0 +1,76 @@
+#ifndef TRAVELTIMETABLE_H
+#define TRAVELTIMETABLE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Poids publiés pour le routage : tableau immuable, indexé par RoadSegment::GetIndex().
+// Un lecteur garde son shared_ptr pendant toute sa requête : il voit une version
+// cohérente même si une nouvelle table est publiée entre-temps.
+struct EdgeWeights {
+    uint64_t version = 0;
+    std::vector<float> seconds;  // temps de parcours estimé par segment (infini si fermé)
+    float maxSpeed = 1.0f;       // borne sup. (distance noeud-noeud / temps) -> heuristique A* admissible
+    // Borne stable : vitesse au plus court temps observable (TravelTimeTable::kMinFreeFlowRatio), ne
+    // bouge qu'avec la topologie -> heuristique D* Lite admissible sans repartir de zéro
+    float speedBound = 1.0f;
+    std::vector<int> changed;    // segments modifiés depuis la version précédente (replanification incrémentale)
+};
+
+// TravelTimeTable : temps de parcours vivants par segment.
+// - Valeur initiale : temps "fluide" (longueur pondérée par le nombre de voies / vitesse de référence)
+// - Chaque véhicule qui quitte un segment rapporte son temps réel ; on lisse par moyenne exponentielle
+// - Publish() fige les estimations dans un nouvel EdgeWeights (version + 1), échangé atomiquement
+// Les écritures (AddSegment, Record, Publish) se font depuis le thread de simulation ;
+// GetWeights() lit la table publiée sans verrou depuis n'importe quel thread ; il ne la
+// reconstruit que si des segments ont été ajoutés (donc depuis le thread de simulation).
+class TravelTimeTable {
+public:
+    static constexpr float kReferenceSpeed = 100.0f; // unités/s, vitesse de croisière d'une voiture
+    static constexpr float kSmoothing = 0.2f;        // poids d'une nouvelle observation
+    static constexpr float kMinFreeFlowRatio = 0.5f; // observation la plus rapide retenue, en part du temps fluide
+
+    // Temps fluide d'un segment : conserve la préférence historique pour les routes larges
+    static float FreeFlowSeconds(float length, int lanes);
+
+    // Enregistre un nouveau segment ; chordLength = distance entre ses deux noeuds
+    void AddSegment(float freeFlowSeconds, float chordLength);
+    // Retrait par échange avec le dernier (même convention que RoadNetwork::RemoveRoadSegment)
+    void RemoveSegment(int segmentIndex);
+    // Segment reconstruit (voies, tracé) : estimation repartie du temps fluide
+    void ResetSegment(int segmentIndex, float freeFlowSeconds, float chordLength);
+    // Observation d'un véhicule sortant du segment
+    void Record(int segmentIndex, float seconds);
+    // Fermeture (travaux, accident) : poids infini jusqu'à réouverture
+    void SetClosed(int segmentIndex, bool closed);
+    bool IsClosed(int segmentIndex) const;
+    // Publie les estimations courantes si elles ont changé depuis la dernière publication
+    void Publish();
+    // Dernière table publiée (publie d'abord si des segments ont été ajoutés depuis)
+    std::shared_ptr<const EdgeWeights> GetWeights() const;
+
+    float GetEstimate(int segmentIndex) const;
+    float GetFreeFlow(int segmentIndex) const;
+    int GetSegmentCount() const { return static_cast<int>(estimates.size()); }
+    void Clear();
+
+private:
+    std::shared_ptr<const EdgeWeights> BuildWeights(uint64_t version) const;
+
+    std::vector<float> freeFlow;
+    std::vector<float> estimates;
+    std::vector<float> chordLengths;
+    std::vector<char> closedFlags;
+    mutable std::vector<int> pendingChanges; // modifiés depuis la dernière publication
+    mutable std::vector<char> pendingFlags;
+    void MarkChanged(int segmentIndex);
+    mutable bool dirty = true; // estimations non encore publiées
+
+    mutable std::mutex publishMutex;
+    mutable uint64_t lastVersion = 0; // monotone, même après Clear()
+    mutable std::shared_ptr<const EdgeWeights> published; // accès via std::atomic_load/store
+};
+
+#endif // TRAVELTIMETABLE_H
@@ -0,0 +1,33 @@
+#ifndef EMERGENCY_MODELS_H
+#define EMERGENCY_MODELS_H
+
+#include "raylib.h"
+#include "Emergencymanager.h" // EmergencyType
+#include <vector>
+
+// Modèle procédural d'un type de véhicule d'urgence, partagé par tous les véhicules du type
+struct EmergencyModel {
+    Model body = {};            // un maillage à couleurs par sommet (carrosserie, roues, échelle...)
+    std::vector<Vector3> lamps; // centres des lampes des gyrophares, repère de body : gauche, droite...
+};
+
+// EmergencyModels : ambulance, camion de pompiers et voiture de police cuits une fois par type, au lieu
+// d'une trentaine de DrawCube / DrawCylinder / DrawSphere par véhicule et par frame.
+// - la carrosserie est un Model ordinaire : instanciée par VehicleRenderer, niveaux de détail générés
+//   par ModelManager comme pour un modèle glTF
+// - les lampes des gyrophares partagent un petit cube blanc (GetLampModel), une instance par lampe
+//   teintée de sa couleur de la frame : seule cette couleur est animée
+// Cuisson sans contexte graphique ; l'envoi au GPU se fait au premier Get() avec la fenêtre ouverte.
+// Les modèles restent valides jusqu'à la fin du programme (véhicules encore en vie après la fenêtre).
+class EmergencyModels {
+public:
+    static constexpr float kLampSize = 0.3f;
+
+    static const EmergencyModel& Get(EmergencyType type);
+    static const Model& GetLampModel();
+    // Libère tampons GPU et LOD (contexte encore ouvert) ; les maillages restent côté CPU et seront
+    // renvoyés au prochain Get() fenêtre ouverte
+    static void Release();
+};
+
+#endif // EMERGENCY_MODELS_H
@@ -7,6 +7,8 @@
 #include "Node.h"
 #include "Vehicules/ModelManager.h"
 #include "Vehicules/Vehicule.h"
+#include "Vehicules/VehicleRenderer.h"
+#include "Isochrone.h"
 #include <vector>
 #include <algorithm>
 
@@ -29,6 +31,15 @@ private:
     Hospital hospital;
     std::vector<EmergencyVehicle*> emergencyVehicles;
     RoadNetwork* network;
+    // Rendu instancié des unités (modèles cuits par type, gyrophares compris)
+    VehicleRenderer renderer;
+    std::vector<Vehicule*> drawList;
+
+    // Couverture de l'hôpital : recalculée seulement si le réseau ou les temps ont changé
+    bool coverageVisible = false;
+    float coverageBudget = 180.0f;
+    ReachResult coverage;
+    void drawCoverageOverlay();
 
 public:
     EmergencyManager(RoadNetwork* net);
@@ -36,7 +47,8 @@ public:
     // Place l'hôpital et lie au noeud le plus proche
     void addHospital(Vector2 pos2D);
 
-    // Déclenche une intervention (Vector2 pour compatibilité)
+    // Déclenche une intervention (Vector2 pour compatibilité) : l'unité libre du type
+    // demandé la plus rapide à rejoindre le lieu (une recherche pour toute la flotte)
     void dispatchEmergencyVehicle(int vehicleType, Vector2 destination);
     
     // Déclenche une intervention (Vector3)
@@ -48,6 +60,13 @@ public:
     // Interaction : les voitures normales s'écartent ou s'arrêtent
     void yieldToEmergencyVehicle(std::vector<Vehicule*>& normalTraffic);
 
+    // Zone atteignable depuis l'hôpital en moins de budgetSeconds (une recherche, tous les noeuds)
+    const ReachResult& getHospitalCoverage(float budgetSeconds);
+    // Affichage de la couverture dans la scène (vert = proche, rouge = limite du budget)
+    void setCoverageOverlay(bool visible, float budgetSeconds);
+    bool isCoverageOverlayVisible() const { return coverageVisible; }
+    float getCoverageBudget() const { return coverageBudget; }
+
     // Mise à jour et rendu
     void updateAndDraw(float dt);
     void update(float deltaTime);
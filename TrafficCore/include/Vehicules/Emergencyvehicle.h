@@ -3,9 +3,11 @@
 
 #include "Vehicule.h"
 #include "Emergencymanager.h" // For EmergencyType enum
+#include "../PathService.h"
 
 class RoadNetwork;
 class Node;
+class RoadSegment;
 
 class EmergencyVehicle : public Vehicule {
 private:
@@ -15,28 +17,48 @@ private:
     bool isSirenActive;
     float sirenTimer = 0.0f;
     Node* destinationNode;
+    Node* stationNode = nullptr; // noeud où l'unité attend (parking ou dernière intervention)
+
+    // Planificateur D* Lite : recherche initiale sur un worker, puis réparé en route
+    static constexpr float REPLAN_INTERVAL = 0.1f; // 10 Hz
+    PlannerTicket pendingPlanner;
+    bool plannerPending = false;
+    bool replanFromRoute = false; // le plan attendu remplace la suite d'un itinéraire déjà suivi
+    std::shared_ptr<DStarLite> planner;
+    float replanTimer = 0.0f;
+
+    // Sans modèle externe : géométrie cuite du type (EmergencyModels), partagée et instanciée
+    bool procedural = false;
+    std::vector<Lamp> lamps; // couleurs des gyrophares de la frame
 
 public:
     EmergencyVehicle(Vector3 pos, EmergencyType type, Model model, RoadNetwork* network);
     
     void update(float deltaTime) override;
     void draw() override;
+    // Modèle externe : dessiné seul avec ses gyrophares ; géométrie cuite : instanciée, lampes comprises
+    bool isInstanceable() const override { return procedural; }
+    const Model* getLampModel() const override;
+    const std::vector<Lamp>& getLamps() const override { return lamps; }
     
     void setEmergencyMission(Node* destination);
+    // Mission dont l'itinéraire est déjà connu (répartition) : départ immédiat, planificateur en arrière-plan
+    void setEmergencyMission(Node* destination, const std::deque<RoadSegment*>& route);
     bool isOnMission() const { return isOnEmergencyMission; }
     bool hasReachedDestination() const;
     void completeMission();
     
     EmergencyType getType() const;
+    Node* getStationNode() const { return stationNode; }
+    void setStationNode(Node* node) { stationNode = node; }
 
 private:
     Node* findNearestNode() const;
-    
-    // Helpers for procedural realistic drawing
-    void drawAmbulance();
-    void drawPoliceCar();
-    void drawFireTruck();
-    void drawSiren(Vector3 localPos);
+    void applyPendingPlanner();
+    void replan();
+    void startRoute(const std::deque<RoadSegment*>& route);
+    std::deque<RoadSegment*> plannedRoute() const;
+    void updateLamps();
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,55 @@
+#ifndef MODEL_LOD_H
+#define MODEL_LOD_H
+
+#include "raylib.h"
+#include <cstdint>
+
+// Niveaux de détail d'un modèle, du plus fin au plus grossier
+enum class LodLevel : uint8_t {
+    Full = 0,       // modèle glTF complet
+    Simplified = 1, // maillages simplifiés (MeshSimplifier), mêmes matériaux
+    Box = 2         // boîte englobante de la couleur moyenne du modèle
+};
+
+// ModelLod : niveaux dérivés d'un modèle chargé, générés une fois à l'import (ModelManager).
+// Le modèle complet reste à son propriétaire ; ModelLod possède seulement les maillages simplifiés.
+struct ModelLod {
+    Model simplified = {}; // meshCount 0 : simplification sans intérêt, le niveau Simplified dessine le complet
+    BoundingBox bounds = {}; // repère du modèle, comme GetModelBoundingBox
+    Color color = GRAY;      // couleur moyenne des matériaux (diffuse x texture x sommets)
+    int fullTriangles = 0;
+    int simplifiedTriangles = 0;
+
+    // Sphère englobante d'une instance (DrawModelEx : échelle uniforme, rotation autour de Y)
+    Vector3 GetCenter(Vector3 position, float scale) const;
+    float GetRadius(float scale) const;
+};
+
+// Génère les niveaux d'un modèle (maillages envoyés au GPU si la fenêtre est ouverte)
+ModelLod BuildModelLod(const Model& model, int resolution = 12);
+void UnloadModelLod(ModelLod& lod);
+
+// LodSelector : niveau choisi d'après la hauteur à l'écran de la sphère englobante (pixels), pour la
+// caméra de la frame (SetView, avant le rendu 3D). Le passage à un niveau plus fin exige de
+// dépasser le seuil de kHysteresis : un objet à la limite ne clignote pas d'un niveau à l'autre.
+// Sans vue (tests, outils), tout est dessiné au niveau Full.
+class LodSelector {
+public:
+    static constexpr float kSimplifiedBelow = 140.0f;
+    static constexpr float kBoxBelow = 20.0f;
+    static constexpr float kHysteresis = 1.25f;
+
+    static void SetView(const Camera3D& camera, int screenHeight);
+    static void ClearView();
+    static bool HasView();
+
+    static float ScreenSize(Vector3 center, float radius);
+    static LodLevel Select(float screenSize, LodLevel current);
+    static LodLevel Select(const ModelLod& lod, Vector3 position, float scale, LodLevel current);
+};
+
+// DrawModelEx au niveau demandé (lod nullptr : modèle complet)
+void DrawModelLod(const Model& model, const ModelLod* lod, LodLevel level,
+                  Vector3 position, float rotationAngle, float scale, Color tint);
+
+#endif // MODEL_LOD_H
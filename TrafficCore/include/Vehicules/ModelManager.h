@@ -2,17 +2,93 @@
 #define MODEL_MANAGER_H
 
 #include "raylib.h"
+#include "ModelLod.h"
 #include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 #include <string>
 
+class AssetManager;
+
+// Modèle du cache de ModelManager, partagé par tous les véhicules qui l'affichent
+struct CachedModel {
+    std::string path;  // vide : modèle chargé par l'appelant (share), jamais déchargé ici
+    Model model = {};
+    BoundingBox bounds = {}; // GetModelBoundingBox, calculée une fois au chargement (ou manifeste)
+    bool hasBounds = false;
+    bool pending = false; // chargement en tâche de fond (AssetManager) pas encore terminé
+    int refs = 0;      // handles vivants
+};
+
+// ModelHandle : référence comptée vers un modèle du cache (quelques octets, copiable). Le dernier
+// handle rendu ne décharge pas le modèle : il reste en cache pour les prochains véhicules, jusqu'à
+// releaseUnused() ou unloadAll(). Un handle vide dessine la boîte de repli.
+class ModelHandle {
+public:
+    ModelHandle() = default;
+    ModelHandle(const ModelHandle& other);
+    ModelHandle(ModelHandle&& other) noexcept : entry(other.entry) { other.entry = nullptr; }
+    ModelHandle& operator=(ModelHandle other) noexcept;
+    ~ModelHandle();
+
+    const Model& get() const; // Model vide sans modèle
+    BoundingBox getBounds() const { return entry ? entry->bounds : BoundingBox{}; }
+    const std::string& getPath() const;
+    bool isLoaded() const { return get().meshCount > 0; }
+    bool isPending() const { return entry && entry->pending; } // dessiner une boîte d'attente
+    bool hasBounds() const { return entry && entry->hasBounds; } // connue avant le modèle (manifeste)
+    int useCount() const { return entry ? entry->refs : 0; }
+
+private:
+    friend class ModelManager;
+    explicit ModelHandle(CachedModel* e);
+    CachedModel* entry = nullptr;
+};
+
 class ModelManager {
 private:
-    std::map<std::string, std::vector<std::pair<std::string, Model>>> modelLibrary;
+    std::map<std::string, std::vector<ModelHandle>> modelLibrary;
+    // Cache des modèles : un chargement par fichier, quel que soit le nombre de véhicules
+    std::unordered_map<std::string, std::unique_ptr<CachedModel>> cache;
+    // Modèles chargés par l'appelant (share), et index de toutes les entrées par tableau de maillages
+    std::unordered_map<const Mesh*, std::unique_ptr<CachedModel>> shared;
+    std::unordered_map<const Mesh*, CachedModel*> byMeshes;
+    std::vector<std::unique_ptr<CachedModel>> retired; // déchargés par unloadAll(), encore référencés
+    // Niveaux de détail par modèle, clé : tableau de maillages (partagé par les copies du Model)
+    std::unordered_map<const Mesh*, ModelLod> lods;
     ModelManager() {} // Constructeur privé (Singleton)
 
+    friend class ModelHandle;
+    void release(CachedModel* entry);
+    void unloadEntry(CachedModel& entry);
+    
+    AssetManager* assets = nullptr;
+    ModelHandle acquire(const std::string& path, bool wait);
+    void setLoaded(CachedModel& entry, const Model& model);
+    void onLoaded(const std::string& path, Model model);
+
 public:
     static ModelManager& getInstance();
+    ~ModelManager();
+    
+    // Modèle d'un fichier .glb, chargé au premier appel seulement (LOD compris). Un échec de
+    // chargement est gardé en cache aussi : le fichier n'est pas relu à chaque véhicule.
+    // Avec un AssetManager, le chargement passe en tâche de fond dès que le manifeste connaît la
+    // boîte englobante (taille du véhicule) ; sinon il reste synchrone. Un modèle présent dans
+    // l'archive de l'AssetManager en est tiré directement, dans les deux cas.
+    ModelHandle acquire(const std::string& path) { return acquire(path, true); }
+    // Toujours en tâche de fond avec un AssetManager (décor) : handle vide jusqu'à la fin du chargement
+    ModelHandle acquireAsync(const std::string& path) { return acquire(path, false); }
+    // nullptr : chargements synchrones ; à retirer avant la destruction de l'AssetManager
+    void setAssetManager(AssetManager* manager) { assets = manager; }
+    // Modèle chargé ailleurs (tests, démo) : compté comme les autres, jamais déchargé par le cache.
+    // Un Model issu du cache (getRandomModel...) retrouve son entrée ; Model vide : handle vide.
+    ModelHandle share(const Model& model);
+    // Décharge les modèles du cache qu'aucun handle ne référence ; renvoie leur nombre
+    int releaseUnused();
+    int getCachedCount() const { return static_cast<int>(cache.size()); }
+    
     
     // Charge un modèle dans une catégorie (ex: "CAR", "assets/models/car1.glb").
     // Le chemin peut contenir des espaces (ex: "assets/models/Taxi (1).glb").
@@ -28,7 +104,15 @@ public:
     // Récupère un modèle par chemin (utile si vous voulez charger un modèle spécifique)
     Model getModelByPath(const std::string& path);
     
-    // Libère la mémoire GPU
+    // Niveaux de détail : générés à l'import par loadModel, ou par buildLod pour un modèle chargé
+    // ailleurs (décor, véhicule à modèle propre) ; à libérer avant UnloadModel du modèle complet
+    const ModelLod* buildLod(const Model& model);
+    const ModelLod* getLod(const Model& model) const; // nullptr si absent
+    void releaseLod(const Model& model);
+    void releaseLods();
+
+    // Libère la mémoire GPU (contexte encore ouvert). Les handles encore vivants restent valides
+    // mais vides ; leur entrée disparaît avec le dernier.
     void unloadAll();
 
     // Suppression de la copie pour le Singleton
@@ -3,17 +3,24 @@
 
 #include "Vehicule.h"
 #include "VehiculeFactory.h"
+#include "VehicleRenderer.h"
 #include <vector>
 #include <memory>
 #include <queue>
 #include <functional>
 #include <string>
 #include <map>
+#include <random>
+#include <unordered_map>
 #include "../RoadNetwork.h"
+#include "../PathService.h"
+#include "../NetworkPartition.h"
+#include "../core/ThreadPool.h"
 
 class TrafficManager {
 private:
     std::vector<std::unique_ptr<Vehicule>> vehicles;
+    VehicleRenderer renderer; // lots instanciés par modèle, reconstruits à chaque draw()
     // Optional pointer to the road network for leader assignment
     RoadNetwork* network = nullptr;
 
@@ -38,9 +45,53 @@ private:
         int startNodeId;
         int endNodeId;
         VehiculeType type;
+        RouteSetTicket ticket;                   // alternatives en cours de calcul sur le PathService
+        std::shared_ptr<const RouteSet> routes;  // alternatives disponibles (cache ou ticket résolu)
     };
     std::vector<NodeSpawnRequest> pendingSharedSpawns;
 
+    // Itinéraires alternatifs par couple de noeuds (ids), vidés à chaque changement de topologie.
+    // Chaque spawn tire un itinéraire (logit sur les coûts courants) au lieu de relancer un A*.
+    static constexpr int ROUTE_ALTERNATIVES = 4;
+    std::unordered_map<uint64_t, std::shared_ptr<const RouteSet>> routeSets;
+    uint64_t routeSetsVersion = 0;
+    std::mt19937 routeRng; // graine fixe : choix reproductibles d'une exécution à l'autre
+
+    // Publication périodique des temps de parcours observés vers le routage
+    static constexpr float TRAVEL_TIME_PUBLISH_INTERVAL = 1.0f;
+    float travelTimePublishTimer = 0.0f;
+
+    // --- Simulation par régions (voir NetworkPartition) ---
+    // Chaque région simule ses résidents (véhicules dont le segment engagé lui appartient) sur
+    // un worker. Pendant les phases parallèles, seules les positions de début de frame des
+    // autres véhicules sont lues ; entrées / sorties d'intersection et passages de frontière
+    // sont mis en file puis appliqués dans l'ordre des régions : résultat indépendant du découpage.
+    static constexpr int NODES_PER_REGION = 256; // découpage automatique
+    static constexpr float APPROACH_ZONE = 30.0f; // zone d'approche élargie pour former une queue
+    static constexpr float GRID_CELL = 32.0f;     // > portée de détection du véhicule devant
+    struct IntersectionOp {
+        Intersection* intersection;
+        Vehicule* vehicle;
+        bool enter;
+    };
+    struct RegionState {
+        std::vector<int> residents;                  // index dans vehicles, ordre croissant
+        std::vector<std::vector<int>> handoff;       // file par région cible (frontière)
+        std::vector<IntersectionOp> intersectionOps;
+    };
+    int requestedRegions = 0; // 0 = automatique
+    int partitionRequest = 0;
+    std::shared_ptr<const NetworkPartition> partition;
+    std::shared_ptr<const SpatialIndex> spatial;   // instantané de la frame
+    std::vector<int> intersectionOfNode;           // index de noeud -> intersection, -1 sinon
+    float maxIntersectionRadius = 0.0f;
+    std::vector<RegionState> regions;
+    std::unique_ptr<ThreadPool> workers;           // une région de moins : le thread appelant en prend une
+    std::vector<std::pair<int64_t, int>> vehicleGrid; // (cellule, index), trié
+    uint32_t nextVehicleSeed = 1;
+    uint64_t seenTopology = 0; // version du réseau au dernier update (éditions à chaud)
+    int lastHandoffCount = 0;
+
 public:
     // Optional singleton accessor for global management (keeps existing API usable)
     static TrafficManager& getInstance();
@@ -48,7 +99,8 @@ public:
     void addVehicle(std::unique_ptr<Vehicule> v);
     void removeFinishedVehicles();
     void update(float deltaTime);
-    void draw();
+    void draw(const Frustum* view = nullptr); // view : véhicules hors champ sautés
+    const VehicleRenderer& getRenderer() const { return renderer; }
     // Renvoi une référence const pour la lecture
     const std::vector<std::unique_ptr<Vehicule>>& getVehicles() const { return vehicles; }
     // Reference mutable pour modification
@@ -58,6 +110,14 @@ public:
 
     void setRoadNetwork(RoadNetwork* net) { network = net; }
 
+    // Nombre de régions simulées en parallèle : 0 = automatique (taille du réseau, coeurs
+    // disponibles), 1 = tout sur le thread appelant
+    void setRegionCount(int count);
+    int getRegionCount() const;
+    std::shared_ptr<const NetworkPartition> getPartition() const { return partition; }
+    // Véhicules passés d'une région à l'autre au dernier update
+    int getLastHandoffCount() const { return lastHandoffCount; }
+
     // Spawner API
     void addEntryPoint(const std::string& name, const Vector3& pos);
     void scheduleVehicles(VehiculeType type, int count);
@@ -73,7 +133,8 @@ public:
                   const std::function<std::vector<Vector3>(const Vector3&)>& itineraryResolver);
     bool hasPending() const;
 
-    // Spawn directly by node IDs (uses internal RoadNetwork pointer and PathFinder)
+    // Spawn by node IDs: the route is computed asynchronously by the PathService and the
+    // vehicle waits in the spawn queue until it resolves. Returns false for invalid nodes.
     bool spawnVehicleByNodeIds(int startNodeId, int endNodeId, VehiculeType type);
 
     // Proximity check: returns the vehicle ahead on the same segment (or nullptr). outDist filled with distance if found.
@@ -86,7 +147,19 @@ public:
     int getPendingCount() const;
 
 private:
-    bool internalExecuteNodeSpawn(int startNodeId, int endNodeId, VehiculeType type);
+    static uint64_t odKey(int startNodeId, int endNodeId) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(startNodeId)) << 32) | static_cast<uint32_t>(endNodeId);
+    }
+    std::shared_ptr<const RouteSet> findRouteSet(int startNodeId, int endNodeId);
+    bool internalExecuteNodeSpawn(const NodeSpawnRequest& request, const std::deque<RoadSegment*>& roadRoute);
+
+    void applyNetworkEdits();
+    void prepareRegions();
+    void runRegions(const std::function<void(int)>& task);
+    void interactRegion(int region);
+    void stepRegion(int region, float deltaTime);
+    int homeRegion(const Vehicule& v) const;
+    static int64_t gridCell(const Vector3& p, int dx, int dz);
 };
 
 #endif
@@ -0,0 +1,75 @@
+#ifndef VEHICLE_RENDERER_H
+#define VEHICLE_RENDERER_H
+
+#include "raylib.h"
+#include "geometry/Frustum.h"
+#include "ModelLod.h"
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Vehicule;
+
+// VehicleRenderer : véhicules regroupés par modèle partagé (ModelManager) et dessinés avec
+// DrawMeshInstanced, un appel par maillage du modèle quel que soit le nombre de véhicules.
+// - matrices d'instance reconstruites à chaque frame depuis l'état cinématique (comme DrawModelEx)
+// - teinte de l'instance (debugColor des véhicules sans modèle) rangée dans la dernière ligne de la
+//   matrice, toujours 0 0 0 1 pour une transformation affine, et relue par le shader d'instanciation
+// - lampes animées (gyrophares des urgences, Vehicule::getLamps) : un lot par maillage de lampe,
+//   une instance par lampe teintée de sa couleur de la frame
+// - véhicules à rendu propre et shader indisponible : draw() individuel, comme avant
+// - niveau de détail par véhicule (Vehicule::selectLod) : modèle simplifié dans son propre lot, boîte
+//   dans le lot du cube, étirée sur la boîte du modèle et teinte de sa couleur moyenne
+// - avec une vue, les véhicules hors champ (sphère de kCullRadius) ne sont ni regroupés ni dessinés
+class VehicleRenderer {
+public:
+    static constexpr float kCullRadius = 12.0f; // demi-longueur d'un bus, avec marge
+
+    VehicleRenderer() = default;
+    ~VehicleRenderer();
+
+    VehicleRenderer(const VehicleRenderer&) = delete;
+    VehicleRenderer& operator=(const VehicleRenderer&) = delete;
+
+    // Lots de la frame (sans contexte graphique)
+    void Collect(const std::vector<std::unique_ptr<Vehicule>>& vehicles, const Frustum* view = nullptr);
+    void Draw(const std::vector<std::unique_ptr<Vehicule>>& vehicles, const Frustum* view = nullptr);
+    // Véhicules possédés ailleurs (EmergencyManager)
+    void Collect(const std::vector<Vehicule*>& vehicles, const Frustum* view = nullptr);
+    void Draw(const std::vector<Vehicule*>& vehicles, const Frustum* view = nullptr);
+    void Release();
+
+    // Lot des véhicules sans modèle (cube teinté) : clé nullptr
+    struct Batch {
+        Model model = {};
+        std::vector<Matrix> transforms;
+    };
+    const std::vector<Batch>& GetBatches() const { return batches; }
+    const std::vector<Vehicule*>& GetIndividual() const { return individual; }
+    int GetInstanceCount() const;
+    int GetDrawCallCount() const; // maillages instanciés + véhicules dessinés seuls
+    const CullStats& GetCullStats() const { return stats; }
+
+    static Matrix InstanceTransform(const Vehicule& v);
+    static Matrix BoxTransform(const Vehicule& v, const ModelLod& lod); // niveau LodLevel::Box
+
+private:
+    std::vector<Batch> batches;
+    std::unordered_map<const Mesh*, size_t> batchOf;
+    std::vector<Vehicule*> individual;
+    CullStats stats;
+
+    Shader shader = {};
+    bool shaderLoaded = false;
+    bool shaderFailed = false;
+    Mesh cube = {};
+    Material cubeMaterial = {};
+    bool hasCube = false;
+
+    bool EnsureResources();
+    Batch& BatchFor(const Mesh* key, const Model& model);
+    template <class Vehicles> void CollectAll(const Vehicles& vehicles, const Frustum* view);
+    template <class Vehicles> void DrawAll(const Vehicles& vehicles, const Frustum* view);
+};
+
+#endif // VEHICLE_RENDERER_H
@@ -13,6 +13,8 @@
 #include <string>
 #include <queue>
 #include <deque> // For std::deque
+#include "ModelManager.h"
+#include <cstdint>
 
 class Vehicule {
 protected:
@@ -42,6 +44,7 @@ private:
     
     // Paramètres physiques
     float t_param = 0.0f; // Progression sur la route actuelle (0.0 à 1.0)
+    float roadTimer = 0.0f; // Temps passé sur currentRoad (attente aux feux comprise, manoeuvres exclues)
     
     // Paramètres Rond-point
     struct RoundaboutContext {
@@ -69,18 +72,35 @@ private:
 
     
 
+public:
+    // Temps réel passé sur un segment, rapporté au réseau par le TrafficManager
+    struct Traversal {
+        class RoadSegment* road;
+        float seconds;
+    };
+
+private:
+    std::vector<Traversal> pendingTraversals;
+    void recordTraversal();
+
     // Visualisation / Debug
 protected:
     Color debugColor;
-    Model model;
+    ModelHandle model; // partagé par les véhicules du même modèle (ModelManager)
     float scale;
     float yOffset = 0.0f;
-    bool ownModel = false;
+    LodLevel lodLevel = LodLevel::Full; // dernier niveau de détail dessiné (hystérésis)
     bool isFinished = false;
     bool isWaiting = false;
 
     // Leader car-following
     Vehicule* leader = nullptr;
+    Vector3 leaderPosition = {0.0f, 0.0f, 0.0f}; // figée à l'affectation : indépendante de l'ordre de mise à jour
+
+    // Tirages propres au véhicule (choix de voie) : reproductibles quel que soit le thread qui le simule
+    uint32_t randomState = 0x9E3779B9u;
+    // Région de simulation (TrafficManager), -1 = à placer
+    int region = -1;
 
     // Physique & Orientation
     float angle = 0.0f; // Radians
@@ -109,6 +129,7 @@ public:
     bool readyToRemove() const { return isFinished; }
     int getLane() const { return currentLane; }
     State getState() const { return state; }
+    float getRoadProgress() const { return t_param; }
     
     // Setters pour tuning
     void setMaxSpeed(float s) { maxSpeed = s; }
@@ -119,18 +140,52 @@ public:
         updateYOffset();
     }
     void setWaiting(bool w) { isWaiting = w; }
-    void setLeader(Vehicule* l) { leader = l; }
+    void setLeader(Vehicule* l) {
+        leader = l;
+        if (l) leaderPosition = l->getPosition();
+    }
     Vehicule* getLeader() const { return leader; }
     class RoadSegment* getCurrentRoad() const { return currentRoad; }
     class RoadSegment* getNextRoad() const { return route.empty() ? nullptr : route.front(); }
+    const std::vector<Traversal>& getPendingTraversals() const { return pendingTraversals; }
+    // Segment engagé : celui qu'on parcourt, ou celui qu'on rejoint pendant une manoeuvre
+    class RoadSegment* getCommittedRoad() const;
+    // Suite de l'itinéraire après le segment engagé (replanification en route)
+    const std::deque<class RoadSegment*>& getRemainingRoute() const { return route; }
+    void replaceRemainingRoute(const std::deque<class RoadSegment*>& remaining) { route = remaining; }
+    // Segment engagé retiré du réseau (édition à chaud) : le véhicule quitte la simulation
+    void leaveRoad();
+    void clearPendingTraversals() { pendingTraversals.clear(); }
+    void seedRandom(uint32_t seed) { randomState = seed ? seed : 0x9E3779B9u; }
+    int nextRandom(int minValue, int maxValue); // bornes incluses, comme GetRandomValue
+    int getRegion() const { return region; }
+    void setRegion(int r) { region = r; }
     
     virtual void draw();
+    // Rendu groupé par modèle (VehicleRenderer) ; false : le véhicule se dessine lui-même
+    virtual bool isInstanceable() const { return true; }
+    // Lampes animées dessinées avec le modèle (gyrophares) : un maillage commun, instancié comme les
+    // modèles, teinté de la couleur de la frame ; sans objet au niveau de détail Box
+    struct Lamp {
+        Vector3 offset; // repère du modèle
+        Color color;
+    };
+    virtual const Model* getLampModel() const { return nullptr; }
+    virtual const std::vector<Lamp>& getLamps() const;
+    const Model& getModel() const { return model.get(); }
+    const ModelHandle& getModelHandle() const { return model; }
+    float getScale() const { return scale; }
+    Color getDebugColor() const { return debugColor; }
+    float getRenderHeight() const { return 0.03f + yOffset; } // roues posées sur la chaussée
+    // Niveau de détail de la frame (LodSelector) ; Full sans modèle, sans LOD ou sans vue
+    LodLevel selectLod();
+    LodLevel getLodLevel() const { return lodLevel; }
     virtual bool isLargeVehicle() const { return false; }
     bool hasLoadedModel() const;
     void normalizeSize(float targetLength);
     void updateYOffset() {
-        if (model.meshCount > 0) {
-            BoundingBox box = GetModelBoundingBox(model);
+        if (model.hasBounds()) { // modèle chargé, ou en cours de chargement (manifeste)
+            BoundingBox box = model.getBounds();
             yOffset = -box.min.y * scale;
         } else {
             yOffset = 0.0f;
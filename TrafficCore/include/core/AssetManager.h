@@ -0,0 +1,118 @@
+#ifndef ASSETMANAGER_H
+#define ASSETMANAGER_H
+
+#include "raylib.h"
+#include "core/ModelArchive.h"
+#include "core/ThreadPool.h"
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <string>
+#include <vector>
+
+// Entrée du manifeste : un modèle .glb du dossier d'assets
+struct AssetInfo {
+    std::string name;         // nom du fichier dans le dossier
+    std::string category;     // CAR, BUS, TRUCK ou SCENERY, d'après le nom
+    uint64_t size = 0;        // taille et date du fichier lors de l'indexation
+    int64_t writeTime = 0;
+    bool hasBounds = false;   // connue après un premier chargement
+    BoundingBox bounds = {};  // GetModelBoundingBox
+};
+
+// AssetManifest : index des modèles d'un dossier (chemins, catégories, boîtes englobantes), gardé
+// dans kFileName à côté des modèles. Open() relit l'index puis ne revisite que les fichiers ajoutés,
+// retirés ou modifiés (taille, date) ; la boîte englobante permet de dimensionner et de placer un
+// objet avant que son modèle soit chargé.
+class AssetManifest {
+public:
+    static constexpr const char* kFileName = "manifest.json";
+
+    // Dossier lu et indexé ; false s'il n'existe pas
+    bool Open(const std::string& directory);
+    // Écrit l'index s'il a changé depuis Open()
+    bool Save();
+
+    // Catégorie d'un nom de fichier (mots-clés : bus, truck, car, taxi...) ; SCENERY sinon
+    static std::string Classify(const std::string& fileName);
+
+    // Entrée d'un chemin du dossier (absolu ou relatif), nullptr s'il n'est pas indexé
+    const AssetInfo* Find(const std::string& path) const;
+    // Chemins absolus d'une catégorie, par nom de fichier
+    std::vector<std::string> GetPaths(const std::string& category) const;
+    const std::vector<AssetInfo>& GetAssets() const { return assets; }
+    void SetBounds(const std::string& path, const BoundingBox& bounds);
+
+    const std::string& GetDirectory() const { return directory; }
+    int GetCount() const { return static_cast<int>(assets.size()); }
+    int GetRescanned() const { return rescanned; } // fichiers revisités par le dernier Open()
+    bool IsDirty() const { return dirty; }
+    const std::string& GetError() const { return error; }
+
+private:
+    std::string directory; // absolu
+    std::vector<AssetInfo> assets; // triés par nom
+    int rescanned = 0;
+    bool dirty = false;
+    std::string error;
+
+    bool Load(const std::string& file);
+    AssetInfo* FindMutable(const std::string& path);
+};
+
+// AssetManager : chargement des modèles en tâche de fond, pour afficher la première frame tout de suite.
+// - un thread d'E/S lit les fichiers en mémoire pendant que la simulation tourne
+// - Update(), sur le thread principal (une fois par frame), passe les fichiers lus à LoadModel : raylib
+//   analyse le glTF et envoie maillages et textures au GPU d'un seul tenant, ce qui exige le contexte
+//   OpenGL. Un modèle à la fois, tant que le budget de la frame n'est pas épuisé (au moins un par appel)
+// - le modèle est remis au callback de la demande, qui en devient propriétaire (même si le chargement
+//   a échoué : meshCount 0) ; la boîte englobante est notée dans le manifeste
+// Avec une archive (smartcity-assetpack), LoadPacked() sert directement les modèles empaquetés dont le
+// .glb n'a pas changé depuis : une recopie de la projection, sans lecture ni analyse glTF.
+class AssetManager {
+public:
+    using ReadyCallback = std::function<void(const std::string& path, Model model)>;
+    static constexpr float kFrameBudget = 0.004f; // secondes de chargement par frame
+
+    AssetManager();
+    ~AssetManager(); // demandes en attente abandonnées, sans appel des callbacks
+
+    AssetManager(const AssetManager&) = delete;
+    AssetManager& operator=(const AssetManager&) = delete;
+
+    bool OpenManifest(const std::string& directory) { return manifest.Open(directory); }
+    AssetManifest& GetManifest() { return manifest; }
+    const AssetManifest& GetManifest() const { return manifest; }
+    // Archive des modèles ; false si absente ou invalide (les .glb sont alors lus un par un)
+    bool OpenArchive(const std::string& file);
+    const ModelArchive& GetArchive() const { return archive; }
+    // Modèle d'un chemin du dossier, s'il est dans l'archive et à jour ; out appartient à l'appelant
+    bool LoadPacked(const std::string& path, Model& out);
+
+    // false si ce chemin est déjà en attente (un seul propriétaire par chargement)
+    bool Request(const std::string& path, ReadyCallback onReady);
+    // Modèles remis pendant cet appel
+    int Update(float budgetSeconds = kFrameBudget);
+    // Charge tout ce qui est en attente (outils, tests)
+    int Finish();
+
+    int GetPendingCount() const { return static_cast<int>(jobs.size()); }
+    bool IsPending(const std::string& path) const;
+
+private:
+    struct Job {
+        std::string path;
+        ReadyCallback onReady;
+        std::future<std::vector<unsigned char>> bytes;
+    };
+
+    AssetManifest manifest;
+    ModelArchive archive;
+    std::deque<Job> jobs;
+    ThreadPool io;
+
+    void Deliver(Job& job);
+};
+
+#endif // ASSETMANAGER_H
@@ -0,0 +1,13 @@
+#ifndef CELLKEY_H
+#define CELLKEY_H
+
+#include <cstdint>
+
+// Clé 64 bits d'une case de grille (x dans les 32 bits hauts, z dans les 32 bits bas). Décalage fait
+// en non signé : les coordonnées négatives sont courantes (villes centrées sur l'origine) et décaler
+// un entier signé négatif est indéfini en C++17.
+inline int64_t CellKey(int64_t x, int64_t z) {
+    return static_cast<int64_t>((static_cast<uint64_t>(x) << 32) | (static_cast<uint64_t>(z) & 0xFFFFFFFFu));
+}
+
+#endif // CELLKEY_H
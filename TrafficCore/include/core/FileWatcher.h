@@ -0,0 +1,53 @@
+#ifndef FILEWATCHER_H
+#define FILEWATCHER_H
+
+#include <chrono>
+#include <string>
+
+// FileWatcher : signale les modifications d'un fichier (éditeur, outil) sans bloquer la boucle de rendu.
+// - Linux : inotify sur le dossier parent, descripteur non bloquant lu à chaque Poll() ; le dossier
+//   plutôt que le fichier, car beaucoup d'éditeurs enregistrent dans un fichier temporaire renommé
+// - Ailleurs : date de modification comparée au plus toutes les kStatInterval secondes
+// Une rafale d'événements (écriture en plusieurs fois) n'est signalée qu'une fois retombée (kSettle).
+// Non copiable ; la surveillance est libérée par le destructeur ou Close().
+class FileWatcher {
+public:
+    static constexpr float kSettle = 0.2f;
+    static constexpr float kStatInterval = 0.5f;
+
+    FileWatcher() = default;
+    explicit FileWatcher(const std::string& path) { Watch(path); }
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // false si le dossier du fichier ne peut être surveillé (voir GetError)
+    bool Watch(const std::string& path);
+    void Close();
+    bool IsWatching() const { return watching; }
+
+    // true une fois par modification, quand le fichier ne bouge plus depuis kSettle secondes
+    bool Poll();
+    const std::string& GetError() const { return error; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::string path;
+    std::string fileName;
+    bool watching = false;
+    bool pending = false;
+    Clock::time_point lastEvent;
+    std::string error;
+#ifdef __linux__
+    int inotifyFd = -1;
+    int watchId = -1;
+#else
+    Clock::time_point lastStat;
+    long long lastWrite = 0;
+    long long ReadWriteTime() const;
+#endif
+};
+
+#endif // FILEWATCHER_H
@@ -0,0 +1,72 @@
+#ifndef JSONREADER_H
+#define JSONREADER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+enum class JsonType { Null, Bool, Number, String, Object, Array, End, Invalid };
+
+// JsonReader : lecteur JSON en flux (pull), sans copie ni allocation.
+// - Travaille directement sur le texte (typiquement un MappedFile) ; clés et chaînes sont des
+//   string_view dans ce texte, les nombres sont lus par std::from_chars
+// - L'appelant décrit la structure attendue ; chaque valeur doit être lue ou sautée (Skip) :
+//     if (r.BeginObject()) while (r.NextMember(key)) { if (key == "id") r.ReadInt(id); else r.Skip(); }
+// - Première erreur conservée avec sa position (ligne, colonne) ; ensuite tout appel renvoie false
+class JsonReader {
+public:
+    static constexpr int kMaxDepth = 256;
+
+    explicit JsonReader(std::string_view text);
+
+    // Type de la prochaine valeur (End en fin de conteneur ou de document)
+    JsonType Peek();
+
+    bool BeginObject();
+    // Clé du membre suivant (false à la fin de l'objet) ; la valeur est à lire ensuite
+    bool NextMember(std::string_view& key);
+    bool BeginArray();
+    // true si un élément suit (false à la fin du tableau)
+    bool NextElement();
+
+    bool ReadNumber(double& out);
+    bool ReadFloat(float& out);
+    bool ReadInt(int& out);
+    bool ReadBool(bool& out);
+    // Contenu brut entre guillemets : les échappements ne sont pas décodés (voir Unescape)
+    bool ReadString(std::string_view& out);
+    bool ReadNull();
+    // Saute la prochaine valeur, conteneurs compris
+    bool Skip();
+    // Vérifie qu'il ne reste que des espaces après la racine
+    bool Finish();
+
+    bool HasError() const { return failed; }
+    // "ligne L, colonne C : message"
+    std::string GetError() const;
+    size_t GetOffset() const { return pos; }
+
+    static std::string Unescape(std::string_view raw);
+
+private:
+    bool Fail(const char* message);
+    void SkipWhitespace();
+    bool Expect(char c, const char* message);
+    bool Push(bool isObject);
+    bool ScanString(std::string_view& out);
+    bool ScanNumber(std::string_view& out);
+    bool ScanLiteral(std::string_view literal);
+
+    std::string_view text;
+    size_t pos = 0;
+    bool failed = false;
+    size_t errorOffset = 0;
+    const char* errorMessage = "";
+
+    // Pile des conteneurs ouverts : premier élément encore à lire ?
+    int depth = 0;
+    bool firstInContainer[kMaxDepth];
+};
+
+#endif // JSONREADER_H
@@ -0,0 +1,43 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// MappedFile : fichier projeté en mémoire en lecture seule (mmap / MapViewOfFile).
+// Le contenu est lu directement par le parseur, sans copie ni allocation.
+// Non copiable ; la projection est libérée par le destructeur ou Close().
+class MappedFile {
+public:
+    MappedFile() = default;
+    explicit MappedFile(const std::string& path) { Open(path); }
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // false si le fichier est introuvable ou ne peut être projeté (voir GetError)
+    bool Open(const std::string& path);
+    void Close();
+
+    bool IsOpen() const { return data != nullptr || (opened && size == 0); }
+    const char* Data() const { return data; }
+    size_t Size() const { return size; }
+    std::string_view View() const { return std::string_view(data ? data : "", size); }
+    const std::string& GetError() const { return error; }
+
+private:
+    const char* data = nullptr;
+    size_t size = 0;
+    bool opened = false; // fichier vide : ouvert mais rien à projeter
+    std::string error;
+#ifdef _WIN32
+    void* fileHandle = nullptr;
+    void* mappingHandle = nullptr;
+#endif
+};
+
+#endif // MAPPEDFILE_H
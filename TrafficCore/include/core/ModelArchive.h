@@ -0,0 +1,80 @@
+#ifndef MODELARCHIVE_H
+#define MODELARCHIVE_H
+
+#include "raylib.h"
+#include "core/MappedFile.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// ModelArchive : les modèles du dossier d'assets regroupés en un seul fichier (.scpak), produit par
+// smartcity-assetpack. Même disposition que les cartes compilées (MapBinary) : en-tête fixe, table
+// des sections, puis tableaux d'enregistrements alignés sur 16 octets :
+// - index des modèles (nom du .glb, taille et date du fichier source, boîte englobante)
+// - maillages rangés comme UploadMesh les envoie : positions et normales float3, coordonnées de
+//   texture float2, couleurs RGBA8, indices 16 bits, chaque tableau aligné
+// - matériaux : couleur diffuse et texture de base en pixels RGBA8
+// Le chargement projette le fichier (MappedFile), recopie les tableaux et les envoie au GPU, sans
+// analyse glTF. Géométrie statique seulement : squelettes et animations ne sont pas conservés.
+class ModelArchive {
+public:
+    static constexpr char kMagic[8] = {'S', 'C', 'P', 'A', 'K', 0, 0, 0};
+    static constexpr uint32_t kVersion = 1;
+    static constexpr const char* kFileName = "models.scpak"; // dans le dossier des modèles
+
+    // Modèle à empaqueter : nom du fichier dans le dossier, modèle chargé, taille et date du fichier
+    struct Source {
+        std::string name;
+        const Model* model = nullptr;
+        uint64_t size = 0;
+        int64_t writeTime = 0;
+    };
+
+    // Textures relues depuis le GPU : fenêtre ouverte, sinon seule la couleur diffuse est gardée
+    static bool Write(const std::vector<Source>& models, const std::string& path, std::string* error = nullptr);
+    static std::string Serialize(const std::vector<Source>& models);
+
+    // Projette et valide l'archive ; false si absente ou invalide (voir GetError)
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return file.IsOpen() && !models.empty(); }
+
+    int GetCount() const { return static_cast<int>(models.size()); }
+    const std::string& GetError() const { return error; }
+    // Index du modèle d'un nom de fichier, -1 s'il n'est pas dans l'archive
+    int Find(const std::string& name) const;
+    const std::string& GetName(int index) const { return models[index].name; }
+    BoundingBox GetBounds(int index) const { return models[index].bounds; }
+    // Faux si le fichier source a changé (taille, date) depuis l'empaquetage
+    bool IsCurrent(int index, uint64_t size, int64_t writeTime) const;
+
+    // Modèle reconstruit depuis l'archive, à libérer par UnloadModel ; maillages et textures envoyés
+    // au GPU si la fenêtre est ouverte (sinon données CPU seulement). Model vide si l'index est invalide.
+    Model Load(int index) const;
+
+private:
+    struct Entry {
+        std::string name;
+        uint64_t size = 0;
+        int64_t writeTime = 0;
+        BoundingBox bounds = {};
+        uint32_t firstMesh = 0, meshCount = 0;
+        uint32_t firstMaterial = 0, materialCount = 0;
+    };
+    struct Section {
+        uint64_t offset = 0;
+        uint64_t count = 0;
+    };
+
+    MappedFile file;
+    std::vector<Entry> models;
+    std::unordered_map<std::string, int> byName;
+    Section meshes, materials, data; // sections lues à la demande par Load()
+    std::string error;
+
+    bool Index(std::string_view bytes);
+};
+
+#endif // MODELARCHIVE_H
@@ -0,0 +1,52 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// ThreadPool : nombre fixe de workers qui dépilent une file FIFO de tâches.
+// Submit() renvoie un std::future ; le destructeur termine les tâches déjà en file puis joint les threads.
+class ThreadPool {
+public:
+    // 0 -> hardware_concurrency() - 1 (au moins 1), le thread principal garde un coeur
+    explicit ThreadPool(unsigned threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <class F>
+    std::future<std::invoke_result_t<F>> Submit(F&& task);
+
+    unsigned GetThreadCount() const { return static_cast<unsigned>(workers.size()); }
+    size_t GetQueuedCount() const;
+
+private:
+    void Enqueue(std::function<void()> job);
+    void WorkerLoop();
+
+    std::vector<std::thread> workers;
+    std::deque<std::function<void()>> jobs;
+    mutable std::mutex mutex;
+    std::condition_variable wakeUp;
+    bool stopping = false;
+};
+
+template <class F>
+std::future<std::invoke_result_t<F>> ThreadPool::Submit(F&& task) {
+    using R = std::invoke_result_t<F>;
+    // packaged_task n'est pas copiable : on le partage pour le ranger dans un std::function
+    auto packaged = std::make_shared<std::packaged_task<R()>>(std::forward<F>(task));
+    std::future<R> result = packaged->get_future();
+    Enqueue([packaged]() { (*packaged)(); });
+    return result;
+}
+
+#endif // THREADPOOL_H
@@ -0,0 +1,46 @@
+#ifndef XMLREADER_H
+#define XMLREADER_H
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+enum class XmlEvent { StartElement, EndElement, End, Invalid };
+
+// XmlReader : lecteur XML en flux (pull) pour les gros fichiers de données (OSM...).
+// - Travaille directement sur le texte (typiquement un MappedFile), sans copie ni allocation
+// - Ne rend que les balises : le texte entre balises, commentaires, déclarations <?...?> et
+//   <!...> sont sautés ; les attributs sont lus à la demande (Attribute), valeurs brutes
+// - Un élément auto-fermant (<nd ref="1"/>) donne StartElement avec IsSelfClosing(), sans EndElement
+// - Pas de validation de l'imbrication : l'appelant suit la structure qu'il attend
+class XmlReader {
+public:
+    explicit XmlReader(std::string_view text);
+
+    // Avance jusqu'à la balise suivante ; End en fin de document, Invalid si balise mal formée
+    XmlEvent Next();
+
+    std::string_view Name() const { return name; }
+    bool IsSelfClosing() const { return selfClosing; }
+    // Valeur brute de l'attribut (entités non décodées) ; false s'il est absent
+    bool Attribute(std::string_view key, std::string_view& value) const;
+
+    bool HasError() const { return failed; }
+    // "ligne L, colonne C : message"
+    std::string GetError() const;
+    size_t GetOffset() const { return pos; }
+
+private:
+    XmlEvent Fail(const char* message);
+
+    std::string_view text;
+    size_t pos = 0;
+    std::string_view name;
+    std::string_view attributes; // texte entre le nom et la fin de balise
+    bool selfClosing = false;
+    bool failed = false;
+    size_t errorOffset = 0;
+    const char* errorMessage = "";
+};
+
+#endif // XMLREADER_H
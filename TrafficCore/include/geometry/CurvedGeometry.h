@@ -10,12 +10,12 @@ private:
     int segments;
     
     Vector3 CalculateBezierPoint(float t) const;
-    void DrawCurvedSurface() const;
-    void DrawCenterLine() const;  // Nouvelle méthode
+    void BakeCurvedSurface(RoadMeshBuilder& out, const std::vector<Vector3>& curvePoints) const;
+    void BakeCenterLine(RoadMeshBuilder& out, const std::vector<Vector3>& curvePoints) const;
     
 public:
     CurvedGeometry(Vector3 start, Vector3 control1, Vector3 control2, Vector3 end, float width);
-    void Draw() const override;
+    void Bake(RoadMeshBuilder& out) const override;
     std::vector<Vector3> GetPoints() const override;
     Vector3 GetCenter() const override;
     float GetWidth() const override { return width; }
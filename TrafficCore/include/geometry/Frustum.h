@@ -0,0 +1,48 @@
+#ifndef FRUSTUM_H
+#define FRUSTUM_H
+
+#include "raylib.h"
+
+// Compteurs de culling d'une catégorie d'objets, remis à zéro à chaque frame
+struct CullStats {
+    int drawn = 0;
+    int frustumCulled = 0;  // hors du champ de la caméra
+    int distanceCulled = 0; // au-delà de la distance de coupure (petits objets)
+
+    int GetCulled() const { return frustumCulled + distanceCulled; }
+    void Reset() { *this = CullStats(); }
+};
+
+// Frustum : pyramide de vue d'une Camera3D (perspective ou orthographique), six plans tournés vers
+// l'intérieur, construits depuis la base de la caméra comme BeginMode3D (mêmes plans proche et
+// lointain que rlgl). Les tests sont conservatifs : un objet à cheval sur un plan est gardé.
+class Frustum {
+public:
+    static constexpr float kNearPlane = 0.01f;  // RL_CULL_DISTANCE_NEAR
+    static constexpr float kFarPlane = 1000.0f; // RL_CULL_DISTANCE_FAR
+
+    // aspect : largeur / hauteur de la fenêtre de rendu
+    static Frustum FromCamera(const Camera3D& camera, float aspect,
+                              float nearPlane = kNearPlane, float farPlane = kFarPlane);
+
+    bool IntersectsSphere(Vector3 center, float radius) const;
+    bool IntersectsBox(const BoundingBox& box) const;
+    Vector3 GetOrigin() const { return origin; }
+    // Distance de la caméra au point le plus proche de la boîte (0 si elle la contient)
+    float DistanceTo(const BoundingBox& box) const;
+
+private:
+    struct Plane {
+        Vector3 normal; // vers l'intérieur
+        float distance; // point p à l'intérieur si normal . p + distance >= 0
+    };
+    Plane planes[6] = {};
+    Vector3 origin = {0.0f, 0.0f, 0.0f};
+
+    void SetPlane(int index, Vector3 normal, Vector3 point);
+};
+
+// Boîte englobante alignée sur les axes d'une boîte transformée (les 8 coins)
+BoundingBox TransformBounds(const BoundingBox& box, Matrix transform);
+
+#endif // FRUSTUM_H
@@ -0,0 +1,49 @@
+#ifndef INSTANCEBATCH_H
+#define INSTANCEBATCH_H
+
+#include "raylib.h"
+#include <vector>
+
+// InstanceBatch : instances d'objets immobiles (décor, mobilier des carrefours) dont les matrices sont
+// envoyées une seule fois au GPU, dans un tampon de sommets persistant ; chaque Draw() dessine un
+// maillage pour toutes les instances (comme DrawMeshInstanced, sans renvoyer les matrices).
+// - couleur par instance facultative (4 octets), seul attribut mis à jour d'une frame à l'autre, et
+//   seulement si elle a changé ; sans couleurs, les instances prennent la couleur du matériau
+// - shader d'instanciation partagé (GLSL 330), chargé au premier besoin : IsAvailable() false sans
+//   contexte OpenGL 3.3, l'appelant garde alors son rendu individuel
+// Les tampons GPU sont libérés par Release() ou le destructeur (si la fenêtre est encore ouverte).
+class InstanceBatch {
+public:
+    InstanceBatch() = default;
+    ~InstanceBatch();
+    InstanceBatch(InstanceBatch&& other) noexcept;
+    InstanceBatch& operator=(InstanceBatch&& other) noexcept;
+    InstanceBatch(const InstanceBatch&) = delete;
+    InstanceBatch& operator=(const InstanceBatch&) = delete;
+
+    void SetTransforms(std::vector<Matrix> instanceTransforms);
+    void SetColors(const std::vector<Color>& instanceColors); // une par instance
+    const std::vector<Matrix>& GetTransforms() const { return transforms; }
+    const std::vector<Color>& GetColors() const { return colors; }
+    int GetCount() const { return static_cast<int>(transforms.size()); }
+
+    // Maillage déjà envoyé au GPU ; texture diffuse et couleur du matériau conservées
+    bool Draw(const Mesh& mesh, const Material& material);
+    void Release();
+
+    static bool IsAvailable();
+    static void ReleaseShader(); // avant CloseWindow()
+
+private:
+    std::vector<Matrix> transforms;
+    std::vector<Color> colors;
+    unsigned int transformVbo = 0;
+    unsigned int colorVbo = 0;
+    bool transformsDirty = false;
+    bool colorsDirty = false;
+    int colorCapacity = 0; // instances allouées dans colorVbo
+
+    void Upload();
+};
+
+#endif // INSTANCEBATCH_H
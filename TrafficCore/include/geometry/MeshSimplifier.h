@@ -0,0 +1,22 @@
+#ifndef MESHSIMPLIFIER_H
+#define MESHSIMPLIFIER_H
+
+#include "raylib.h"
+
+// MeshSimplifier : version allégée d'un maillage par regroupement de sommets sur une grille
+// (vertex clustering) : les sommets d'une même case fusionnent en leur barycentre, les triangles
+// devenus dégénérés ou doublons disparaissent. Sans topologie ni quadriques, mais linéaire et sûr
+// sur les glTF quelconques ; suffisant pour des objets vus de loin, où seule la silhouette compte.
+// - resolution : nombre de cases sur la plus grande dimension de la boîte englobante
+// - normales moyennées, coordonnées de texture et couleurs du premier sommet de chaque case
+// - sortie indexée (unsigned short, comme raylib) tant qu'il reste moins de 65536 sommets
+class MeshSimplifier {
+public:
+    static constexpr int kDefaultResolution = 12;
+
+    // Maillage CPU (pas encore envoyé au GPU), vide (vertexCount 0) si rien ne subsiste ou si la
+    // source n'a plus ses sommets côté CPU
+    static Mesh Simplify(const Mesh& source, int resolution = kDefaultResolution);
+};
+
+#endif // MESHSIMPLIFIER_H
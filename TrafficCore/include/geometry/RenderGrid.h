@@ -0,0 +1,44 @@
+#ifndef RENDERGRID_H
+#define RENDERGRID_H
+
+#include "geometry/Frustum.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// RenderGrid : objets statiques du décor (modèles, bâtiments, végétation) rangés par case de
+// kCellSize unités selon le centre de leur boîte englobante. Query() écarte d'abord les cases
+// entières hors du champ, puis teste chaque objet restant ; un objet peut porter une distance de
+// coupure (arbres, plantes, mobilier urbain), inutile à dessiner quand il ne fait que quelques pixels.
+// Les identifiants sont les rangs d'ajout ; l'appelant garde ce qu'il faut pour dessiner.
+class RenderGrid {
+public:
+    static constexpr float kCellSize = 256.0f;
+
+    // maxDistance <= 0 : toujours dessiné s'il est dans le champ
+    int Add(const BoundingBox& bounds, float maxDistance = 0.0f);
+    void Clear();
+
+    // Objets à dessiner, par identifiant croissant ; compteurs de la requête dans GetStats()
+    void Query(const Frustum& view, std::vector<int>& visible);
+    const CullStats& GetStats() const { return stats; }
+    int GetCount() const { return static_cast<int>(items.size()); }
+    int GetCellCount() const { return static_cast<int>(cells.size()); }
+
+private:
+    struct Item {
+        BoundingBox bounds;
+        float maxDistance;
+    };
+    struct Cell {
+        BoundingBox bounds;
+        float maxDistance = 0.0f; // plus grande coupure de la case, 0 si un objet n'en a pas
+        std::vector<int> items;
+    };
+
+    std::vector<Item> items;
+    std::unordered_map<int64_t, Cell> cells;
+    CullStats stats;
+};
+
+#endif // RENDERGRID_H
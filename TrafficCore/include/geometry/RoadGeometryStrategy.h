@@ -4,11 +4,14 @@
 #include "raylib.h"
 #include <vector>
 
+class RoadMeshBuilder;
+
 // Design Pattern: Strategy - Interface de base pour toutes les géométries
 class RoadGeometryStrategy {
 public:
     virtual ~RoadGeometryStrategy() = default;
-    virtual void Draw() const = 0;
+    // Surface et marquages ajoutés au maillage statique (une fois, puis après chaque édition)
+    virtual void Bake(RoadMeshBuilder& out) const = 0;
     virtual std::vector<Vector3> GetPoints() const = 0;
     virtual Vector3 GetCenter() const = 0;
     virtual float GetWidth() const = 0;
@@ -0,0 +1,39 @@
+#ifndef ROADMESHBUILDER_H
+#define ROADMESHBUILDER_H
+
+#include "raylib.h"
+#include <vector>
+
+// RoadMeshBuilder : triangles colorés accumulés côté CPU (routes, marquages, trottoirs, ronds-points),
+// envoyés ensuite au GPU en un seul Mesh (voir RoadMesh). Les faces horizontales sont orientées vers
+// le haut quel que soit l'ordre des sommets ; les lignes deviennent de fins rubans posés à plat.
+// Boîtes et cylindres servent aussi aux véhicules procéduraux cuits une fois (EmergencyModels).
+class RoadMeshBuilder {
+public:
+    static constexpr float kLineWidth = 0.3f;
+
+    void Triangle(Vector3 a, Vector3 b, Vector3 c, Color color);
+    // Coins dans l'ordre du pourtour (comme RL_QUADS)
+    void Quad(Vector3 a, Vector3 b, Vector3 c, Vector3 d, Color color);
+    void Line(Vector3 a, Vector3 b, Color color, float width = kLineWidth);
+    // Cylindre plein posé sur base (dessus et flanc, comme DrawCylinder)
+    void Cylinder(Vector3 base, float radius, float height, int slices, Color color);
+    // Boîte pleine centrée sur center, faces tournées vers l'extérieur (comme DrawCube)
+    void Box(Vector3 center, Vector3 size, Color color);
+
+    void Clear();
+    bool IsEmpty() const { return colors.empty(); }
+    int GetVertexCount() const { return static_cast<int>(colors.size() / 4); }
+    BoundingBox GetBounds() const; // boîte vide (min > max) sans sommet
+    const std::vector<float>& GetVertices() const { return vertices; } // x, y, z par sommet
+    const std::vector<unsigned char>& GetColors() const { return colors; } // r, g, b, a par sommet
+
+private:
+    std::vector<float> vertices;
+    std::vector<unsigned char> colors;
+
+    void Vertex(Vector3 p, Color color);
+    void Oriented(Vector3 a, Vector3 b, Vector3 c, Vector3 facing, Color color);
+};
+
+#endif // ROADMESHBUILDER_H
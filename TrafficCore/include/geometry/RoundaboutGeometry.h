@@ -13,15 +13,15 @@ private:
     float roadWidth;
     int segments;
     
-    void DrawRoadCircle() const;
-    void DrawCentralIsland() const;
-    void DrawRoadMarkings() const;
-    void DrawDirectionalArrows() const;
+    void BakeRoadCircle(RoadMeshBuilder& out) const;
+    void BakeCentralIsland(RoadMeshBuilder& out) const;
+    void BakeRoadMarkings(RoadMeshBuilder& out) const;
+    void BakeDirectionalArrows(RoadMeshBuilder& out) const;
 
 public:
     RoundaboutGeometry(Vector3 center, float radius, float roadWidth);
     
-    void Draw() const override;
+    void Bake(RoadMeshBuilder& out) const override;
     std::vector<Vector3> GetPoints() const override;
     Vector3 GetCenter() const override { return center; }
     float GetWidth() const override { return roadWidth; }
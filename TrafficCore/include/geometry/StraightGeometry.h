@@ -10,13 +10,13 @@ private:
     float width;
     int lanes;
     
-    void DrawRoadSurface() const;
-    void DrawLaneMarkings() const;
-    void DrawEdgeLines() const;  // Nouvelle méthode
+    void BakeRoadSurface(RoadMeshBuilder& out) const;
+    void BakeLaneMarkings(RoadMeshBuilder& out) const;
+    void BakeEdgeLines(RoadMeshBuilder& out) const;
     
 public:
     StraightGeometry(Vector3 start, Vector3 end, float width, int lanes);
-    void Draw() const override;
+    void Bake(RoadMeshBuilder& out) const override;
     std::vector<Vector3> GetPoints() const override;
     Vector3 GetCenter() const override;
     float GetWidth() const override { return width; }
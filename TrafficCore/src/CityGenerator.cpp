@@ -0,0 +1,289 @@
+#include "CityGenerator.h"
+#include "RoadNetwork.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <numeric>
+#include <random>
+
+namespace {
+
+// Rue non orientée entre deux index de noeuds
+struct Street {
+    int a, b;
+    int lanes;
+};
+
+// Tirages maison sur les sorties brutes de mt19937 (normalisées par le standard) :
+// les distributions de la bibliothèque standard varient d'une implémentation à l'autre
+float Unit(std::mt19937& rng) {
+    return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+}
+
+int Below(std::mt19937& rng, int n) {
+    return static_cast<int>(Unit(rng) * n) % n;
+}
+
+template <class T>
+void Shuffle(std::vector<T>& v, std::mt19937& rng) {
+    for (int i = static_cast<int>(v.size()) - 1; i > 0; --i) {
+        std::swap(v[i], v[Below(rng, i + 1)]);
+    }
+}
+
+int ArterialPeriod(float ratio) {
+    return ratio <= 0.0f ? 0 : std::max(1, static_cast<int>(std::lround(1.0f / ratio)));
+}
+
+int StreetLanes(bool arterial) { return arterial ? 4 : 2; }
+
+void AddPoint(CityPlan& plan, float x, float z) {
+    plan.nodes.push_back({static_cast<int>(plan.nodes.size()) + 1, x, z, SIMPLE_INTERSECTION, 0.0f});
+}
+
+void GenerateGrid(const CityParams& p, CityPlan& plan, std::vector<Street>& streets) {
+    const int side = std::max(2, static_cast<int>(std::lround(std::sqrt(static_cast<double>(p.nodeCount)))));
+    const float half = (side - 1) * p.spacing * 0.5f;
+    const int period = ArterialPeriod(p.arterialRatio);
+
+    plan.nodes.reserve(static_cast<size_t>(side) * side);
+    for (int j = 0; j < side; ++j)
+        for (int i = 0; i < side; ++i) AddPoint(plan, i * p.spacing - half, j * p.spacing - half);
+
+    // Artères : une rangée / colonne sur period, en 4 voies sur toute la longueur
+    for (int j = 0; j < side; ++j) {
+        for (int i = 0; i < side; ++i) {
+            int n = j * side + i;
+            if (i + 1 < side) streets.push_back({n, n + 1, StreetLanes(period && j % period == 0)});
+            if (j + 1 < side) streets.push_back({n, n + side, StreetLanes(period && i % period == 0)});
+        }
+    }
+}
+
+void GenerateRadial(const CityParams& p, CityPlan& plan, std::vector<Street>& streets) {
+    const int target = std::max(p.nodeCount, 7);
+    const int baseSpokes = 6;
+    const int period = ArterialPeriod(p.arterialRatio);
+
+    AddPoint(plan, 0.0f, 0.0f);
+    plan.nodes[0].type = ROUNDABOUT; // place centrale
+
+    int previousFirst = 0, previousSpokes = 1;
+    int spokes = baseSpokes;
+    for (int ring = 1; static_cast<int>(plan.nodes.size()) < target; ++ring) {
+        const float radius = ring * p.spacing;
+        // Rayons doublés dès que l'arc entre deux rayons dépasse 1,5 espacement
+        while (2.0f * PI * radius / spokes > 1.5f * p.spacing) spokes *= 2;
+
+        const int first = static_cast<int>(plan.nodes.size());
+        const int count = std::min(spokes, target - first); // dernier anneau éventuellement partiel
+        for (int k = 0; k < count; ++k) {
+            float a = 2.0f * PI * k / spokes;
+            AddPoint(plan, radius * cosf(a), radius * sinf(a));
+        }
+
+        const bool ringArterial = period && ring % period == 0;
+        for (int k = 0; k < count; ++k) {
+            if (k + 1 < count) streets.push_back({first + k, first + k + 1, StreetLanes(ringArterial)});
+            else if (count == spokes) streets.push_back({first + k, first, StreetLanes(ringArterial)});
+
+            // Rayon vers l'anneau précédent quand l'angle y existe ; les 6 rayons d'origine sont des artères
+            const int ratio = spokes / previousSpokes;
+            if (ring == 1) {
+                streets.push_back({first + k, 0, StreetLanes(true)});
+            } else if (k % ratio == 0) {
+                bool primary = k % (spokes / baseSpokes) == 0;
+                streets.push_back({first + k, previousFirst + k / ratio, StreetLanes(primary)});
+            }
+        }
+        previousFirst = first;
+        previousSpokes = spokes;
+    }
+}
+
+int FindRoot(std::vector<int>& parent, int x) {
+    while (parent[x] != x) {
+        parent[x] = parent[parent[x]];
+        x = parent[x];
+    }
+    return x;
+}
+
+void GenerateRandomPlanar(const CityParams& p, CityPlan& plan, std::vector<Street>& streets, std::mt19937& rng) {
+    const int side = std::max(2, static_cast<int>(std::lround(std::sqrt(static_cast<double>(p.nodeCount)))));
+    const float half = (side - 1) * p.spacing * 0.5f;
+
+    // Un point par cellule, décalé d'au plus un quart d'espacement : les quadrilatères restent
+    // convexes, donc côtés et une diagonale par cellule ne se croisent jamais (graphe planaire)
+    plan.nodes.reserve(static_cast<size_t>(side) * side);
+    for (int j = 0; j < side; ++j) {
+        for (int i = 0; i < side; ++i) {
+            float jx = (Unit(rng) - 0.5f) * 0.5f * p.spacing;
+            float jz = (Unit(rng) - 0.5f) * 0.5f * p.spacing;
+            AddPoint(plan, i * p.spacing - half + jx, j * p.spacing - half + jz);
+        }
+    }
+
+    std::vector<Street> candidates;
+    for (int j = 0; j < side; ++j) {
+        for (int i = 0; i < side; ++i) {
+            int n = j * side + i;
+            if (i + 1 < side) candidates.push_back({n, n + 1, 0});
+            if (j + 1 < side) candidates.push_back({n, n + side, 0});
+            if (i + 1 < side && j + 1 < side && Unit(rng) < 0.35f) {
+                if (Unit(rng) < 0.5f) candidates.push_back({n, n + side + 1, 0});
+                else candidates.push_back({n + 1, n + side, 0});
+            }
+        }
+    }
+    for (Street& s : candidates) s.lanes = StreetLanes(Unit(rng) < p.arterialRatio);
+
+    // Kruskal sur un ordre aléatoire : arbre couvrant (ville connexe) + 55 % des autres rues
+    Shuffle(candidates, rng);
+    std::vector<int> parent(plan.nodes.size());
+    std::iota(parent.begin(), parent.end(), 0);
+    for (const Street& s : candidates) {
+        int ra = FindRoot(parent, s.a);
+        int rb = FindRoot(parent, s.b);
+        if (ra != rb) {
+            parent[ra] = rb;
+            streets.push_back(s);
+        } else if (Unit(rng) < 0.55f) {
+            streets.push_back(s);
+        }
+    }
+}
+
+// Types et rayons selon le degré, puis routes orientées et noeuds de flux
+void Finalize(const CityParams& p, CityPlan& plan, const std::vector<Street>& streets, std::mt19937& rng) {
+    const int nodeCount = static_cast<int>(plan.nodes.size());
+    std::vector<int> degree(nodeCount, 0);
+    for (const Street& s : streets) {
+        degree[s.a]++;
+        degree[s.b]++;
+    }
+
+    const float roundaboutRadius = std::clamp(p.spacing * 0.15f, 30.0f, 60.0f);
+    for (int i = 0; i < nodeCount; ++i) {
+        CityPlan::PlanNode& n = plan.nodes[i];
+        if (n.type != ROUNDABOUT && degree[i] >= 3) {
+            float u = Unit(rng);
+            if (u < p.roundaboutRatio) n.type = ROUNDABOUT;
+            else if (u < p.roundaboutRatio + p.trafficLightRatio) n.type = TRAFFIC_LIGHT;
+        }
+        n.radius = (n.type == ROUNDABOUT) ? roundaboutRadius : (n.type == TRAFFIC_LIGHT) ? 20.0f : 15.0f;
+    }
+
+    plan.roads.reserve(streets.size() * 2);
+    for (const Street& s : streets) {
+        bool curved = plan.nodes[s.a].type == ROUNDABOUT || plan.nodes[s.b].type == ROUNDABOUT;
+        plan.roads.push_back({plan.nodes[s.a].id, plan.nodes[s.b].id, s.lanes, curved, true});
+        plan.roads.push_back({plan.nodes[s.b].id, plan.nodes[s.a].id, s.lanes, curved, false});
+    }
+
+    // Flux : le noeud le plus éloigné du centre dans chaque secteur angulaire
+    if (p.spawnCount <= 0 || nodeCount == 0) return;
+    float cx = 0.0f, cz = 0.0f;
+    for (const auto& n : plan.nodes) {
+        cx += n.x;
+        cz += n.z;
+    }
+    cx /= nodeCount;
+    cz /= nodeCount;
+    std::vector<int> best(p.spawnCount, -1);
+    std::vector<float> bestDist(p.spawnCount, -1.0f);
+    for (int i = 0; i < nodeCount; ++i) {
+        float dx = plan.nodes[i].x - cx, dz = plan.nodes[i].z - cz;
+        float d = dx * dx + dz * dz;
+        int sector = static_cast<int>((atan2f(dz, dx) + PI) / (2.0f * PI) * p.spawnCount);
+        sector = std::clamp(sector, 0, p.spawnCount - 1);
+        if (d > bestDist[sector]) {
+            bestDist[sector] = d;
+            best[sector] = i;
+        }
+    }
+    for (int i : best) {
+        if (i >= 0) plan.spawnNodeIds.push_back(plan.nodes[i].id);
+    }
+}
+
+const char* TypeName(NodeType type) {
+    switch (type) {
+        case ROUNDABOUT: return "roundabout";
+        case TRAFFIC_LIGHT: return "traffic_light";
+        default: return "simple";
+    }
+}
+
+} // namespace
+
+int CityPlan::CountNodes(NodeType type) const {
+    return static_cast<int>(std::count_if(nodes.begin(), nodes.end(),
+                                          [type](const PlanNode& n) { return n.type == type; }));
+}
+
+CityPlan CityGenerator::Generate(const CityParams& params) {
+    CityParams p = params;
+    p.nodeCount = std::clamp(p.nodeCount, CityParams::kMinNodes, CityParams::kMaxNodes);
+
+    CityPlan plan;
+    std::vector<Street> streets;
+    std::mt19937 rng(p.seed);
+    switch (p.layout) {
+        case CityParams::Layout::Grid: GenerateGrid(p, plan, streets); break;
+        case CityParams::Layout::Radial: GenerateRadial(p, plan, streets); break;
+        case CityParams::Layout::RandomPlanar: GenerateRandomPlanar(p, plan, streets, rng); break;
+    }
+    Finalize(p, plan, streets, rng);
+    return plan;
+}
+
+bool CityGenerator::Build(const CityPlan& plan, RoadNetwork& outNetwork) {
+    if (outNetwork.GetNodeCount() != 0) return false;
+    for (const auto& n : plan.nodes) {
+        // Même hauteur que les noeuds lus par MapLoader
+        if (!outNetwork.AddNodeWithId(n.id, {n.x, 0.2f, n.z}, n.type, n.radius)) return false;
+    }
+    for (const auto& r : plan.roads) {
+        RoadSegment* seg = outNetwork.AddRoadSegment(outNetwork.FindNodeById(r.from), outNetwork.FindNodeById(r.to),
+                                                     r.lanes, r.curved);
+        if (!seg) return false;
+        seg->SetVisible(r.visible);
+    }
+    outNetwork.SetSpawnNodeIds(plan.spawnNodeIds);
+    return true;
+}
+
+bool CityGenerator::WriteJson(const CityPlan& plan, const std::string& path, std::string* error) {
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        if (error) *error = "ecriture impossible : " + path;
+        return false;
+    }
+    out.precision(9); // positions au centimètre même à 1M noeuds
+    out << "{\n  \"topology\": {\n    \"nodes\": [\n";
+    for (size_t i = 0; i < plan.nodes.size(); ++i) {
+        const auto& n = plan.nodes[i];
+        out << "      {\"id\": " << n.id << ", \"position\": [" << n.x << ", " << n.z << "], \"type\": \""
+            << TypeName(n.type) << "\", \"radius\": " << n.radius << "}" << (i + 1 < plan.nodes.size() ? ",\n" : "\n");
+    }
+    out << "    ],\n    \"routes\": [\n";
+    for (size_t i = 0; i < plan.roads.size(); ++i) {
+        const auto& r = plan.roads[i];
+        out << "      {\"from\": " << r.from << ", \"to\": " << r.to << ", \"lanes\": " << r.lanes;
+        if (r.curved) out << ", \"curved\": true";
+        if (!r.visible) out << ", \"visible\": false";
+        out << "}" << (i + 1 < plan.roads.size() ? ",\n" : "\n");
+    }
+    out << "    ]\n  },\n  \"scenario\": {\n    \"spawn_points\": [";
+    for (size_t i = 0; i < plan.spawnNodeIds.size(); ++i) {
+        out << (i ? ", " : "") << plan.spawnNodeIds[i];
+    }
+    out << "]\n  }\n}\n";
+
+    if (!out) {
+        if (error) *error = "ecriture incomplete : " + path;
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,220 @@
+#include "DStarLite.h"
+#include <algorithm>
+#include <limits>
+#include "raymath.h"
+
+static const float INF = std::numeric_limits<float>::infinity();
+
+DStarLite::DStarLite(std::shared_ptr<const RoutingGraph> graph, std::shared_ptr<const EdgeWeights> weights,
+                     int startNode, int goalNode)
+    : graph(std::move(graph)), weights(std::move(weights)), startNode(startNode), goalNode(goalNode) {
+    virtualStart = this->graph->GetEdgeCount();
+    start = last = virtualStart;
+    Reset();
+}
+
+void DStarLite::Reset() {
+    const int states = graph->GetEdgeCount() + 1;
+    g.assign(states, INF);
+    rhs.assign(states, INF);
+    queuedKey.assign(states, Key{INF, INF});
+    inQueue.assign(states, 0);
+    open = decltype(open)();
+    km = 0.0f;
+    last = start;
+    invSpeed = 1.0f / weights->speedBound;
+
+    // Tous les arcs qui arrivent à destination sont des buts
+    for (int i = graph->InEdgeBegin(goalNode); i < graph->InEdgeEnd(goalNode); ++i) {
+        int e = graph->InEdge(i);
+        rhs[e] = 0.0f;
+        Push(e);
+    }
+}
+
+bool DStarLite::IsGoal(int s) const {
+    return s != virtualStart && graph->EdgeTarget(s) == goalNode;
+}
+
+Vector3 DStarLite::StatePosition(int s) const {
+    return graph->GetPosition(s == virtualStart ? startNode : graph->EdgeTarget(s));
+}
+
+float DStarLite::Heuristic(int from, int to) const {
+    return Vector3Distance(StatePosition(from), StatePosition(to)) * invSpeed;
+}
+
+DStarLite::Key DStarLite::CalcKey(int s) const {
+    float m = std::min(g[s], rhs[s]);
+    return Key{m + Heuristic(start, s) + km, m};
+}
+
+float DStarLite::Cost(int s, int f) const {
+    float w = weights->seconds[graph->EdgeSegment(f)];
+    if (s == virtualStart) return w;
+    uint16_t movement = graph->GetMovement(s, f);
+    if (RoutingGraph::IsForbidden(movement)) return INF;
+    return RoutingGraph::MovementSeconds(movement) + w;
+}
+
+float DStarLite::BestSuccessor(int s, int* bestArc) const {
+    int v = (s == virtualStart) ? startNode : graph->EdgeTarget(s);
+    float best = INF;
+    if (bestArc) *bestArc = -1;
+    for (int f = graph->EdgeBegin(v); f < graph->EdgeEnd(v); ++f) {
+        float c = Cost(s, f) + g[f];
+        if (c < best) {
+            best = c;
+            if (bestArc) *bestArc = f;
+        }
+    }
+    return best;
+}
+
+template <class Fn>
+void DStarLite::ForEachPredecessor(int f, Fn&& fn) const {
+    int u = graph->EdgeSource(f);
+    for (int i = graph->InEdgeBegin(u); i < graph->InEdgeEnd(u); ++i) {
+        int e = graph->InEdge(i);
+        if (!RoutingGraph::IsForbidden(graph->GetMovement(e, f))) fn(e);
+    }
+    if (u == startNode) fn(virtualStart);
+}
+
+void DStarLite::Push(int s) {
+    queuedKey[s] = CalcKey(s);
+    inQueue[s] = 1;
+    open.push(HeapItem{queuedKey[s], s});
+}
+
+void DStarLite::UpdateVertex(int s) {
+    if (g[s] != rhs[s]) Push(s);
+    else inQueue[s] = 0; // retrait paresseux : l'entrée périmée est ignorée au dépilement
+}
+
+bool DStarLite::TopKey(Key& out) {
+    while (!open.empty()) {
+        const HeapItem& top = open.top();
+        if (inQueue[top.state] && top.key == queuedKey[top.state]) {
+            out = top.key;
+            return true;
+        }
+        open.pop();
+    }
+    out = Key{INF, INF};
+    return false;
+}
+
+bool DStarLite::ComputeShortestPath() {
+    Key top;
+    while (TopKey(top) && (top < CalcKey(start) || rhs[start] > g[start])) {
+        int u = open.top().state;
+        open.pop();
+        inQueue[u] = 0;
+        ++expanded;
+
+        Key fresh = CalcKey(u);
+        if (top < fresh) {
+            Push(u); // clé sous-estimée (départ déplacé) : on la remet à jour
+            continue;
+        }
+
+        if (g[u] > rhs[u]) {
+            // Sur-cohérent : on fige g et on propage vers les prédécesseurs
+            g[u] = rhs[u];
+            ForEachPredecessor(u, [&](int s) {
+                if (!IsGoal(s)) rhs[s] = std::min(rhs[s], Cost(s, u) + g[u]);
+                UpdateVertex(s);
+            });
+        } else {
+            // Sous-cohérent : g invalide, les prédécesseurs qui passaient par u recalculent leur rhs
+            float gOld = g[u];
+            g[u] = INF;
+            auto repair = [&](int s) {
+                if (!IsGoal(s) && (s == u || rhs[s] == Cost(s, u) + gOld)) {
+                    rhs[s] = BestSuccessor(s, nullptr);
+                }
+                UpdateVertex(s);
+            };
+            ForEachPredecessor(u, repair);
+            repair(u);
+        }
+    }
+    return HasPath();
+}
+
+void DStarLite::MoveStart(int arc) {
+    if (arc < 0 || arc >= virtualStart || arc == start) return;
+    start = arc;
+    km += Heuristic(last, start);
+    last = start;
+}
+
+void DStarLite::UpdateWeights(std::shared_ptr<const EdgeWeights> newWeights) {
+    if (!newWeights || newWeights->version == weights->version) return;
+    if (newWeights->seconds.size() != weights->seconds.size()) return; // topologie différente : au propriétaire de recréer
+
+    // Borne stable dépassée (segment allongé ou élargi) : l'heuristique ne serait plus admissible,
+    // on repart de zéro. Les estimations lissées restent sous la borne : réparation incrémentale.
+    if (newWeights->speedBound * invSpeed > 1.0f) {
+        weights = std::move(newWeights);
+        Reset();
+        return;
+    }
+
+    // Segments modifiés : journal de la publication si elle suit directement la nôtre, sinon comparaison
+    std::vector<int> changed;
+    if (newWeights->version == weights->version + 1) {
+        changed = newWeights->changed;
+    } else {
+        for (size_t i = 0; i < newWeights->seconds.size(); ++i) {
+            if (newWeights->seconds[i] != weights->seconds[i]) changed.push_back(static_cast<int>(i));
+        }
+    }
+
+    std::shared_ptr<const EdgeWeights> previous = std::move(weights);
+    weights = std::move(newWeights);
+
+    for (int segmentIndex : changed) {
+        int f = graph->ArcOfSegment(segmentIndex);
+        if (f < 0) continue;
+        float oldW = previous->seconds[segmentIndex];
+        float newW = weights->seconds[segmentIndex];
+        if (oldW == newW) continue;
+
+        ForEachPredecessor(f, [&](int s) {
+            if (IsGoal(s)) return;
+            float cNew = Cost(s, f);
+            float cOld = (s == virtualStart)
+                ? oldW
+                : RoutingGraph::MovementSeconds(graph->GetMovement(s, f)) + oldW;
+
+            if (cOld > cNew) rhs[s] = std::min(rhs[s], cNew + g[f]);
+            else if (rhs[s] == cOld + g[f]) rhs[s] = BestSuccessor(s, nullptr);
+            UpdateVertex(s);
+        });
+    }
+}
+
+bool DStarLite::HasPath() const {
+    return rhs[start] < INF;
+}
+
+float DStarLite::GetRemainingSeconds() const {
+    return rhs[start];
+}
+
+std::vector<int> DStarLite::ExtractRoute() const {
+    std::vector<int> route;
+    if (!HasPath() || IsGoal(start)) return route;
+
+    int s = start;
+    for (int guard = 0; guard < virtualStart; ++guard) {
+        int next = -1;
+        if (BestSuccessor(s, &next) == INF || next < 0) return {};
+        route.push_back(graph->EdgeSegment(next));
+        if (IsGoal(next)) return route;
+        s = next;
+    }
+    return {};
+}
@@ -2,7 +2,12 @@
 #include "Vehicules/Vehicule.h"
 
 Intersection::Intersection(Node* node) : node(node) {
+    Rebuild();
+}
+
+void Intersection::Rebuild() {
     // Si c'est un rond-point, créer sa géométrie
+    roundaboutGeometry.reset();
     if (node->GetType() == ROUNDABOUT) {
         roundaboutGeometry = std::make_unique<RoundaboutGeometry>(
             node->GetPosition(),
@@ -12,16 +17,18 @@ Intersection::Intersection(Node* node) : node(node) {
     }
 }
 
-void Intersection::Draw() const {
-    // Dessiner le rond-point si c'en est un
+void Intersection::Bake(RoadMeshBuilder& out) const {
     if (roundaboutGeometry) {
-        roundaboutGeometry->Draw();
+        roundaboutGeometry->Bake(out);
     } else {
-        // Sinon, dessiner le noeud normalement
-        node->Draw();
+        node->Bake(out);
     }
 }
 
+void Intersection::Draw() const {
+    if (!roundaboutGeometry) node->Draw();
+}
+
 bool Intersection::CanEnter(Vehicule* /*v*/) const {
     // Pour une simulation fluide, on autorise l'entrée multiple.
     // La régulation se fait par la distance de sécurité individuelle des véhicules.
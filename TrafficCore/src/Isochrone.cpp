@@ -0,0 +1,90 @@
+#include "Isochrone.h"
+#include "RoutingGraph.h"
+#include "TravelTimeTable.h"
+#include <algorithm>
+#include <limits>
+#include <queue>
+
+static const float INF = std::numeric_limits<float>::infinity();
+
+float ReachResult::SegmentCoverage(int segmentIndex) const {
+    float arrival = segmentSeconds[segmentIndex];
+    if (arrival <= budgetSeconds) return 1.0f;
+    if (arrival == INF) return 0.0f;
+    float travel = segmentTravel[segmentIndex];
+    if (travel <= 0.0f) return 0.0f;
+    return std::clamp((budgetSeconds - (arrival - travel)) / travel, 0.0f, 1.0f);
+}
+
+int ReachResult::GetReachedNodeCount() const {
+    return static_cast<int>(std::count_if(nodeSeconds.begin(), nodeSeconds.end(),
+                                          [this](float t) { return t <= budgetSeconds; }));
+}
+
+namespace {
+struct ArcItem {
+    float t;
+    int arc;
+    bool operator>(const ArcItem& o) const { return t > o.t; }
+};
+}
+
+// dist(arc) = arrivée au bout de l'arc. Un arc n'est relâché que si on y entre dans le budget :
+// son meilleur prédécesseur est alors déjà figé, donc la valeur finale est exacte même au-delà.
+ReachResult Isochrone::Compute(const RoutingGraph& graph, const EdgeWeights& weights,
+                               const std::vector<int>& sources, float budgetSeconds) {
+    ReachResult result;
+    result.topologyVersion = graph.GetVersion();
+    result.weightsVersion = weights.version;
+    result.budgetSeconds = budgetSeconds;
+    result.nodeSeconds.assign(graph.GetNodeCount(), INF);
+    result.segmentSeconds.assign(weights.seconds.size(), INF);
+    result.segmentTravel.assign(weights.seconds.size(), 0.0f);
+
+    const int m = graph.GetEdgeCount();
+    std::vector<float> dist(m, INF);
+    std::vector<char> settled(m, 0);
+    std::priority_queue<ArcItem, std::vector<ArcItem>, std::greater<ArcItem>> open;
+
+    auto relax = [&](int f, float entry) {
+        float t = entry + weights.seconds[graph.EdgeSegment(f)];
+        if (t < dist[f]) {
+            dist[f] = t;
+            open.push(ArcItem{t, f});
+        }
+    };
+
+    for (int s : sources) {
+        if (s < 0 || s >= graph.GetNodeCount()) continue;
+        result.nodeSeconds[s] = 0.0f;
+        if (budgetSeconds < 0.0f) continue;
+        for (int f = graph.EdgeBegin(s); f < graph.EdgeEnd(s); ++f) relax(f, 0.0f);
+    }
+
+    while (!open.empty()) {
+        ArcItem top = open.top();
+        open.pop();
+        if (settled[top.arc] || top.t > dist[top.arc]) continue;
+        if (top.t > budgetSeconds) break; // sortie anticipée : tout le reste est hors budget
+        settled[top.arc] = 1;
+
+        int v = graph.EdgeTarget(top.arc);
+        result.nodeSeconds[v] = std::min(result.nodeSeconds[v], top.t);
+
+        for (int f = graph.EdgeBegin(v); f < graph.EdgeEnd(v); ++f) {
+            if (settled[f]) continue;
+            uint16_t movement = graph.GetMovement(top.arc, f);
+            if (RoutingGraph::IsForbidden(movement)) continue;
+            float entry = top.t + RoutingGraph::MovementSeconds(movement);
+            if (entry <= budgetSeconds) relax(f, entry);
+        }
+    }
+
+    for (int e = 0; e < m; ++e) {
+        if (dist[e] == INF) continue;
+        int seg = graph.EdgeSegment(e);
+        result.segmentSeconds[seg] = dist[e];
+        result.segmentTravel[seg] = weights.seconds[seg];
+    }
+    return result;
+}
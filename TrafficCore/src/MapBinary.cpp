@@ -0,0 +1,514 @@
+#include "MapBinary.h"
+#include "Vehicules/VehiculeFactory.h"
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+#include <vector>
+
+constexpr char MapBinary::kMagic[8];
+
+namespace {
+
+enum SectionKind : uint32_t {
+    kNodes = 1,
+    kSegments,
+    kPoints,
+    kSidewalks,
+    kTurnRestrictions,
+    kVehicleTypes,
+    kGraphOffsets,
+    kGraphTargets,
+    kGraphSources,
+    kGraphEdgeSegments,
+    kGraphSegmentArcs,
+    kGraphInLocal,
+    kGraphInOffsets,
+    kGraphInArcs,
+    kGraphMovementOffsets,
+    kGraphMovements,
+    kSpatialLeafCounts, // noeuds, segments
+    kSpatialNodeBoxes,
+    kSpatialNodeFirst,
+    kSpatialNodeCount,
+    kSpatialNodeItems,
+    kSpatialNodeItemBoxes,
+    kSpatialSegmentBoxes,
+    kSpatialSegmentFirst,
+    kSpatialSegmentCount,
+    kSpatialSegmentItems,
+    kSpatialSegmentItemBoxes,
+    kSpatialPieces,
+    kSpawnNodes, // ids des noeuds de flux
+};
+
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr uint32_t kFlagUTurnsAllowed = 1u << 0;
+constexpr size_t kSectionAlignment = 16;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t sectionCount;
+    uint32_t flags;
+    uint64_t fileSize;
+};
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t elementSize;
+    uint64_t offset;
+    uint64_t count;
+};
+
+struct NodeRecord {
+    int32_t id;
+    int32_t type;
+    float x, y, z;
+    float radius;
+};
+
+// Points de contrôle : points[firstPoint, firstPoint + controlCount)
+struct SegmentRecord {
+    int32_t startNode; // index dans la table des noeuds
+    int32_t endNode;
+    int32_t lanes;
+    uint8_t visible;
+    uint8_t controlCount;
+    uint16_t reserved;
+    uint32_t firstPoint;
+    uint32_t firstSidewalk;
+    uint32_t sidewalkCount;
+};
+
+struct SidewalkRecord {
+    uint32_t firstPoint;
+    uint32_t pointCount;
+    float width;
+    float height;
+};
+
+struct PointRecord {
+    float x, y, z;
+};
+
+struct RestrictionRecord {
+    int32_t fromNodeId;
+    int32_t viaNodeId;
+    int32_t toNodeId;
+};
+
+struct VehicleTypeRecord {
+    int32_t type;
+    float maxSpeed;
+    float acceleration;
+    float length;
+    uint8_t color[4];
+};
+
+static_assert(sizeof(FileHeader) == 32, "en-tete .scmap : 32 octets");
+static_assert(sizeof(SectionEntry) == 24, "entree de section : 24 octets");
+static_assert(sizeof(SegmentRecord) == 28, "enregistrement segment : 28 octets");
+static_assert(sizeof(PointRecord) == sizeof(Vector3), "points recopies tels quels dans les trottoirs");
+
+// Accumule les sections puis assemble le fichier (en-tête + table + données alignées)
+class SectionWriter {
+public:
+    template <class T>
+    void Add(uint32_t kind, const std::vector<T>& items) {
+        static_assert(std::is_trivially_copyable<T>::value, "section = tableau d'enregistrements POD");
+        Pending p;
+        p.entry = SectionEntry{kind, static_cast<uint32_t>(sizeof(T)), 0, items.size()};
+        p.bytes.resize(items.size() * sizeof(T));
+        if (!items.empty()) std::memcpy(p.bytes.data(), items.data(), p.bytes.size());
+        sections.push_back(std::move(p));
+    }
+
+    std::string Assemble(uint32_t flags) const {
+        size_t offset = Align(sizeof(FileHeader) + sections.size() * sizeof(SectionEntry));
+        std::vector<SectionEntry> table;
+        for (const Pending& p : sections) {
+            SectionEntry e = p.entry;
+            e.offset = offset;
+            table.push_back(e);
+            offset = Align(offset + p.bytes.size());
+        }
+
+        FileHeader header{};
+        std::memcpy(header.magic, MapBinary::kMagic, sizeof(header.magic));
+        header.version = MapBinary::kVersion;
+        header.byteOrder = kByteOrderMark;
+        header.sectionCount = static_cast<uint32_t>(sections.size());
+        header.flags = flags;
+        header.fileSize = offset;
+
+        std::string out(offset, '\0');
+        std::memcpy(&out[0], &header, sizeof(header));
+        if (!table.empty()) std::memcpy(&out[sizeof(header)], table.data(), table.size() * sizeof(SectionEntry));
+        for (size_t i = 0; i < sections.size(); ++i) {
+            if (!sections[i].bytes.empty()) {
+                std::memcpy(&out[table[i].offset], sections[i].bytes.data(), sections[i].bytes.size());
+            }
+        }
+        return out;
+    }
+
+private:
+    struct Pending {
+        SectionEntry entry;
+        std::vector<char> bytes;
+    };
+    static size_t Align(size_t v) { return (v + kSectionAlignment - 1) & ~(kSectionAlignment - 1); }
+    std::vector<Pending> sections;
+};
+
+// Vue sur un contenu chargé : sections validées (bornes, taille d'enregistrement)
+class SectionReader {
+public:
+    bool Open(std::string_view data, std::string& error) {
+        this->data = data;
+        if (data.size() < sizeof(FileHeader) || !MapBinary::IsBinary(data)) {
+            error = "signature .scmap absente";
+            return false;
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (header.byteOrder != kByteOrderMark) {
+            error = "ordre des octets incompatible";
+            return false;
+        }
+        if (header.version != MapBinary::kVersion) {
+            error = "version " + std::to_string(header.version) + " non supportee (attendu "
+                  + std::to_string(MapBinary::kVersion) + "), recompiler la carte";
+            return false;
+        }
+        if (header.fileSize > data.size()
+            || header.sectionCount > (data.size() - sizeof(FileHeader)) / sizeof(SectionEntry)) {
+            error = "fichier tronque";
+            return false;
+        }
+        table.resize(header.sectionCount);
+        if (!table.empty()) {
+            std::memcpy(table.data(), data.data() + sizeof(FileHeader), table.size() * sizeof(SectionEntry));
+        }
+        for (const SectionEntry& e : table) {
+            if (e.elementSize == 0 || e.offset > header.fileSize
+                || e.count > (header.fileSize - e.offset) / e.elementSize) {
+                error = "section " + std::to_string(e.kind) + " hors du fichier";
+                return false;
+            }
+        }
+        return true;
+    }
+
+    uint32_t GetFlags() const { return header.flags; }
+
+    // Copie la section dans out ; false si absente ou de taille d'enregistrement inattendue
+    template <class T>
+    bool Read(uint32_t kind, std::vector<T>& out) const {
+        const SectionEntry* e = Find(kind);
+        if (!e || e->elementSize != sizeof(T)) return false;
+        out.resize(static_cast<size_t>(e->count));
+        if (e->count) std::memcpy(out.data(), data.data() + e->offset, out.size() * sizeof(T));
+        return true;
+    }
+
+private:
+    const SectionEntry* Find(uint32_t kind) const {
+        for (const SectionEntry& e : table) {
+            if (e.kind == kind) return &e;
+        }
+        return nullptr;
+    }
+
+    std::string_view data;
+    FileHeader header{};
+    std::vector<SectionEntry> table;
+};
+
+bool InRange(int v, int count) { return v >= 0 && v < count; }
+
+// Un CSR valide : offsets croissants de 0 à total, taille count + 1
+bool ValidOffsets(const std::vector<int>& offsets, int count, size_t total) {
+    if (offsets.size() != static_cast<size_t>(count) + 1 || offsets.front() != 0) return false;
+    for (int i = 0; i < count; ++i) {
+        if (offsets[i + 1] < offsets[i]) return false;
+    }
+    return static_cast<size_t>(offsets.back()) == total;
+}
+
+} // namespace
+
+bool MapBinary::IsBinary(std::string_view data) {
+    return data.size() >= sizeof(kMagic) && std::memcmp(data.data(), kMagic, sizeof(kMagic)) == 0;
+}
+
+std::string MapBinary::Serialize(const RoadNetwork& network) {
+    const auto& nodes = network.GetNodes();
+    const auto& segments = network.GetRoadSegments();
+    auto graph = network.GetRoutingGraph();
+    // Index corrigé après édition : on enregistre des arbres à jour
+    auto spatial = network.GetSpatialIndex();
+    if (spatial->IsPatched()) spatial = SpatialIndex::Build(network, network.GetTopologyVersion());
+    const auto& packed = *spatial->packed;
+
+    std::vector<NodeRecord> nodeRecords;
+    nodeRecords.reserve(nodes.size());
+    for (const auto& n : nodes) {
+        Vector3 p = n->GetPosition();
+        nodeRecords.push_back({n->GetId(), static_cast<int32_t>(n->GetType()), p.x, p.y, p.z, n->GetRadius()});
+    }
+
+    std::vector<SegmentRecord> segmentRecords;
+    std::vector<SidewalkRecord> sidewalkRecords;
+    std::vector<PointRecord> points;
+    segmentRecords.reserve(segments.size());
+    for (const auto& s : segments) {
+        SegmentRecord rec{};
+        rec.startNode = graph->IndexOf(s->GetStartNode());
+        rec.endNode = graph->IndexOf(s->GetEndNode());
+        rec.lanes = s->GetLanes();
+        rec.visible = s->IsVisible() ? 1 : 0;
+        rec.controlCount = static_cast<uint8_t>(s->GetControlPointCount());
+        rec.firstPoint = static_cast<uint32_t>(points.size());
+        for (int i = 0; i < s->GetControlPointCount(); ++i) {
+            const Vector3& c = s->GetControlPoints()[i];
+            points.push_back({c.x, c.y, c.z});
+        }
+        rec.firstSidewalk = static_cast<uint32_t>(sidewalkRecords.size());
+        rec.sidewalkCount = static_cast<uint32_t>(s->GetSidewalks().size());
+        for (const auto& sw : s->GetSidewalks()) {
+            sidewalkRecords.push_back({static_cast<uint32_t>(points.size()),
+                                       static_cast<uint32_t>(sw.path.size()), sw.width, sw.height});
+            for (const Vector3& p : sw.path) points.push_back({p.x, p.y, p.z});
+        }
+        segmentRecords.push_back(rec);
+    }
+
+    std::vector<RestrictionRecord> restrictions;
+    for (const auto& r : network.GetTurnRestrictions()) {
+        restrictions.push_back({r.fromNodeId, r.viaNodeId, r.toNodeId});
+    }
+
+    // Paramètres globaux de la fabrique (renseignés par le chargement du JSON)
+    std::vector<VehicleTypeRecord> vehicleTypes;
+    for (VehiculeType t : {VehiculeType::CAR, VehiculeType::BUS, VehiculeType::TRUCK}) {
+        if (!VehiculeFactory::hasDefaultParams(t)) continue;
+        auto p = VehiculeFactory::getDefaultParams(t);
+        vehicleTypes.push_back({static_cast<int32_t>(t), p.maxSpeed, p.acceleration, p.length,
+                                {p.color.r, p.color.g, p.color.b, p.color.a}});
+    }
+
+    SectionWriter w;
+    w.Add(kNodes, nodeRecords);
+    w.Add(kSegments, segmentRecords);
+    w.Add(kPoints, points);
+    w.Add(kSidewalks, sidewalkRecords);
+    w.Add(kTurnRestrictions, restrictions);
+    w.Add(kVehicleTypes, vehicleTypes);
+    w.Add(kSpawnNodes, std::vector<int32_t>(network.GetSpawnNodeIds().begin(), network.GetSpawnNodeIds().end()));
+    w.Add(kGraphOffsets, graph->offsets);
+    w.Add(kGraphTargets, graph->targets);
+    w.Add(kGraphSources, graph->sources);
+    w.Add(kGraphEdgeSegments, graph->edgeSegments);
+    w.Add(kGraphSegmentArcs, graph->segmentArcs);
+    w.Add(kGraphInLocal, graph->inLocal);
+    w.Add(kGraphInOffsets, graph->inOffsets);
+    w.Add(kGraphInArcs, graph->inArcs);
+    w.Add(kGraphMovementOffsets, graph->movementOffsets);
+    w.Add(kGraphMovements, graph->movements);
+    w.Add(kSpatialLeafCounts, std::vector<int32_t>{packed.nodeTree.leafCount, packed.segmentTree.leafCount});
+    w.Add(kSpatialNodeBoxes, packed.nodeTree.boxes);
+    w.Add(kSpatialNodeFirst, packed.nodeTree.first);
+    w.Add(kSpatialNodeCount, packed.nodeTree.count);
+    w.Add(kSpatialNodeItems, packed.nodeTree.items);
+    w.Add(kSpatialNodeItemBoxes, packed.nodeTree.itemBoxes);
+    w.Add(kSpatialSegmentBoxes, packed.segmentTree.boxes);
+    w.Add(kSpatialSegmentFirst, packed.segmentTree.first);
+    w.Add(kSpatialSegmentCount, packed.segmentTree.count);
+    w.Add(kSpatialSegmentItems, packed.segmentTree.items);
+    w.Add(kSpatialSegmentItemBoxes, packed.segmentTree.itemBoxes);
+    w.Add(kSpatialPieces, packed.pieces);
+    return w.Assemble(network.AreUTurnsAllowed() ? kFlagUTurnsAllowed : 0);
+}
+
+bool MapBinary::Write(const RoadNetwork& network, const std::string& path, std::string* error) {
+    std::string bytes = Serialize(network);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+        if (error) *error = "ecriture impossible : " + path;
+        return false;
+    }
+    return true;
+}
+
+bool MapBinary::Load(std::string_view data, RoadNetwork& outNetwork, std::string* error) {
+    std::string message;
+    auto fail = [&](const std::string& m) {
+        if (error) *error = m;
+        return false;
+    };
+
+    if (outNetwork.GetNodeCount() != 0 || outNetwork.GetRoadSegmentCount() != 0) {
+        return fail("le reseau de destination doit etre vide");
+    }
+
+    SectionReader r;
+    if (!r.Open(data, message)) return fail(message);
+
+    std::vector<NodeRecord> nodeRecords;
+    std::vector<SegmentRecord> segmentRecords;
+    std::vector<PointRecord> points;
+    std::vector<SidewalkRecord> sidewalkRecords;
+    if (!r.Read(kNodes, nodeRecords) || !r.Read(kSegments, segmentRecords)
+        || !r.Read(kPoints, points) || !r.Read(kSidewalks, sidewalkRecords)) {
+        return fail("sections de topologie manquantes");
+    }
+
+    std::vector<Node*> nodes;
+    nodes.reserve(nodeRecords.size());
+    for (const NodeRecord& n : nodeRecords) {
+        if (n.type < SIMPLE_INTERSECTION || n.type > TRAFFIC_LIGHT) return fail("type de noeud invalide");
+        Node* node = outNetwork.AddNodeWithId(n.id, {n.x, n.y, n.z}, static_cast<NodeType>(n.type), n.radius);
+        if (!node) return fail("id de noeud duplique ou hors limites : " + std::to_string(n.id));
+        nodes.push_back(node);
+    }
+
+    const int nodeCount = static_cast<int>(nodes.size());
+    for (const SegmentRecord& s : segmentRecords) {
+        if (!InRange(s.startNode, nodeCount) || !InRange(s.endNode, nodeCount)
+            || (s.controlCount != 2 && s.controlCount != 4)
+            || s.firstPoint > points.size() || s.controlCount > points.size() - s.firstPoint
+            || s.firstSidewalk > sidewalkRecords.size() || s.sidewalkCount > sidewalkRecords.size() - s.firstSidewalk) {
+            return fail("segment invalide");
+        }
+        Vector3 controls[4];
+        for (int i = 0; i < s.controlCount; ++i) {
+            const PointRecord& p = points[s.firstPoint + i];
+            controls[i] = {p.x, p.y, p.z};
+        }
+        std::vector<RoadSegment::Sidewalk> sidewalks(s.sidewalkCount);
+        for (uint32_t k = 0; k < s.sidewalkCount; ++k) {
+            const SidewalkRecord& sw = sidewalkRecords[s.firstSidewalk + k];
+            if (sw.firstPoint > points.size() || sw.pointCount > points.size() - sw.firstPoint) {
+                return fail("trottoir invalide");
+            }
+            sidewalks[k].width = sw.width;
+            sidewalks[k].height = sw.height;
+            sidewalks[k].path.resize(sw.pointCount);
+            std::memcpy(sidewalks[k].path.data(), &points[sw.firstPoint], sw.pointCount * sizeof(PointRecord));
+        }
+        RoadSegment* seg = outNetwork.AddBakedRoadSegment(nodes[s.startNode], nodes[s.endNode], s.lanes,
+                                                          controls, s.controlCount, std::move(sidewalks));
+        if (!seg) return fail("segment invalide");
+        seg->SetVisible(s.visible != 0);
+    }
+
+    std::vector<RestrictionRecord> restrictions;
+    if (r.Read(kTurnRestrictions, restrictions)) {
+        for (const RestrictionRecord& t : restrictions) {
+            outNetwork.AddTurnRestriction(t.fromNodeId, t.viaNodeId, t.toNodeId);
+        }
+    }
+    outNetwork.SetUTurnsAllowed((r.GetFlags() & kFlagUTurnsAllowed) != 0);
+
+    // Section absente des cartes compilées plus anciennes : pas de noeuds de flux
+    std::vector<int32_t> spawnNodes;
+    if (r.Read(kSpawnNodes, spawnNodes)) {
+        for (int32_t id : spawnNodes) {
+            if (!outNetwork.FindNodeById(id)) return fail("noeud de flux inconnu : " + std::to_string(id));
+        }
+        outNetwork.SetSpawnNodeIds(std::vector<int>(spawnNodes.begin(), spawnNodes.end()));
+    }
+
+    std::vector<VehicleTypeRecord> vehicleTypes;
+    if (r.Read(kVehicleTypes, vehicleTypes)) {
+        for (const VehicleTypeRecord& v : vehicleTypes) {
+            if (v.type < static_cast<int32_t>(VehiculeType::CAR) || v.type > static_cast<int32_t>(VehiculeType::TRUCK)) continue;
+            VehiculeFactory::VehicleParams p;
+            p.maxSpeed = v.maxSpeed;
+            p.acceleration = v.acceleration;
+            p.length = v.length;
+            p.color = {v.color[0], v.color[1], v.color[2], v.color[3]};
+            VehiculeFactory::setDefaultParams(static_cast<VehiculeType>(v.type), p);
+        }
+    }
+
+    // Graphe de routage : adopté s'il est complet et cohérent, sinon reconstruit à la demande
+    auto graph = std::make_shared<RoutingGraph>();
+    bool graphOk = r.Read(kGraphOffsets, graph->offsets) && r.Read(kGraphTargets, graph->targets)
+        && r.Read(kGraphSources, graph->sources) && r.Read(kGraphEdgeSegments, graph->edgeSegments)
+        && r.Read(kGraphSegmentArcs, graph->segmentArcs) && r.Read(kGraphInLocal, graph->inLocal)
+        && r.Read(kGraphInOffsets, graph->inOffsets) && r.Read(kGraphInArcs, graph->inArcs)
+        && r.Read(kGraphMovementOffsets, graph->movementOffsets) && r.Read(kGraphMovements, graph->movements);
+
+    const size_t edgeCount = graph->targets.size();
+    const int segmentCount = outNetwork.GetRoadSegmentCount();
+    graphOk = graphOk && graph->sources.size() == edgeCount && graph->edgeSegments.size() == edgeCount
+        && graph->inLocal.size() == edgeCount && graph->inArcs.size() == edgeCount
+        && graph->segmentArcs.size() == static_cast<size_t>(segmentCount)
+        && ValidOffsets(graph->offsets, nodeCount, edgeCount)
+        && ValidOffsets(graph->inOffsets, nodeCount, edgeCount)
+        && ValidOffsets(graph->movementOffsets, nodeCount, graph->movements.size());
+    for (size_t e = 0; graphOk && e < edgeCount; ++e) {
+        int v = graph->targets[e];
+        graphOk = InRange(v, nodeCount) && InRange(graph->sources[e], nodeCount)
+            && InRange(graph->edgeSegments[e], segmentCount) && InRange(graph->inArcs[e], static_cast<int>(edgeCount))
+            && InRange(graph->inLocal[e], graph->inOffsets[v + 1] - graph->inOffsets[v]);
+    }
+    for (int v = 0; graphOk && v < nodeCount; ++v) {
+        int inDegree = graph->inOffsets[v + 1] - graph->inOffsets[v];
+        int outDegree = graph->offsets[v + 1] - graph->offsets[v];
+        graphOk = graph->movementOffsets[v + 1] - graph->movementOffsets[v] == inDegree * outDegree;
+    }
+    for (size_t s = 0; graphOk && s < graph->segmentArcs.size(); ++s) {
+        graphOk = graph->segmentArcs[s] >= -1 && graph->segmentArcs[s] < static_cast<int>(edgeCount);
+    }
+
+    if (graphOk) {
+        graph->version = outNetwork.GetTopologyVersion();
+        graph->nodes = nodes;
+        graph->positions.reserve(nodes.size());
+        auto nodeIndex = std::make_shared<std::unordered_map<const Node*, int>>();
+        nodeIndex->reserve(nodes.size());
+        for (int i = 0; i < nodeCount; ++i) {
+            graph->positions.push_back(nodes[i]->GetPosition());
+            (*nodeIndex)[nodes[i]] = i;
+        }
+        graph->nodeIndex = std::move(nodeIndex);
+        graph->segments.reserve(segmentCount);
+        for (const auto& s : outNetwork.GetRoadSegments()) graph->segments.push_back(s.get());
+        outNetwork.AdoptRoutingGraph(std::move(graph));
+    }
+
+    // Index spatial : même principe, reconstruit à la demande s'il manque ou est incohérent
+    auto spatial = std::make_shared<SpatialIndex>();
+    auto packed = std::make_shared<SpatialIndex::Packed>();
+    std::vector<int32_t> leafCounts;
+    bool spatialOk = r.Read(kSpatialLeafCounts, leafCounts) && leafCounts.size() == 2
+        && r.Read(kSpatialNodeBoxes, packed->nodeTree.boxes) && r.Read(kSpatialNodeFirst, packed->nodeTree.first)
+        && r.Read(kSpatialNodeCount, packed->nodeTree.count) && r.Read(kSpatialNodeItems, packed->nodeTree.items)
+        && r.Read(kSpatialNodeItemBoxes, packed->nodeTree.itemBoxes)
+        && r.Read(kSpatialSegmentBoxes, packed->segmentTree.boxes) && r.Read(kSpatialSegmentFirst, packed->segmentTree.first)
+        && r.Read(kSpatialSegmentCount, packed->segmentTree.count) && r.Read(kSpatialSegmentItems, packed->segmentTree.items)
+        && r.Read(kSpatialSegmentItemBoxes, packed->segmentTree.itemBoxes) && r.Read(kSpatialPieces, packed->pieces);
+    if (spatialOk) {
+        packed->nodeTree.leafCount = leafCounts[0];
+        packed->segmentTree.leafCount = leafCounts[1];
+        spatialOk = packed->nodeTree.items.size() == nodes.size() && packed->nodeTree.IsValid(nodeCount)
+            && packed->segmentTree.items.size() == packed->pieces.size()
+            && packed->segmentTree.IsValid(static_cast<int>(packed->pieces.size()));
+    }
+    for (size_t i = 0; spatialOk && i < packed->pieces.size(); ++i) {
+        // Morceaux rangés par segment croissant (masquage d'un segment après édition)
+        spatialOk = InRange(packed->pieces[i].segment, segmentCount)
+            && (i == 0 || packed->pieces[i - 1].segment <= packed->pieces[i].segment);
+    }
+    if (spatialOk) {
+        spatial->version = outNetwork.GetTopologyVersion();
+        packed->segments.reserve(segmentCount);
+        for (const auto& s : outNetwork.GetRoadSegments()) packed->segments.push_back(s.get());
+        spatial->packed = std::move(packed);
+        outNetwork.AdoptSpatialIndex(std::move(spatial));
+    }
+    return true;
+}
@@ -1,100 +1,463 @@
 #include "MapLoader.h"
-#include "../third_party/json.hpp"
+#include "MapBinary.h"
+#include "core/JsonReader.h"
+#include "core/MappedFile.h"
+#include <algorithm>
+#include <charconv>
 #include <iostream>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 #include "Vehicules/VehiculeFactory.h"
 
-using nlohmann::json;
+// Texte lu entièrement avant d'être appliqué : chargement (réseau vide) ou différence avec le
+// réseau vivant (rechargement à chaud) partent de la même description
+struct NodeDef {
+    bool hasId = false;
+    int id = 0;
+    float x = 0.0f;
+    float z = 0.0f;
+    NodeType type = SIMPLE_INTERSECTION;
+    float radius = 5.0f;
+};
 
-bool MapLoader::LoadFromFile(const std::string& path, RoadNetwork& outNetwork) {
-    try {
-        json doc = json::parse_file(path);
-        if (doc.contains("topology") && doc["topology"].is_object()) {
-            auto topo = doc["topology"];
-            if (topo.contains("nodes") && topo["nodes"].is_array()) {
-                for (size_t i=0;i<topo["nodes"].size();++i) {
-                    auto n = topo["nodes"][i];
-                    int id = n.contains("id") ? n["id"].get<int>() : (int)i+1;
-                    float x = 0.0f, y=0.0f, z=0.0f;
-                    if (n.contains("pos") && n["pos"].is_array()) {
-                        auto arr = n["pos"];
-                        x = (float)arr[static_cast<size_t>(0)].get<double>();
-                        y = (float)arr[static_cast<size_t>(1)].get<double>();
-                        if (arr.size() > 2) z = (float)arr[static_cast<size_t>(2)].get<double>();
-                    } else if (n.contains("position") && n["position"].is_array()) {
-                        auto arr = n["position"];
-                        x = (float)arr[static_cast<size_t>(0)].get<double>();
-                        z = (float)arr[static_cast<size_t>(1)].get<double>();
-                    }
-                    std::string type = "SIMPLE_INTERSECTION";
-                    if (n.contains("type")) {
-                        std::string t = n["type"].get<std::string>();
-                        if (t == "roundabout" || t == "ROUNDABOUT") type = "ROUNDABOUT";
-                        else if (t == "traffic_light" || t == "TRAFFIC_LIGHT") type = "TRAFFIC_LIGHT";
-                        else type = "SIMPLE_INTERSECTION";
-                    }
-                    float radius = n.contains("radius") ? (float)n["radius"].get<double>() : 5.0f;
-                    NodeType nt = SIMPLE_INTERSECTION;
-                    if (type == "ROUNDABOUT") nt = ROUNDABOUT;
-                    if (type == "TRAFFIC_LIGHT") nt = TRAFFIC_LIGHT;
-                    Node* node = outNetwork.AddNode({x, 0.2f, z}, nt, radius);
-                    (void)node; // id mapping not used currently
-                }
+// Le fichier peut déclarer les routes avant les noeuds
+struct RouteDef {
+    int from = -1;
+    int to = -1;
+    int lanes = 2;
+    bool curved = false;
+    bool hasVisible = false;
+    bool visible = true;
+};
+
+struct MapDef {
+    std::vector<NodeDef> nodes;
+    std::vector<RouteDef> routes;
+    std::vector<TurnRestriction> restrictions;
+    bool hasUTurns = false;
+    bool uTurns = false;
+    std::vector<std::pair<VehiculeType, VehiculeFactory::VehicleParams>> vehicleTypes;
+    std::vector<int> spawnPoints; // ids de noeuds
+};
+
+// Tableau de nombres [a, b, c...] ; les valeurs au-delà de maxCount sont ignorées
+static bool ReadFloats(JsonReader& r, float* out, int maxCount, int& count) {
+    count = 0;
+    if (!r.BeginArray()) return false;
+    while (r.NextElement()) {
+        float v;
+        if (!r.ReadFloat(v)) return false;
+        if (count < maxCount) out[count] = v;
+        ++count;
+    }
+    return !r.HasError();
+}
+
+static bool ParseNode(JsonReader& r, NodeDef& node) {
+    std::string_view key;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(key)) {
+        if (key == "id") {
+            node.hasId = r.ReadInt(node.id);
+        } else if (key == "pos") {
+            // [x, y, z] (y ignoré : les noeuds sont posés sur la chaussée)
+            float v[3] = {0.0f, 0.0f, 0.0f};
+            int n;
+            if (!ReadFloats(r, v, 3, n)) return false;
+            node.x = v[0];
+            node.z = v[2];
+        } else if (key == "position") {
+            // [x, z]
+            float v[2] = {0.0f, 0.0f};
+            int n;
+            if (!ReadFloats(r, v, 2, n)) return false;
+            node.x = v[0];
+            node.z = v[1];
+        } else if (key == "type") {
+            std::string_view t;
+            if (!r.ReadString(t)) return false;
+            if (t == "roundabout" || t == "ROUNDABOUT") node.type = ROUNDABOUT;
+            else if (t == "traffic_light" || t == "TRAFFIC_LIGHT") node.type = TRAFFIC_LIGHT;
+            else node.type = SIMPLE_INTERSECTION;
+        } else if (key == "radius") {
+            r.ReadFloat(node.radius);
+        } else {
+            r.Skip();
+        }
+    }
+    return !r.HasError();
+}
+
+static bool ParseRoute(JsonReader& r, RouteDef& route) {
+    std::string_view key;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(key)) {
+        if (key == "from") r.ReadInt(route.from);
+        else if (key == "to") r.ReadInt(route.to);
+        else if (key == "lanes") r.ReadInt(route.lanes);
+        else if (key == "curved") {
+            // Présence de la clé = route courbe, sauf "curved": false
+            route.curved = true;
+            if (r.Peek() == JsonType::Bool) r.ReadBool(route.curved);
+            else r.Skip();
+        } else if (key == "visible") {
+            JsonType t = r.Peek();
+            if (t == JsonType::Bool) {
+                route.hasVisible = r.ReadBool(route.visible);
+            } else if (t == JsonType::String) {
+                std::string_view s;
+                route.hasVisible = r.ReadString(s);
+                route.visible = (s != "false");
+            } else {
+                r.Skip();
+            }
+        } else {
+            r.Skip();
+        }
+    }
+    return !r.HasError();
+}
+
+static bool ParseTopology(JsonReader& r, MapDef& def) {
+    std::string_view key;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(key)) {
+        if (key == "nodes" && r.Peek() == JsonType::Array) {
+            r.BeginArray();
+            while (r.NextElement()) {
+                def.nodes.emplace_back();
+                if (!ParseNode(r, def.nodes.back())) return false;
+            }
+        } else if (key == "routes" && r.Peek() == JsonType::Array) {
+            r.BeginArray();
+            while (r.NextElement()) {
+                def.routes.emplace_back();
+                if (!ParseRoute(r, def.routes.back())) return false;
             }
-            if (topo.contains("routes") && topo["routes"].is_array()) {
-                for (size_t i=0;i<topo["routes"].size();++i) {
-                    auto e = topo["routes"][i];
-                    int from = e.contains("from") ? e["from"].get<int>() : -1;
-                    int to = e.contains("to") ? e["to"].get<int>() : -1;
-                    int lanes = e.contains("lanes") ? e["lanes"].get<int>() : 2;
-                    bool curved = e.contains("curved") ? true : false;
-                    // find nodes by id (simple linear search)
-                    Node* nFrom = nullptr; Node* nTo = nullptr;
-                    for (auto& nptr : outNetwork.GetNodes()) {
-                        if (nptr->GetId() == from) nFrom = nptr.get();
-                        if (nptr->GetId() == to) nTo = nptr.get();
-                    }
-                        if (nFrom && nTo) {
-                        RoadSegment* seg = outNetwork.AddRoadSegment(nFrom, nTo, lanes, curved);
-                        if (e.contains("visible") && !e["visible"].is_null()) {
-                            bool vis = true;
-                            if (e["visible"].is_boolean()) vis = e["visible"].get<bool>();
-                            else if (e["visible"].is_string()) vis = (e["visible"].get<std::string>() != "false");
-                            
-                            seg->SetVisible(vis);
-                        }
-                    }
+        } else if (key == "turn_restrictions" && r.Peek() == JsonType::Array) {
+            // Manoeuvres interdites : [{ "from": a, "via": b, "to": c }] (ids de noeuds)
+            r.BeginArray();
+            while (r.NextElement()) {
+                int ids[3] = {0, 0, 0};
+                int found = 0;
+                std::string_view k;
+                if (!r.BeginObject()) return false;
+                while (r.NextMember(k)) {
+                    int slot = (k == "from") ? 0 : (k == "via") ? 1 : (k == "to") ? 2 : -1;
+                    if (slot < 0) { r.Skip(); continue; }
+                    if (r.ReadInt(ids[slot])) found |= 1 << slot;
                 }
+                if (found == 7) def.restrictions.push_back({ids[0], ids[1], ids[2]});
             }
+        } else if (key == "allow_u_turns" && r.Peek() == JsonType::Bool) {
+            def.hasUTurns = r.ReadBool(def.uTurns);
+        } else {
+            r.Skip();
         }
-        // Read vehicle type defaults if present
-        if (doc.contains("vehicle_types") && doc["vehicle_types"].is_object()) {
-            auto vt = doc["vehicle_types"];
-            for (const std::string& key : { std::string("CAR"), std::string("BUS"), std::string("TRUCK") }) {
-                if (!vt.contains(key)) continue;
-                auto node = vt[key];
-                VehiculeFactory::VehicleParams p;
-                if (node.contains("max_speed")) p.maxSpeed = (float)node["max_speed"].get<double>();
-                if (node.contains("acceleration")) p.acceleration = (float)node["acceleration"].get<double>();
-                if (node.contains("length")) p.length = (float)node["length"].get<double>();
-                if (node.contains("color") && node["color"].is_string()) {
-                    std::string col = node["color"].get<std::string>();
-                    // parse #RRGGBB
-                    if (col.size() == 7 && col[0] == '#') {
-                        int r = std::stoi(col.substr(1,2), nullptr, 16);
-                        int g = std::stoi(col.substr(3,2), nullptr, 16);
-                        int b = std::stoi(col.substr(5,2), nullptr, 16);
-                        p.color = { (unsigned char)r, (unsigned char)g, (unsigned char)b, 255 };
-                    }
-                }
-                VehiculeType vtkey = VehiculeType::CAR;
-                if (key == "BUS") vtkey = VehiculeType::BUS;
-                else if (key == "TRUCK") vtkey = VehiculeType::TRUCK;
-                VehiculeFactory::setDefaultParams(vtkey, p);
+    }
+    return !r.HasError();
+}
+
+// "#RRGGBB"
+static bool ParseColor(std::string_view col, Color& out) {
+    if (col.size() != 7 || col[0] != '#') return false;
+    unsigned char c[3];
+    for (int i = 0; i < 3; ++i) {
+        const char* first = col.data() + 1 + 2 * i;
+        if (std::from_chars(first, first + 2, c[i], 16).ptr != first + 2) return false;
+    }
+    out = { c[0], c[1], c[2], 255 };
+    return true;
+}
+
+// Paramètres par défaut des types de véhicules : { "CAR": { "max_speed": ..., ... }, ... }
+static bool ParseVehicleTypes(JsonReader& r, MapDef& def) {
+    std::string_view typeKey;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(typeKey)) {
+        VehiculeType vtkey;
+        if (typeKey == "CAR") vtkey = VehiculeType::CAR;
+        else if (typeKey == "BUS") vtkey = VehiculeType::BUS;
+        else if (typeKey == "TRUCK") vtkey = VehiculeType::TRUCK;
+        else { r.Skip(); continue; }
+
+        VehiculeFactory::VehicleParams p;
+        std::string_view key;
+        if (!r.BeginObject()) return false;
+        while (r.NextMember(key)) {
+            if (key == "max_speed") r.ReadFloat(p.maxSpeed);
+            else if (key == "acceleration") r.ReadFloat(p.acceleration);
+            else if (key == "length") r.ReadFloat(p.length);
+            else if (key == "color" && r.Peek() == JsonType::String) {
+                std::string_view col;
+                if (r.ReadString(col)) ParseColor(col, p.color);
+            } else r.Skip();
+        }
+        if (r.HasError()) return false;
+        def.vehicleTypes.push_back({vtkey, p});
+    }
+    return !r.HasError();
+}
+
+// Scénario : seuls les noeuds de flux concernent le réseau ({ "spawn_points": [1, 3...] })
+static bool ParseScenario(JsonReader& r, MapDef& def) {
+    std::string_view key;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(key)) {
+        if (key == "spawn_points" && r.Peek() == JsonType::Array) {
+            r.BeginArray();
+            while (r.NextElement()) {
+                int id;
+                if (!r.ReadInt(id)) return false;
+                def.spawnPoints.push_back(id);
+            }
+        } else {
+            r.Skip();
+        }
+    }
+    return !r.HasError();
+}
+
+// Noeuds de flux connus du réseau, dans l'ordre du fichier
+static std::vector<int> KnownSpawnPoints(const MapDef& def, const RoadNetwork& network) {
+    std::vector<int> ids;
+    for (int id : def.spawnPoints) {
+        if (network.FindNodeById(id)) ids.push_back(id);
+        else std::cerr << "MapLoader: noeud de flux " << id << " ignore (noeud inconnu)" << std::endl;
+    }
+    return ids;
+}
+
+static bool ParseMap(std::string_view json, MapDef& def, std::string* error) {
+    JsonReader r(json);
+    std::string_view key;
+    if (r.BeginObject()) {
+        while (r.NextMember(key)) {
+            if (key == "topology" && r.Peek() == JsonType::Object) {
+                if (!ParseTopology(r, def)) break;
+            } else if (key == "vehicle_types" && r.Peek() == JsonType::Object) {
+                if (!ParseVehicleTypes(r, def)) break;
+            } else if (key == "scenario" && r.Peek() == JsonType::Object) {
+                if (!ParseScenario(r, def)) break;
+            } else {
+                r.Skip();
             }
         }
-        return true;
-    } catch (const std::exception& ex) {
-        std::cerr << "MapLoader error: " << ex.what() << std::endl;
+        r.Finish();
+    }
+    if (r.HasError()) {
+        if (error) *error = r.GetError();
         return false;
     }
+    return true;
+}
+
+static RoadSegment* AddRoute(RoadNetwork& network, const RouteDef& e) {
+    Node* nFrom = network.FindNodeById(e.from);
+    Node* nTo = network.FindNodeById(e.to);
+    if (!nFrom || !nTo) {
+        std::cerr << "MapLoader: route " << e.from << " -> " << e.to << " ignoree (noeud inconnu)" << std::endl;
+        return nullptr;
+    }
+    RoadSegment* seg = network.AddRoadSegment(nFrom, nTo, e.lanes, e.curved);
+    if (seg && e.hasVisible) seg->SetVisible(e.visible);
+    return seg;
+}
+
+static bool SameParams(const VehiculeFactory::VehicleParams& a, const VehiculeFactory::VehicleParams& b) {
+    return a.maxSpeed == b.maxSpeed && a.acceleration == b.acceleration && a.length == b.length
+        && a.color.r == b.color.r && a.color.g == b.color.g && a.color.b == b.color.b && a.color.a == b.color.a;
+}
+
+static std::tuple<int, int, int> RestrictionKey(const TurnRestriction& r) {
+    return {r.fromNodeId, r.viaNodeId, r.toNodeId};
+}
+
+// Restrictions présentes dans a et absentes de b (multiensembles)
+static std::vector<TurnRestriction> MissingRestrictions(std::vector<TurnRestriction> a, std::vector<TurnRestriction> b) {
+    auto order = [](const TurnRestriction& x, const TurnRestriction& y) { return RestrictionKey(x) < RestrictionKey(y); };
+    std::sort(a.begin(), a.end(), order);
+    std::sort(b.begin(), b.end(), order);
+    std::vector<TurnRestriction> out;
+    std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(out), order);
+    return out;
+}
+
+bool MapLoader::LoadFromFile(const std::string& path, RoadNetwork& outNetwork) {
+    // Fichier projeté en mémoire : le lecteur travaille directement sur les pages du fichier
+    MappedFile file;
+    if (!file.Open(path)) {
+        std::cerr << "MapLoader error: " << file.GetError() << std::endl;
+        return false;
+    }
+    std::string error;
+    const bool ok = MapBinary::IsBinary(file.View())
+        ? MapBinary::Load(file.View(), outNetwork, &error)
+        : LoadFromMemory(file.View(), outNetwork, &error);
+    if (!ok) {
+        std::cerr << "MapLoader error: " << path << ", " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool MapLoader::LoadFromMemory(std::string_view json, RoadNetwork& outNetwork, std::string* error) {
+    MapDef def;
+    if (!ParseMap(json, def, error)) return false;
+
+    // Les ids du fichier sont conservés (routes, restrictions et spawns y font référence)
+    for (const NodeDef& n : def.nodes) {
+        if (!n.hasId) {
+            outNetwork.AddNode({n.x, 0.2f, n.z}, n.type, n.radius);
+        } else if (!outNetwork.AddNodeWithId(n.id, {n.x, 0.2f, n.z}, n.type, n.radius)) {
+            std::cerr << "MapLoader: noeud " << n.id << " ignore (id duplique ou hors limites)" << std::endl;
+        }
+    }
+    for (const TurnRestriction& t : def.restrictions) outNetwork.AddTurnRestriction(t.fromNodeId, t.viaNodeId, t.toNodeId);
+    if (def.hasUTurns) outNetwork.SetUTurnsAllowed(def.uTurns);
+    for (const RouteDef& e : def.routes) AddRoute(outNetwork, e);
+    outNetwork.SetSpawnNodeIds(KnownSpawnPoints(def, outNetwork));
+    for (const auto& v : def.vehicleTypes) VehiculeFactory::setDefaultParams(v.first, v.second);
+    return true;
+}
+
+bool MapLoader::ReloadFromFile(const std::string& path, RoadNetwork& network, ReloadStats* stats) {
+    MappedFile file;
+    if (!file.Open(path)) {
+        std::cerr << "MapLoader error: " << file.GetError() << std::endl;
+        return false;
+    }
+    if (MapBinary::IsBinary(file.View())) {
+        std::cerr << "MapLoader error: " << path << ", carte compilee : rechargement a chaud depuis le JSON" << std::endl;
+        return false;
+    }
+    std::string error;
+    if (!ReloadFromMemory(file.View(), network, stats, &error)) {
+        std::cerr << "MapLoader error: " << path << ", " << error << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool MapLoader::ReloadFromMemory(std::string_view json, RoadNetwork& network, ReloadStats* stats, std::string* error) {
+    MapDef def;
+    if (!ParseMap(json, def, error)) return false;
+    ReloadStats local;
+    ReloadStats& s = stats ? *stats : local;
+    s = ReloadStats();
+
+    // Ids des noeuds : même attribution qu'au chargement dans un réseau vide (doublons et ids hors limites ignorés)
+    std::vector<std::pair<int, const NodeDef*>> wanted;
+    std::unordered_set<int> wantedIds;
+    int nextId = 1;
+    for (const NodeDef& n : def.nodes) {
+        const int id = n.hasId ? n.id : nextId;
+        if (id > RoadNetwork::kMaxNodeId || !wantedIds.insert(id).second) continue;
+        nextId = std::max(nextId, id + 1);
+        wanted.push_back({id, &n});
+    }
+
+    // 1. Noeuds nouveaux ou modifiés (les routes connectées suivent)
+    for (const auto& w : wanted) {
+        const NodeDef& n = *w.second;
+        Node* live = network.FindNodeById(w.first);
+        if (!live) {
+            network.AddNodeWithId(w.first, {n.x, 0.2f, n.z}, n.type, n.radius);
+            ++s.nodesAdded;
+            continue;
+        }
+        bool changed = false;
+        Vector3 p = live->GetPosition();
+        if (p.x != n.x || p.z != n.z) changed |= network.MoveNode(live, {n.x, p.y, n.z});
+        if (live->GetType() != n.type || live->GetRadius() != n.radius) {
+            changed |= network.SetNodeShape(live, n.type, n.radius);
+        }
+        if (changed) ++s.nodesChanged;
+    }
+
+    // 2. Routes appariées par (from, to), dans l'ordre du réseau pour les doublons
+    auto routeKey = [](int from, int to) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(from)) << 32) | static_cast<uint32_t>(to);
+    };
+    std::unordered_map<uint64_t, std::vector<RoadSegment*>> live;
+    for (const auto& seg : network.GetRoadSegments()) {
+        live[routeKey(seg->GetStartNode()->GetId(), seg->GetEndNode()->GetId())].push_back(seg.get());
+    }
+    for (auto& entry : live) std::reverse(entry.second.begin(), entry.second.end()); // le premier en dernier
+    std::unordered_set<const RoadSegment*> matched;
+    std::vector<const RouteDef*> added;
+    for (const RouteDef& e : def.routes) {
+        auto it = live.find(routeKey(e.from, e.to));
+        if (it == live.end() || it->second.empty()) {
+            added.push_back(&e);
+            continue;
+        }
+        RoadSegment* seg = it->second.back();
+        it->second.pop_back();
+        matched.insert(seg);
+
+        bool changed = false;
+        if (seg->GetLanes() != e.lanes) changed |= network.SetSegmentLanes(seg, e.lanes);
+        if (seg->IsCurved() != e.curved) {
+            // Le raccord courbe ne change la géométrie qu'aux ronds-points
+            changed |= seg->GetStartNode()->GetType() == ROUNDABOUT || seg->GetEndNode()->GetType() == ROUNDABOUT;
+            network.SetSegmentCurved(seg, e.curved);
+        }
+        const bool visible = e.hasVisible ? e.visible : true;
+        if (seg->IsVisible() != visible) changed |= network.SetSegmentVisible(seg, visible);
+        if (changed) ++s.segmentsChanged;
+    }
+    std::vector<RoadSegment*> stale;
+    for (const auto& seg : network.GetRoadSegments()) {
+        if (!matched.count(seg.get())) stale.push_back(seg.get());
+    }
+    for (RoadSegment* seg : stale) {
+        network.RemoveRoadSegment(seg);
+        ++s.segmentsRemoved;
+    }
+
+    // 3. Noeuds disparus du fichier (avec leurs intersections et restrictions)
+    std::vector<Node*> removed;
+    for (const auto& node : network.GetNodes()) {
+        if (!wantedIds.count(node->GetId())) removed.push_back(node.get());
+    }
+    for (Node* node : removed) {
+        network.RemoveNode(node);
+        ++s.nodesRemoved;
+    }
+
+    // 4. Nouvelles routes, une fois tous les noeuds en place
+    for (const RouteDef* e : added) {
+        if (AddRoute(network, *e)) ++s.segmentsAdded;
+    }
+
+    // 5. Restrictions, demi-tours, noeuds de flux, paramètres des types de véhicules (prochains spawns)
+    for (const TurnRestriction& t : MissingRestrictions(network.GetTurnRestrictions(), def.restrictions)) {
+        network.RemoveTurnRestriction(t.fromNodeId, t.viaNodeId, t.toNodeId);
+        ++s.restrictionsChanged;
+    }
+    for (const TurnRestriction& t : MissingRestrictions(def.restrictions, network.GetTurnRestrictions())) {
+        network.AddTurnRestriction(t.fromNodeId, t.viaNodeId, t.toNodeId);
+        ++s.restrictionsChanged;
+    }
+    const bool uTurns = def.hasUTurns && def.uTurns;
+    if (network.AreUTurnsAllowed() != uTurns) {
+        network.SetUTurnsAllowed(uTurns);
+        s.uTurnsChanged = true;
+    }
+    std::vector<int> spawnPoints = KnownSpawnPoints(def, network);
+    if (spawnPoints != network.GetSpawnNodeIds()) {
+        network.SetSpawnNodeIds(std::move(spawnPoints));
+        s.spawnPointsChanged = true;
+    }
+    for (const auto& v : def.vehicleTypes) {
+        if (VehiculeFactory::hasDefaultParams(v.first) && SameParams(VehiculeFactory::getDefaultParams(v.first), v.second)) {
+            continue;
+        }
+        VehiculeFactory::setDefaultParams(v.first, v.second);
+        ++s.vehicleTypesChanged;
+    }
+    return true;
 }
@@ -0,0 +1,225 @@
+#include "NetworkPartition.h"
+#include "RoadNetwork.h"
+#include <algorithm>
+#include <numeric>
+
+static constexpr int kRefinePasses = 4;
+
+namespace {
+
+// Bissection récursive : ids[begin, end) répartis sur [firstRegion, firstRegion + parts)
+struct Bisector {
+    const std::vector<Vector3>& positions;
+    const std::vector<float>& weights;
+    std::vector<int>& regions;
+
+    void Split(std::vector<int>& ids, size_t begin, size_t end, int firstRegion, int parts) {
+        if (parts <= 1) {
+            for (size_t i = begin; i < end; ++i) regions[ids[i]] = firstRegion;
+            return;
+        }
+
+        float minX = positions[ids[begin]].x, maxX = minX;
+        float minZ = positions[ids[begin]].z, maxZ = minZ;
+        float total = 0.0f;
+        for (size_t i = begin; i < end; ++i) {
+            const Vector3& p = positions[ids[i]];
+            minX = std::min(minX, p.x);
+            maxX = std::max(maxX, p.x);
+            minZ = std::min(minZ, p.z);
+            maxZ = std::max(maxZ, p.z);
+            total += weights[ids[i]];
+        }
+        const bool alongX = maxX - minX >= maxZ - minZ;
+        std::sort(ids.begin() + begin, ids.begin() + end, [&](int a, int b) {
+            float ka = alongX ? positions[a].x : positions[a].z;
+            float kb = alongX ? positions[b].x : positions[b].z;
+            return ka < kb || (ka == kb && a < b);
+        });
+
+        // Coupure au poids cible, chaque moitié gardant au moins un noeud par région
+        const int leftParts = parts / 2;
+        const float target = total * leftParts / parts;
+        size_t mid = begin;
+        float accumulated = 0.0f;
+        while (mid < end && accumulated < target) accumulated += weights[ids[mid++]];
+        mid = std::clamp(mid, begin + leftParts, end - (parts - leftParts));
+
+        Split(ids, begin, mid, firstRegion, leftParts);
+        Split(ids, mid, end, firstRegion + leftParts, parts - leftParts);
+    }
+};
+
+} // namespace
+
+std::shared_ptr<const NetworkPartition> NetworkPartition::Build(const RoadNetwork& network, int regionCount,
+                                                                uint64_t topologyVersion) {
+    auto partition = std::make_shared<NetworkPartition>();
+    partition->version = topologyVersion;
+
+    const auto& nodes = network.GetNodes();
+    const auto& segments = network.GetRoadSegments();
+    const int nodeCount = static_cast<int>(nodes.size());
+    const int regions = std::max(1, std::min(regionCount, nodeCount));
+    partition->regionCount = regions;
+
+    std::vector<Vector3> positions;
+    positions.reserve(nodes.size());
+    for (int i = 0; i < nodeCount; ++i) positions.push_back(nodes[i]->GetPosition());
+
+    // Extrémités des segments, poids des noeuds et voisinage non orienté (CSR)
+    std::vector<int> segmentStart(segments.size()), segmentEnd(segments.size());
+    std::vector<float> weights(nodeCount, 1.0f);
+    std::vector<int> offsets(nodeCount + 1, 0);
+    for (size_t s = 0; s < segments.size(); ++s) {
+        segmentStart[s] = network.GetNodeIndex(segments[s]->GetStartNode());
+        segmentEnd[s] = network.GetNodeIndex(segments[s]->GetEndNode());
+        weights[segmentEnd[s]] += 1.0f;
+        if (segmentStart[s] != segmentEnd[s]) {
+            ++offsets[segmentStart[s] + 1];
+            ++offsets[segmentEnd[s] + 1];
+        }
+    }
+    std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+    std::vector<int> neighbours(offsets.back());
+    std::vector<int> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t s = 0; s < segments.size(); ++s) {
+        if (segmentStart[s] == segmentEnd[s]) continue;
+        neighbours[fill[segmentStart[s]]++] = segmentEnd[s];
+        neighbours[fill[segmentEnd[s]]++] = segmentStart[s];
+    }
+
+    std::vector<int>& nodeRegions = partition->nodeRegions;
+    nodeRegions.assign(nodeCount, 0);
+    if (nodeCount > 0) {
+        std::vector<int> ids(nodeCount);
+        std::iota(ids.begin(), ids.end(), 0);
+        Bisector{positions, weights, nodeRegions}.Split(ids, 0, ids.size(), 0, regions);
+    }
+
+    // Affinage : déplacements de noeuds frontière qui réduisent le nombre de segments coupés
+    std::vector<float> regionWeights(regions, 0.0f);
+    std::vector<int> regionSizes(regions, 0);
+    float totalWeight = 0.0f;
+    for (int i = 0; i < nodeCount; ++i) {
+        regionWeights[nodeRegions[i]] += weights[i];
+        ++regionSizes[nodeRegions[i]];
+        totalWeight += weights[i];
+    }
+    const float average = totalWeight / regions;
+    const float maxWeight = average * (1.0f + kImbalance);
+    const float minWeight = average * (1.0f - kImbalance);
+    std::vector<std::pair<int, int>> links; // (région voisine, segments vers elle)
+    for (int pass = 0; pass < kRefinePasses && regions > 1; ++pass) {
+        int moves = 0;
+        for (int u = 0; u < nodeCount; ++u) {
+            const int from = nodeRegions[u];
+            links.clear();
+            for (int k = offsets[u]; k < offsets[u + 1]; ++k) {
+                int r = nodeRegions[neighbours[k]];
+                auto it = std::find_if(links.begin(), links.end(), [r](const auto& l) { return l.first == r; });
+                if (it == links.end()) links.push_back({r, 1});
+                else ++it->second;
+            }
+            int internal = 0;
+            for (const auto& l : links) {
+                if (l.first == from) internal = l.second;
+            }
+            int best = from, bestGain = 0;
+            for (const auto& l : links) {
+                int gain = l.second - internal;
+                if (l.first != from && (gain > bestGain || (gain == bestGain && gain > 0 && l.first < best))
+                    && regionWeights[l.first] + weights[u] <= maxWeight
+                    && regionWeights[from] - weights[u] >= minWeight && regionSizes[from] > 1) {
+                    best = l.first;
+                    bestGain = gain;
+                }
+            }
+            if (best != from) {
+                nodeRegions[u] = best;
+                regionWeights[from] -= weights[u];
+                regionWeights[best] += weights[u];
+                --regionSizes[from];
+                ++regionSizes[best];
+                ++moves;
+            }
+        }
+        if (moves == 0) break;
+    }
+
+    partition->Assign(network, segmentStart, segmentEnd, weights);
+    return partition;
+}
+
+std::shared_ptr<const NetworkPartition> NetworkPartition::Patch(const NetworkPartition& previous,
+                                                                const RoadNetwork& network,
+                                                                const std::vector<int>& touchedNodes,
+                                                                uint64_t topologyVersion) {
+    const auto& nodes = network.GetNodes();
+    const auto& segments = network.GetRoadSegments();
+    const int nodeCount = static_cast<int>(nodes.size());
+    if (nodeCount < previous.regionCount) return Build(network, previous.regionCount, topologyVersion);
+
+    auto partition = std::make_shared<NetworkPartition>();
+    partition->version = topologyVersion;
+    partition->regionCount = previous.regionCount;
+
+    std::vector<int> segmentStart(segments.size()), segmentEnd(segments.size());
+    std::vector<float> weights(nodeCount, 1.0f);
+    for (size_t s = 0; s < segments.size(); ++s) {
+        segmentStart[s] = network.GetNodeIndex(segments[s]->GetStartNode());
+        segmentEnd[s] = network.GetNodeIndex(segments[s]->GetEndNode());
+        weights[segmentEnd[s]] += 1.0f;
+    }
+
+    // Régions conservées ; emplacement touché : région majoritaire des voisins (à égalité la plus
+    // petite), sinon celle de l'emplacement, sinon 0
+    std::vector<int>& nodeRegions = partition->nodeRegions;
+    nodeRegions.assign(previous.nodeRegions.begin(),
+                       previous.nodeRegions.begin() + std::min<size_t>(previous.nodeRegions.size(), nodeCount));
+    nodeRegions.resize(nodeCount, 0);
+    std::vector<int> votes(partition->regionCount, 0);
+    for (int slot : touchedNodes) {
+        if (slot >= nodeCount) break;
+        std::fill(votes.begin(), votes.end(), 0);
+        bool any = false;
+        for (const RoadSegment* road : nodes[slot]->GetConnectedRoads()) {
+            const Node* other = road->GetStartNode() == nodes[slot].get() ? road->GetEndNode() : road->GetStartNode();
+            int o = network.GetNodeIndex(other);
+            if (o < 0 || o == slot || std::binary_search(touchedNodes.begin(), touchedNodes.end(), o)) continue;
+            ++votes[nodeRegions[o]];
+            any = true;
+        }
+        if (any) nodeRegions[slot] = static_cast<int>(std::max_element(votes.begin(), votes.end()) - votes.begin());
+    }
+
+    partition->Assign(network, segmentStart, segmentEnd, weights);
+    return partition;
+}
+
+void NetworkPartition::Assign(const RoadNetwork& network, const std::vector<int>& segmentStart,
+                              const std::vector<int>& segmentEnd, const std::vector<float>& weights) {
+    const int nodeCount = network.GetNodeCount();
+    regionNodes.assign(regionCount, {});
+    regionSegments.assign(regionCount, {});
+    regionWeights.assign(regionCount, 0.0f);
+    for (int i = 0; i < nodeCount; ++i) {
+        regionNodes[nodeRegions[i]].push_back(i);
+        regionWeights[nodeRegions[i]] += weights[i];
+    }
+    segmentRegions.resize(segmentStart.size());
+    cutSegments = 0;
+    boundaries.clear();
+    for (size_t s = 0; s < segmentStart.size(); ++s) {
+        const int from = nodeRegions[segmentStart[s]];
+        const int to = nodeRegions[segmentEnd[s]];
+        segmentRegions[s] = to;
+        regionSegments[to].push_back(static_cast<int>(s));
+        if (from != to) {
+            ++cutSegments;
+            boundaries.push_back({from, to});
+        }
+    }
+    std::sort(boundaries.begin(), boundaries.end());
+    boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+}
@@ -1,6 +1,8 @@
 #include "Node.h"
 #include "RoadSegment.h"
+#include "geometry/RoadMeshBuilder.h"
 #include "raymath.h"
+#include <algorithm>
 
 Node::Node(int id, Vector3 position, NodeType type, float radius)
     : id(id), position(position), type(type), radius(radius),
@@ -12,6 +14,10 @@ void Node::AddConnectedRoad(RoadSegment* road) {
     connectedRoads.push_back(road);
 }
 
+void Node::RemoveConnectedRoad(RoadSegment* road) {
+    connectedRoads.erase(std::remove(connectedRoads.begin(), connectedRoads.end(), road), connectedRoads.end());
+}
+
 Vector3 Node::GetConnectionTangent(Vector3 direction) const {
     direction = Vector3Normalize(direction);
     
@@ -71,97 +77,84 @@ void Node::SetEmergencyOverride(bool override, float duration) {
     }
 }
 
-void Node::Draw() const {
+float Node::GetPadHalfSize() const {
+    float maxRoadWidth = 0.0f;
+    for (const auto* road : connectedRoads) {
+        float roadWidth = road->GetWidth();
+        if (roadWidth > maxRoadWidth) maxRoadWidth = roadWidth;
+    }
+    // Taille de l'intersection = max(radius, largeur route maximale)
+    return fmaxf(radius, maxRoadWidth * 0.5f);
+}
+
+void Node::Bake(RoadMeshBuilder& out) const {
+    // Le rond-point est construit par RoundaboutGeometry dans Intersection
+    if (type == ROUNDABOUT) return;
+    
+    // Zone d'intersection carrée (dessus d'une dalle de 0.01)
     Color roadColor = {50, 50, 50, 255};
-    Color lineColor = {255, 255, 255, 255};
+    float s = GetPadHalfSize();
+    float y = position.y + 0.005f;
+    out.Quad({position.x - s, y, position.z - s}, {position.x + s, y, position.z - s},
+             {position.x + s, y, position.z + s}, {position.x - s, y, position.z + s}, roadColor);
+}
+
+BoundingBox Node::GetLightBounds() const {
+    // Poteaux aux coins de la dalle, boîtiers jusqu'à 13 unités de haut
+    const float s = GetPadHalfSize() + 2.0f;
+    return {{position.x - s, position.y, position.z - s}, {position.x + s, position.y + 14.0f, position.z + s}};
+}
+
+int Node::GetLightProps(TrafficLightProp out[4]) const {
+    if (type != TRAFFIC_LIGHT) return 0;
     
-    switch (type) {
-        case ROUNDABOUT:
-            // Le rond-point est dessiné via RoundaboutGeometry dans Intersection
-            break;
-            
-        case TRAFFIC_LIGHT: {
-            // Calculer la taille basée sur les routes connectées
-            float maxRoadWidth = 0.0f;
-            for (const auto* road : connectedRoads) {
-                float roadWidth = road->GetWidth();
-                if (roadWidth > maxRoadWidth) maxRoadWidth = roadWidth;
-            }
-            
-            // Taille de l'intersection = max(radius, largeur route maximale)
-            float intersectionSize = fmaxf(radius, maxRoadWidth * 0.5f);
-            
-            // Zone d'intersection carrée
-            DrawCube(position, intersectionSize * 2, 0.01f, intersectionSize * 2, roadColor);
-            
-            // Feux tricolores aux 4 coins
-            Vector3 corners[4] = {
-                {position.x + intersectionSize, position.y, position.z + intersectionSize},
-                {position.x + intersectionSize, position.y, position.z - intersectionSize},
-                {position.x - intersectionSize, position.y, position.z + intersectionSize},
-                {position.x - intersectionSize, position.y, position.z - intersectionSize}
-            };
-            
-            // Déterminer la couleur active selon l'état
-            Color activeRed = (lightState == LIGHT_RED || emergencyOverride) ? RED : Fade(RED, 0.3f);
-            Color activeYellow = (lightState == LIGHT_YELLOW && !emergencyOverride) ? YELLOW : Fade(YELLOW, 0.3f);
-            Color activeGreen = (lightState == LIGHT_GREEN || emergencyOverride) ? GREEN : Fade(GREEN, 0.3f);
-            
-            for (int i = 0; i < 4; i++) {
-                // Poteau
-                DrawCylinder(corners[i], 1.0f, 1.0f, 13.0f, 8, DARKGRAY); 
-                
-                // Configuration de l'orientation selon le coin pour qu'ils se fassent face
-                Vector3 boxSize = {2.2f, 6.0f, 1.6f}; // Par défaut orienté Z
-                Vector3 lightOffset = {0.0f, 0.0f, 0.85f}; // Par défaut face +Z
-                
-                if (i == 0) { // Coin (+X, +Z) -> Face +Z
-                    boxSize = {2.2f, 6.0f, 1.6f};
-                    lightOffset = {0.0f, 0.0f, 0.85f};
-                } 
-                else if (i == 3) { // Coin (-X, -Z) -> Face -Z
-                    boxSize = {2.2f, 6.0f, 1.6f};
-                    lightOffset = {0.0f, 0.0f, -0.85f};
-                }
-                else if (i == 1) { // Coin (+X, -Z) -> Face +X
-                    boxSize = {1.6f, 6.0f, 2.2f}; // Échange largeur/profondeur
-                    lightOffset = {0.85f, 0.0f, 0.0f};
-                }
-                else if (i == 2) { // Coin (-X, +Z) -> Face -X
-                    boxSize = {1.6f, 6.0f, 2.2f}; // Échange largeur/profondeur
-                    lightOffset = {-0.85f, 0.0f, 0.0f};
-                }
+    float intersectionSize = GetPadHalfSize();
+    
+    // Feux tricolores aux 4 coins
+    Vector3 corners[4] = {
+        {position.x + intersectionSize, position.y, position.z + intersectionSize},
+        {position.x + intersectionSize, position.y, position.z - intersectionSize},
+        {position.x - intersectionSize, position.y, position.z + intersectionSize},
+        {position.x - intersectionSize, position.y, position.z - intersectionSize}
+    };
+    // Orientation selon le coin pour qu'ils se fassent face
+    const bool faceX[4] = {false, true, true, false};       // (+X,+Z) -> +Z, (+X,-Z) -> +X, (-X,+Z) -> -X, (-X,-Z) -> -Z
+    const Vector3 offsets[4] = {{0.0f, 0.0f, 0.85f}, {0.85f, 0.0f, 0.0f}, {-0.85f, 0.0f, 0.0f}, {0.0f, 0.0f, -0.85f}};
+    
+    for (int i = 0; i < 4; i++) {
+        out[i].pole = corners[i];
+        out[i].box = {corners[i].x, corners[i].y + 10.0f, corners[i].z};
+        out[i].faceX = faceX[i];
+        out[i].lampOffset = offsets[i];
+    }
+    return 4;
+}
 
-                // Boîtier du feu
-                Vector3 lightPos = {corners[i].x, corners[i].y + 10.0f, corners[i].z};
-                DrawCube(lightPos, boxSize.x, boxSize.y, boxSize.z, BLACK);
-                
-                // Feux (rouge, jaune, vert) avec état actif
-                DrawSphere({lightPos.x + lightOffset.x, lightPos.y + 1.8f, lightPos.z + lightOffset.z}, 0.9f, activeRed);
-                DrawSphere({lightPos.x + lightOffset.x, lightPos.y, lightPos.z + lightOffset.z}, 0.9f, activeYellow);
-                DrawSphere({lightPos.x + lightOffset.x, lightPos.y - 1.8f, lightPos.z + lightOffset.z}, 0.9f, activeGreen);
-            }
-            
-            break;
-        }
+void Node::GetLampColors(Color out[3]) const {
+    // Déterminer la couleur active selon l'état
+    out[0] = (lightState == LIGHT_RED || emergencyOverride) ? RED : Fade(RED, 0.3f);
+    out[1] = (lightState == LIGHT_YELLOW && !emergencyOverride) ? YELLOW : Fade(YELLOW, 0.3f);
+    out[2] = (lightState == LIGHT_GREEN || emergencyOverride) ? GREEN : Fade(GREEN, 0.3f);
+}
+
+void Node::Draw() const {
+    TrafficLightProp props[4];
+    const int count = GetLightProps(props);
+    if (count == 0) return;
+    Color lamps[3];
+    GetLampColors(lamps);
+    
+    for (int i = 0; i < count; i++) {
+        const TrafficLightProp& p = props[i];
+        // Poteau
+        DrawCylinder(p.pole, 1.0f, 1.0f, kPoleHeight, 8, DARKGRAY); 
         
-        case SIMPLE_INTERSECTION:
-        default: {
-            // Calculer la taille basée sur les routes connectées
-            float maxRoadWidth = 0.0f;
-            for (const auto* road : connectedRoads) {
-                float roadWidth = road->GetWidth();
-                if (roadWidth > maxRoadWidth) maxRoadWidth = roadWidth;
-            }
-            
-            // Taille de l'intersection = max(radius, largeur route maximale)
-            float intersectionSize = fmaxf(radius, maxRoadWidth * 0.5f);
-            
-            // Intersection simple : carré gris
-            DrawCube(position, intersectionSize * 2, 0.01f, intersectionSize * 2, roadColor);
-            
-            
-            break;
+        // Boîtier du feu (largeur et profondeur échangées face à X)
+        DrawCube(p.box, p.faceX ? 1.6f : 2.2f, 6.0f, p.faceX ? 2.2f : 1.6f, BLACK);
+        
+        // Feux (rouge, jaune, vert) avec état actif
+        for (int k = 0; k < 3; k++) {
+            DrawSphere({p.box.x + p.lampOffset.x, p.box.y + kLampSpacing * (1 - k), p.box.z + p.lampOffset.z}, 0.9f, lamps[k]);
         }
     }
-}
\ No newline at end of file
+}
@@ -0,0 +1,462 @@
+#include "OsmImporter.h"
+#include "core/CellKey.h"
+#include "core/MappedFile.h"
+#include "core/XmlReader.h"
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+
+struct WayDef {
+    uint32_t firstRef;
+    uint32_t refCount;
+    int lanes;          // gabarit RoadSegment : 2 ou 4
+    int direction;      // 1 sens direct, -1 sens inverse, 0 double sens
+    bool roundabout;
+};
+
+// Tags utiles d'une voie (vues dans le texte, valides tant que le fichier est projeté)
+struct WayTags {
+    std::string_view highway, lanes, oneway, junction, access, area;
+};
+
+bool IsDrivable(std::string_view h, bool includeService) {
+    static const std::string_view kClasses[] = {
+        "motorway", "trunk", "primary", "secondary", "tertiary", "unclassified", "residential",
+        "living_street", "road", "motorway_link", "trunk_link", "primary_link", "secondary_link",
+        "tertiary_link"};
+    for (std::string_view c : kClasses) {
+        if (h == c) return true;
+    }
+    return includeService && h == "service";
+}
+
+bool IsMajor(std::string_view h) {
+    return h == "motorway" || h == "trunk" || h == "primary" || h == "motorway_link" || h == "trunk_link";
+}
+
+template <class T>
+bool ParseNumber(std::string_view s, T& out) {
+    return !s.empty() && std::from_chars(s.data(), s.data() + s.size(), out).ec == std::errc();
+}
+
+class Importer {
+public:
+    Importer(std::string_view xml, const OsmImportOptions& options, OsmImportStats& stats)
+        : xml(xml), options(options), stats(stats) {}
+
+    bool Run(RoadNetwork& outNetwork, std::string& error) {
+        if (!ReadWays(error) || !ReadNodes(error)) return false;
+        Project();
+        Cluster();
+        CollectSegments();
+        Emit(outNetwork);
+        return true;
+    }
+
+private:
+    // Passe 1 : voies carrossables, noeuds référencés et nombre d'usages
+    bool ReadWays(std::string& error) {
+        XmlReader r(xml);
+        bool inWay = false;
+        std::vector<int64_t> wayRefs;
+        WayTags tags;
+        for (XmlEvent ev = r.Next(); ev != XmlEvent::End; ev = r.Next()) {
+            if (ev == XmlEvent::Invalid) {
+                error = r.GetError();
+                return false;
+            }
+            std::string_view name = r.Name();
+            if (ev == XmlEvent::EndElement) {
+                if (name == "way" && inWay) {
+                    inWay = false;
+                    AddWay(wayRefs, tags);
+                }
+                continue;
+            }
+            if (name == "node") {
+                ++stats.osmNodes;
+            } else if (name == "way") {
+                ++stats.osmWays;
+                inWay = !r.IsSelfClosing();
+                wayRefs.clear();
+                tags = WayTags();
+            } else if (inWay && name == "nd") {
+                std::string_view ref;
+                int64_t id;
+                if (r.Attribute("ref", ref) && ParseNumber(ref, id)) wayRefs.push_back(id);
+            } else if (inWay && name == "tag") {
+                std::string_view k, v;
+                if (!r.Attribute("k", k) || !r.Attribute("v", v)) continue;
+                if (k == "highway") tags.highway = v;
+                else if (k == "lanes") tags.lanes = v;
+                else if (k == "oneway") tags.oneway = v;
+                else if (k == "junction") tags.junction = v;
+                else if (k == "access") tags.access = v;
+                else if (k == "area") tags.area = v;
+            }
+        }
+        return true;
+    }
+
+    void AddWay(const std::vector<int64_t>& wayRefs, const WayTags& tags) {
+        if (wayRefs.size() < 2 || !IsDrivable(tags.highway, options.includeService)) return;
+        if (tags.access == "no" || tags.access == "private" || tags.area == "yes") return;
+        ++stats.drivableWays;
+
+        WayDef way;
+        way.firstRef = static_cast<uint32_t>(refs.size());
+        way.refCount = static_cast<uint32_t>(wayRefs.size());
+        way.roundabout = tags.junction == "roundabout" || tags.junction == "circular";
+        if (tags.oneway == "yes" || tags.oneway == "true" || tags.oneway == "1") way.direction = 1;
+        else if (tags.oneway == "-1" || tags.oneway == "reverse") way.direction = -1;
+        else if (tags.oneway.empty() && (tags.highway == "motorway" || way.roundabout)) way.direction = 1;
+        else way.direction = 0;
+
+        // Tag lanes = total des deux sens ; gabarit 4 dès 2 voies par sens
+        int lanes = 0;
+        int perDirection = IsMajor(tags.highway) ? 2 : 1;
+        if (ParseNumber(tags.lanes, lanes) && lanes > 0) perDirection = way.direction ? lanes : lanes / 2;
+        way.lanes = perDirection >= 2 ? 4 : 2;
+
+        for (size_t i = 0; i < wayRefs.size(); ++i) {
+            auto it = index.find(wayRefs[i]);
+            int d;
+            if (it == index.end()) {
+                d = static_cast<int>(usage.size());
+                index.emplace(wayRefs[i], d);
+                usage.push_back(0);
+            } else {
+                d = it->second;
+            }
+            // Extrémités comptées double : toujours des carrefours
+            usage[d] += (i == 0 || i + 1 == wayRefs.size()) ? 2 : 1;
+            refs.push_back(d);
+        }
+        ways.push_back(way);
+    }
+
+    // Passe 2 : coordonnées et feux des seuls noeuds référencés
+    bool ReadNodes(std::string& error) {
+        const size_t count = usage.size();
+        lat.assign(count, 0.0);
+        lon.assign(count, 0.0);
+        hasCoords.assign(count, 0);
+        signal.assign(count, 0);
+        size_t found = 0;
+
+        XmlReader r(xml);
+        int current = -1;
+        // Arrêt anticipé une fois tous les noeuds lus, mais seulement après les tags du dernier
+        for (XmlEvent ev = r.Next(); ev != XmlEvent::End; ev = r.Next()) {
+            if (ev == XmlEvent::Invalid) {
+                error = r.GetError();
+                return false;
+            }
+            std::string_view name = r.Name();
+            if (ev == XmlEvent::EndElement) {
+                if (name == "node") {
+                    current = -1;
+                    if (found == count) break;
+                }
+                continue;
+            }
+            if (name == "node") {
+                current = -1;
+                std::string_view idText, latText, lonText;
+                int64_t id;
+                if (!r.Attribute("id", idText) || !ParseNumber(idText, id)) continue;
+                auto it = index.find(id);
+                if (it == index.end()) continue;
+                int d = it->second;
+                if (r.Attribute("lat", latText) && r.Attribute("lon", lonText)
+                    && ParseNumber(latText, lat[d]) && ParseNumber(lonText, lon[d]) && !hasCoords[d]) {
+                    hasCoords[d] = 1;
+                    ++found;
+                }
+                if (!r.IsSelfClosing()) current = d;
+                else if (found == count) break;
+            } else if (name == "tag" && current >= 0) {
+                std::string_view k, v;
+                if (r.Attribute("k", k) && k == "highway" && r.Attribute("v", v) && v == "traffic_signals") {
+                    signal[current] = 1;
+                }
+            }
+        }
+        return true;
+    }
+
+    // Projection équirectangulaire autour du centre de l'emprise (suffisant à l'échelle d'une ville)
+    void Project() {
+        double minLat = 90.0, maxLat = -90.0, minLon = 180.0, maxLon = -180.0;
+        for (size_t d = 0; d < usage.size(); ++d) {
+            if (!hasCoords[d]) continue;
+            minLat = std::min(minLat, lat[d]);
+            maxLat = std::max(maxLat, lat[d]);
+            minLon = std::min(minLon, lon[d]);
+            maxLon = std::max(maxLon, lon[d]);
+        }
+        const double lat0 = (minLat + maxLat) * 0.5, lon0 = (minLon + maxLon) * 0.5;
+        const double kx = std::cos(lat0 * PI / 180.0) * 111320.0 * options.unitsPerMeter;
+        const double kz = 110540.0 * options.unitsPerMeter;
+        x.assign(usage.size(), 0.0f);
+        z.assign(usage.size(), 0.0f);
+        for (size_t d = 0; d < usage.size(); ++d) {
+            if (!hasCoords[d]) continue;
+            x[d] = static_cast<float>((lon[d] - lon0) * kx);
+            z[d] = static_cast<float>(-(lat[d] - lat0) * kz); // nord vers -z
+        }
+    }
+
+    bool IsJunction(int d) const { return usage[d] >= 2 && hasCoords[d]; }
+
+    int Find(int a) {
+        while (parent[a] != a) {
+            parent[a] = parent[parent[a]];
+            a = parent[a];
+        }
+        return a;
+    }
+    void Union(int a, int b) {
+        a = Find(a);
+        b = Find(b);
+        if (a != b) parent[a] = b;
+    }
+
+    void Cluster() {
+        const int count = static_cast<int>(usage.size());
+        parent.resize(count);
+        for (int i = 0; i < count; ++i) parent[i] = i;
+
+        // Anneaux : tous les noeuds d'un rond-point ne forment qu'un carrefour
+        for (const WayDef& w : ways) {
+            if (!w.roundabout) continue;
+            int first = -1;
+            for (uint32_t i = 0; i < w.refCount; ++i) {
+                int d = refs[w.firstRef + i];
+                if (!hasCoords[d]) continue;
+                if (first < 0) first = d;
+                else Union(first, d);
+            }
+        }
+
+        // Carrefours proches : grille de pas mergeDistance, voisinage 3x3
+        const float cell = options.mergeDistance * options.unitsPerMeter;
+        if (cell > 0.0f) {
+            std::unordered_map<int64_t, std::vector<int>> grid;
+            for (int d = 0; d < count; ++d) {
+                if (!IsJunction(d)) continue;
+                int64_t cx = static_cast<int64_t>(std::floor(x[d] / cell));
+                int64_t cz = static_cast<int64_t>(std::floor(z[d] / cell));
+                for (int64_t ox = -1; ox <= 1; ++ox) {
+                    for (int64_t oz = -1; oz <= 1; ++oz) {
+                        auto it = grid.find(CellKey(cx + ox, cz + oz));
+                        if (it == grid.end()) continue;
+                        for (int other : it->second) {
+                            float dx = x[other] - x[d], dz = z[other] - z[d];
+                            if (dx * dx + dz * dz <= cell * cell) Union(d, other);
+                        }
+                    }
+                }
+                grid[CellKey(cx, cz)].push_back(d);
+            }
+        }
+
+        // Attributs par carrefour (racine) : centre, rond-point, feu
+        for (const WayDef& w : ways) {
+            if (!w.roundabout) continue;
+            for (uint32_t i = 0; i < w.refCount; ++i) {
+                int d = refs[w.firstRef + i];
+                if (hasCoords[d]) roundaboutRoots.insert(Find(d));
+            }
+        }
+        for (int d = 0; d < count; ++d) {
+            if (!hasCoords[d]) continue;
+            int root = Find(d);
+            bool ring = roundaboutRoots.count(root) > 0;
+            // Centre : carrefours seuls, ou tous les points de l'anneau pour un rond-point
+            if (!ring && !IsJunction(d)) continue;
+            Centre& c = centres[root];
+            c.sx += x[d];
+            c.sz += z[d];
+            c.count++;
+            if (signal[d]) c.signal = true;
+        }
+
+        // Feu posé juste avant le carrefour (cas courant) : rattaché au carrefour le plus proche de sa voie
+        const float reach = 2.0f * cell;
+        for (const WayDef& w : ways) {
+            int previous = -1;
+            for (uint32_t i = 0; i < w.refCount; ++i) {
+                int d = refs[w.firstRef + i];
+                if (!hasCoords[d]) { previous = -1; continue; }
+                if (IsJunction(d)) { previous = d; continue; }
+                if (!signal[d]) continue;
+                int next = -1;
+                for (uint32_t j = i + 1; j < w.refCount && next < 0; ++j) {
+                    int e = refs[w.firstRef + j];
+                    if (!hasCoords[e]) break;
+                    if (IsJunction(e)) next = e;
+                }
+                int best = -1;
+                float bestDist = reach * reach;
+                for (int candidate : {previous, next}) {
+                    if (candidate < 0) continue;
+                    float dx = x[candidate] - x[d], dz = z[candidate] - z[d];
+                    if (dx * dx + dz * dz <= bestDist) {
+                        bestDist = dx * dx + dz * dz;
+                        best = candidate;
+                    }
+                }
+                if (best >= 0) centres[Find(best)].signal = true;
+            }
+        }
+
+        // Rayon : étendue du carrefour fusionné (ou de l'anneau)
+        for (int d = 0; d < count; ++d) {
+            if (!hasCoords[d]) continue;
+            auto it = centres.find(Find(d));
+            if (it == centres.end()) continue;
+            Centre& c = it->second;
+            float dx = x[d] - c.sx / c.count, dz = z[d] - c.sz / c.count;
+            float dist = std::sqrt(dx * dx + dz * dz);
+            c.extent = std::max(c.extent, dist);
+            c.ringSum += dist;
+        }
+    }
+
+    struct Edge {
+        int from, to; // racines
+        int lanes;
+        bool visible;
+    };
+
+    void AddEdge(int from, int to, int lanes, bool visible) {
+        uint64_t key = (static_cast<uint64_t>(static_cast<uint32_t>(from)) << 32) | static_cast<uint32_t>(to);
+        if (!emitted.insert(key).second) return;
+        edges.push_back({from, to, lanes, visible});
+    }
+
+    // Découpage des voies entre carrefours ; les anneaux de ronds-points ne donnent aucun segment
+    void CollectSegments() {
+        for (const WayDef& w : ways) {
+            if (w.roundabout) continue;
+            int previous = -1;
+            for (uint32_t i = 0; i < w.refCount; ++i) {
+                int d = refs[w.firstRef + i];
+                if (!hasCoords[d]) { previous = -1; continue; }
+                if (!IsJunction(d)) continue;
+                if (previous >= 0) {
+                    int a = Find(previous), b = Find(d);
+                    if (a != b) {
+                        if (w.direction >= 0) AddEdge(a, b, w.lanes, true);
+                        if (w.direction <= 0) AddEdge(b, a, w.lanes, w.direction != 0);
+                    }
+                }
+                previous = d;
+            }
+        }
+    }
+
+    void Emit(RoadNetwork& outNetwork) {
+        std::unordered_map<int, Node*> created;
+        auto nodeFor = [&](int root) -> Node* {
+            auto it = created.find(root);
+            if (it != created.end()) return it->second;
+            const Centre& c = centres[root];
+            Vector3 pos = {c.sx / c.count, 0.2f, c.sz / c.count};
+            NodeType type = SIMPLE_INTERSECTION;
+            float radius = 15.0f;
+            if (roundaboutRoots.count(root)) {
+                type = ROUNDABOUT;
+                radius = std::clamp(c.ringSum / c.count, 30.0f, 120.0f);
+                ++stats.roundabouts;
+            } else {
+                if (c.signal) {
+                    type = TRAFFIC_LIGHT;
+                    radius = 20.0f;
+                    ++stats.trafficLights;
+                }
+                radius = std::max(radius, c.extent + 8.0f);
+            }
+            Node* node = outNetwork.AddNode(pos, type, radius);
+            created.emplace(root, node);
+            return node;
+        };
+
+        for (const Edge& e : edges) {
+            Node* a = nodeFor(e.from);
+            Node* b = nodeFor(e.to);
+            RoadSegment* seg = outNetwork.AddRoadSegment(a, b, e.lanes, true);
+            if (seg) seg->SetVisible(e.visible);
+        }
+    }
+
+    struct Centre {
+        float sx = 0.0f, sz = 0.0f;
+        int count = 0;
+        float extent = 0.0f;
+        float ringSum = 0.0f;
+        bool signal = false;
+    };
+
+    std::string_view xml;
+    const OsmImportOptions& options;
+    OsmImportStats& stats;
+
+    std::unordered_map<int64_t, int> index; // id OSM -> index dense des noeuds référencés
+    std::vector<int> usage;
+    std::vector<int> refs;
+    std::vector<WayDef> ways;
+    std::vector<double> lat, lon;
+    std::vector<char> hasCoords, signal;
+    std::vector<float> x, z;
+    std::vector<int> parent;
+    std::unordered_set<int> roundaboutRoots;
+    std::unordered_map<int, Centre> centres;
+    std::unordered_set<uint64_t> emitted;
+    std::vector<Edge> edges;
+};
+
+bool EndsWith(const std::string& s, const char* suffix) {
+    std::string_view sv(suffix);
+    return s.size() >= sv.size() && s.compare(s.size() - sv.size(), sv.size(), sv) == 0;
+}
+
+} // namespace
+
+bool OsmImporter::ImportFile(const std::string& path, RoadNetwork& outNetwork, const OsmImportOptions& options,
+                             OsmImportStats* stats, std::string* error) {
+    if (EndsWith(path, ".pbf")) {
+        if (error) *error = "format .osm.pbf non supporte, convertir en .osm (ex. osmium cat in.osm.pbf -o out.osm)";
+        return false;
+    }
+    MappedFile file;
+    if (!file.Open(path)) {
+        if (error) *error = file.GetError();
+        return false;
+    }
+    std::string message;
+    if (!ImportMemory(file.View(), outNetwork, options, stats, &message)) {
+        if (error) *error = path + ", " + message;
+        return false;
+    }
+    return true;
+}
+
+bool OsmImporter::ImportMemory(std::string_view xml, RoadNetwork& outNetwork, const OsmImportOptions& options,
+                               OsmImportStats* stats, std::string* error) {
+    OsmImportStats local;
+    Importer importer(xml, options, stats ? *stats : local);
+    std::string message;
+    if (!importer.Run(outNetwork, message)) {
+        if (error) *error = message;
+        return false;
+    }
+    return true;
+}
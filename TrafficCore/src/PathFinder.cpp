@@ -1,84 +1,176 @@
 #include "PathFinder.h"
 #include "RoadNetwork.h"
+#include "RoutingGraph.h"
 #include <queue>
-#include <unordered_map>
-#include <unordered_set>
 #include <vector>
+#include <limits>
 #include <algorithm>
 #include "raymath.h"
 
 struct PQItem {
-    Node* node;
+    int arc;
     float f;
     bool operator>(const PQItem& o) const { return f > o.f; }
 };
 
 PathFinder::PathFinder(const RoadNetwork* network) : network(network) {}
 
-// Coût d'une arête (RoadSegment) : longueur / (1 + k * lanes)
-static float EdgeCost(RoadSegment* seg) {
-    if (!seg) return 1e6f;
-    float len = seg->GetLength();
-    int lanes = seg->GetLanes();
-    float laneFactor = 1.0f / (1.0f + 0.18f * static_cast<float>(lanes));
-    return len * laneFactor;
+// Coût d'une arête (RoadSegment) : temps de parcours publié par le réseau.
+static float EdgeCost(const EdgeWeights& weights, int segmentIndex) {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(weights.seconds.size())) return 1e6f;
+    return weights.seconds[segmentIndex];
 }
 
-std::vector<Node*> PathFinder::FindPath(Node* start, Node* end) const {
-    if (!network || !start || !end) return {};
-    if (start == end) return {start};
+// Recherche sur le graphe des arcs (line graph) : l'état est le segment parcouru,
+// une transition e -> f coûte la manoeuvre au noeud commun puis le parcours de f.
+std::vector<int> PathFinder::Search(const RoutingGraph& graph, const EdgeWeights& weights, int from, int to) {
+    const int n = graph.GetNodeCount();
+    const int m = graph.GetEdgeCount();
+    if (from < 0 || to < 0 || from >= n || to >= n || from == to) return {};
 
-    auto heuristic = [](Node* a, Node* b) {
-        Vector3 pa = a->GetPosition();
-        Vector3 pb = b->GetPosition();
-        return Vector3Distance(pa, pb);
+    // Distance à vol d'oiseau / vitesse max observée : ne surestime jamais le temps restant
+    const float invMaxSpeed = 1.0f / weights.maxSpeed;
+    const Vector3 goal = graph.GetPosition(to);
+    auto heuristic = [&](int u) {
+        return Vector3Distance(graph.GetPosition(u), goal) * invMaxSpeed;
     };
 
-    std::priority_queue<PQItem, std::vector<PQItem>, std::greater<PQItem>> openQueue;
-    std::unordered_map<Node*, Node*> cameFrom;
-    std::unordered_map<Node*, float> gScore;
-    std::unordered_set<Node*> closedSet;
+    const float INF = std::numeric_limits<float>::infinity();
+    std::vector<float> gScore(m, INF); // coût pour avoir parcouru l'arc en entier
+    std::vector<int> cameFrom(m, -1);  // arc précédent
+    std::vector<char> closed(m, 0);
 
-    gScore[start] = 0.0f;
-    openQueue.push(PQItem{start, heuristic(start, end)});
+    std::priority_queue<PQItem, std::vector<PQItem>, std::greater<PQItem>> openQueue;
+    for (int e = graph.EdgeBegin(from); e < graph.EdgeEnd(from); ++e) {
+        gScore[e] = EdgeCost(weights, graph.EdgeSegment(e));
+        openQueue.push(PQItem{e, gScore[e] + heuristic(graph.EdgeTarget(e))});
+    }
 
     while (!openQueue.empty()) {
-        Node* current = openQueue.top().node;
+        int current = openQueue.top().arc;
         openQueue.pop();
 
-        if (current == end) {
-            std::vector<Node*> path;
-            Node* it = end;
-            while (it) {
-                path.push_back(it);
-                auto found = cameFrom.find(it);
-                if (found == cameFrom.end()) break;
-                it = found->second;
+        if (closed[current]) continue;
+        closed[current] = 1;
+
+        int v = graph.EdgeTarget(current);
+        if (v == to) {
+            std::vector<int> route;
+            for (int e = current; e != -1; e = cameFrom[e]) {
+                route.push_back(graph.EdgeSegment(e));
+            }
+            std::reverse(route.begin(), route.end());
+            return route;
+        }
+
+        for (int f = graph.EdgeBegin(v); f < graph.EdgeEnd(v); ++f) {
+            if (closed[f]) continue;
+            uint16_t movement = graph.GetMovement(current, f);
+            if (RoutingGraph::IsForbidden(movement)) continue;
+
+            float tentative_g = gScore[current] + RoutingGraph::MovementSeconds(movement)
+                              + EdgeCost(weights, graph.EdgeSegment(f));
+            if (tentative_g < gScore[f]) {
+                cameFrom[f] = current;
+                gScore[f] = tentative_g;
+                openQueue.push(PQItem{f, tentative_g + heuristic(graph.EdgeTarget(f))});
             }
-            std::reverse(path.begin(), path.end());
-            return path;
         }
+    }
+    return {};
+}
+
+// Recherche arrière : l'état est l'arc, dist = temps pour parcourir l'arc puis rejoindre la destination.
+// Un arc sortant d'une source, dépilé en premier, donne directement l'unité la plus rapide.
+PathFinder::SourceMatch PathFinder::SearchNearestSource(const RoutingGraph& graph, const EdgeWeights& weights,
+                                                        const std::vector<int>& sources, int to) {
+    SourceMatch match;
+    const int n = graph.GetNodeCount();
+    const int m = graph.GetEdgeCount();
+    if (to < 0 || to >= n) return match;
 
-        if (closedSet.find(current) != closedSet.end()) continue;
-        closedSet.insert(current);
+    std::vector<char> isSource(n, 0);
+    for (int s : sources) {
+        if (s < 0 || s >= n) continue;
+        if (s == to) { // déjà sur place
+            match.source = s;
+            return match;
+        }
+        isSource[s] = 1;
+    }
 
-        for (RoadSegment* seg : current->GetConnectedRoads()) {
-            if (!seg) continue;
-            Node* neighbor = (seg->GetStartNode() == current) ? seg->GetEndNode() : seg->GetStartNode();
-            if (!neighbor) continue;
-            if (closedSet.find(neighbor) != closedSet.end()) continue;
+    const float INF = std::numeric_limits<float>::infinity();
+    std::vector<float> dist(m, INF);
+    std::vector<int> nextArc(m, -1); // arc suivant vers la destination
+    std::vector<char> closed(m, 0);
 
-            float tentative_g = gScore[current] + EdgeCost(seg);
+    std::priority_queue<PQItem, std::vector<PQItem>, std::greater<PQItem>> openQueue;
+    for (int i = graph.InEdgeBegin(to); i < graph.InEdgeEnd(to); ++i) {
+        int e = graph.InEdge(i);
+        dist[e] = EdgeCost(weights, graph.EdgeSegment(e));
+        openQueue.push(PQItem{e, dist[e]});
+    }
 
-            auto itg = gScore.find(neighbor);
-            if (itg == gScore.end() || tentative_g < itg->second) {
-                cameFrom[neighbor] = current;
-                gScore[neighbor] = tentative_g;
-                float f = tentative_g + heuristic(neighbor, end);
-                openQueue.push(PQItem{neighbor, f});
+    while (!openQueue.empty()) {
+        int current = openQueue.top().arc;
+        openQueue.pop();
+
+        if (closed[current]) continue;
+        closed[current] = 1;
+        if (dist[current] == INF) break; // le reste est fermé
+
+        int u = graph.EdgeSource(current);
+        if (isSource[u]) {
+            match.source = u;
+            match.seconds = dist[current];
+            for (int e = current; e != -1; e = nextArc[e]) {
+                match.route.push_back(graph.EdgeSegment(e));
+            }
+            return match;
+        }
+
+        for (int i = graph.InEdgeBegin(u); i < graph.InEdgeEnd(u); ++i) {
+            int d = graph.InEdge(i);
+            if (closed[d]) continue;
+            uint16_t movement = graph.GetMovement(d, current);
+            if (RoutingGraph::IsForbidden(movement)) continue;
+
+            float tentative = dist[current] + RoutingGraph::MovementSeconds(movement)
+                            + EdgeCost(weights, graph.EdgeSegment(d));
+            if (tentative < dist[d]) {
+                nextArc[d] = current;
+                dist[d] = tentative;
+                openQueue.push(PQItem{d, tentative});
             }
         }
     }
+    return match;
+}
 
-    return {};
+std::vector<Node*> PathFinder::FindPath(Node* start, Node* end) const {
+    if (!network || !start || !end) return {};
+    if (start == end) return {start};
+
+    std::deque<RoadSegment*> route = FindRoute(start, end);
+    if (route.empty()) return {};
+
+    std::vector<Node*> path;
+    path.reserve(route.size() + 1);
+    path.push_back(start);
+    for (RoadSegment* seg : route) path.push_back(seg->GetEndNode());
+    return path;
+}
+
+std::deque<RoadSegment*> PathFinder::FindRoute(Node* start, Node* end) const {
+    if (!network || !start || !end || start == end) return {};
+
+    // Une seule version des poids pour toute la requête
+    std::shared_ptr<const RoutingGraph> graph = network->GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network->GetEdgeWeights();
+
+    std::deque<RoadSegment*> route;
+    for (int idx : Search(*graph, *weights, graph->IndexOf(start), graph->IndexOf(end))) {
+        route.push_back(graph->GetSegment(idx));
+    }
+    return route;
 }
@@ -0,0 +1,72 @@
+#include "PathService.h"
+#include "DStarLite.h"
+#include "PathFinder.h"
+#include "RoadNetwork.h"
+#include "RouteSet.h"
+#include "RoutingGraph.h"
+
+PathService& PathService::GetInstance() {
+    static PathService instance;
+    return instance;
+}
+
+PathService::PathService(unsigned workerCount) : pool(workerCount) {}
+
+RouteTicket PathService::RequestRoute(const RoadNetwork& network, Node* start, Node* end) {
+    std::shared_ptr<const RoutingGraph> graph = network.GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network.GetEdgeWeights();
+    int from = graph->IndexOf(start);
+    int to = graph->IndexOf(end);
+
+    // Requête invalide : ticket immédiatement prêt, sans passer par la file
+    if (from < 0 || to < 0 || from == to) {
+        std::promise<RouteResult> done;
+        done.set_value(RouteResult{graph->GetVersion(), {}});
+        return done.get_future().share();
+    }
+
+    return pool.Submit([graph, weights, from, to]() {
+        RouteResult result;
+        result.topologyVersion = graph->GetVersion();
+        for (int idx : PathFinder::Search(*graph, *weights, from, to)) {
+            result.route.push_back(graph->GetSegment(idx));
+        }
+        return result;
+    }).share();
+}
+
+PlannerTicket PathService::RequestPlanner(const RoadNetwork& network, Node* start, Node* goal) {
+    std::shared_ptr<const RoutingGraph> graph = network.GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network.GetEdgeWeights();
+    int from = graph->IndexOf(start);
+    int to = graph->IndexOf(goal);
+
+    if (from < 0 || to < 0 || from == to) {
+        std::promise<std::shared_ptr<DStarLite>> done;
+        done.set_value(nullptr);
+        return done.get_future().share();
+    }
+
+    return pool.Submit([graph, weights, from, to]() {
+        auto planner = std::make_shared<DStarLite>(graph, weights, from, to);
+        planner->ComputeShortestPath();
+        return planner;
+    }).share();
+}
+
+RouteSetTicket PathService::RequestRouteSet(const RoadNetwork& network, Node* start, Node* end, int k) {
+    std::shared_ptr<const RoutingGraph> graph = network.GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network.GetEdgeWeights();
+    int from = graph->IndexOf(start);
+    int to = graph->IndexOf(end);
+
+    if (from < 0 || to < 0 || from == to) {
+        std::promise<std::shared_ptr<const RouteSet>> done;
+        done.set_value(nullptr);
+        return done.get_future().share();
+    }
+
+    return pool.Submit([graph, weights, from, to, k]() {
+        return RouteSet::Build(*graph, *weights, from, to, k);
+    }).share();
+}
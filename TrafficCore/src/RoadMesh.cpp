@@ -0,0 +1,251 @@
+#include "RoadMesh.h"
+#include "RoadNetwork.h"
+#include "core/CellKey.h"
+#include "raymath.h"
+#include <cmath>
+#include <cstring>
+#include <unordered_set>
+
+RoadMesh::~RoadMesh() {
+    if (IsWindowReady()) {
+        Release();
+        return;
+    }
+    // Contexte déjà fermé (CloseWindow) : les buffers GPU sont partis avec lui
+    for (auto& entry : tiles) {
+        if (entry.second.uploaded) MemFree(entry.second.mesh.vboId);
+    }
+    if (hasMaterial) MemFree(material.maps);
+    if (hasLightMeshes) {
+        for (int i = 0; i < kLightPartCount; ++i) {
+            Mesh& m = lightMeshes[i];
+            MemFree(m.vertices);
+            MemFree(m.normals);
+            MemFree(m.texcoords);
+            MemFree(m.indices);
+            MemFree(m.vboId);
+            MemFree(lightMaterials[i].maps);
+        }
+    }
+}
+
+int64_t RoadMesh::TileOf(Vector3 position) {
+    const int64_t x = static_cast<int64_t>(std::floor(position.x / kTileSize));
+    const int64_t z = static_cast<int64_t>(std::floor(position.z / kTileSize));
+    return CellKey(x, z);
+}
+
+int RoadMesh::Sync(const RoadNetwork& network) {
+    if (version == network.GetTopologyVersion()) return 0;
+
+    std::vector<int> nodeSlots, segmentSlots;
+    const bool incremental = version != 0 && network.GetEditsSince(version, nodeSlots, segmentSlots);
+    std::unordered_set<int64_t> dirty;
+    auto markSlots = [&]() {
+        for (int slot : segmentSlots) {
+            if (slot < static_cast<int>(segmentTile.size())) dirty.insert(segmentTile[slot]);
+        }
+        for (int slot : nodeSlots) {
+            if (slot < static_cast<int>(nodeTile.size())) dirty.insert(nodeTile[slot]);
+        }
+    };
+    // Tuiles de l'ancien contenu des emplacements, puis du nouveau
+    if (incremental) markSlots();
+
+    const auto& segments = network.GetRoadSegments();
+    const auto& nodes = network.GetNodes();
+    segmentTile.resize(segments.size());
+    nodeTile.resize(nodes.size());
+    for (size_t i = 0; i < segments.size(); ++i) {
+        segmentTile[i] = TileOf(Vector3Lerp(segments[i]->GetStartPos(), segments[i]->GetEndPos(), 0.5f));
+    }
+    for (size_t i = 0; i < nodes.size(); ++i) nodeTile[i] = TileOf(nodes[i]->GetPosition());
+    if (incremental) markSlots();
+
+    for (auto& entry : tiles) {
+        entry.second.segments.clear();
+        entry.second.intersections.clear();
+    }
+    for (size_t i = 0; i < segments.size(); ++i) tiles[segmentTile[i]].segments.push_back(static_cast<int>(i));
+    const auto& intersections = network.GetIntersections();
+    for (size_t i = 0; i < intersections.size(); ++i) {
+        const int node = network.GetNodeIndex(intersections[i]->GetNode());
+        if (node >= 0) tiles[nodeTile[node]].intersections.push_back(static_cast<int>(i));
+    }
+
+    int rebuilt = 0;
+    for (auto it = tiles.begin(); it != tiles.end();) {
+        Tile& tile = it->second;
+        if (incremental && !dirty.count(it->first)) {
+            ++it;
+            continue;
+        }
+        Unload(tile);
+        if (tile.segments.empty() && tile.intersections.empty()) {
+            it = tiles.erase(it);
+            continue;
+        }
+        // Routes d'abord, carrefours ensuite (par-dessus pour masquer les raccords)
+        tile.geometry.Clear();
+        for (int s : tile.segments) segments[s]->Bake(tile.geometry);
+        for (int k : tile.intersections) intersections[k]->Bake(tile.geometry);
+        tile.vertexCount = tile.geometry.GetVertexCount();
+        tile.bounds = tile.geometry.GetBounds();
+        BakeLights(tile, network);
+        ++rebuilt;
+        ++it;
+    }
+    version = network.GetTopologyVersion();
+    return rebuilt;
+}
+
+void RoadMesh::BakeLights(Tile& tile, const RoadNetwork& network) {
+    const auto& intersections = network.GetIntersections();
+    std::vector<Matrix> poles, boxes, lamps;
+    tile.lightNodes.clear();
+    for (int k : tile.intersections) {
+        const Node* node = intersections[k]->GetNode();
+        TrafficLightProp props[4];
+        const int count = node->GetLightProps(props);
+        if (count == 0) continue;
+        tile.lightNodes.push_back(node);
+        const BoundingBox lights = node->GetLightBounds();
+        tile.bounds.min = Vector3Min(tile.bounds.min, lights.min);
+        tile.bounds.max = Vector3Max(tile.bounds.max, lights.max);
+        for (int i = 0; i < count; ++i) {
+            const TrafficLightProp& p = props[i];
+            // Cylindre de GenMeshCylinder posé sur son pied, comme DrawCylinder
+            poles.push_back(MatrixTranslate(p.pole.x, p.pole.y, p.pole.z));
+            const Matrix place = MatrixTranslate(p.box.x, p.box.y, p.box.z);
+            boxes.push_back(p.faceX ? MatrixMultiply(MatrixRotateY(PI / 2.0f), place) : place);
+            for (int lamp = 0; lamp < 3; ++lamp) {
+                lamps.push_back(MatrixTranslate(p.box.x + p.lampOffset.x, p.box.y + Node::kLampSpacing * (1 - lamp),
+                                                p.box.z + p.lampOffset.z));
+            }
+        }
+    }
+    tile.poles.SetTransforms(std::move(poles));
+    tile.boxes.SetTransforms(std::move(boxes));
+    tile.lamps.SetTransforms(std::move(lamps));
+}
+
+void RoadMesh::Upload(Tile& tile) {
+    Mesh mesh = {};
+    mesh.vertexCount = tile.vertexCount;
+    mesh.triangleCount = tile.vertexCount / 3;
+    const auto& vertices = tile.geometry.GetVertices();
+    const auto& colors = tile.geometry.GetColors();
+    mesh.vertices = static_cast<float*>(MemAlloc(static_cast<unsigned int>(vertices.size() * sizeof(float))));
+    mesh.colors = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(colors.size())));
+    std::memcpy(mesh.vertices, vertices.data(), vertices.size() * sizeof(float));
+    std::memcpy(mesh.colors, colors.data(), colors.size());
+    UploadMesh(&mesh, false);
+
+    // Copie CPU inutile une fois sur le GPU
+    MemFree(mesh.vertices);
+    MemFree(mesh.colors);
+    mesh.vertices = nullptr;
+    mesh.colors = nullptr;
+    tile.geometry = RoadMeshBuilder();
+    tile.mesh = mesh;
+    tile.uploaded = true;
+}
+
+void RoadMesh::Unload(Tile& tile) {
+    if (tile.uploaded) UnloadMesh(tile.mesh);
+    tile.mesh = {};
+    tile.uploaded = false;
+    tile.vertexCount = 0;
+}
+
+void RoadMesh::Draw(const Frustum* view) {
+    if (!hasMaterial) {
+        material = LoadMaterialDefault(); // couleurs par sommet, texture blanche
+        hasMaterial = true;
+    }
+    const Matrix identity = MatrixIdentity();
+    stats.Reset();
+    for (auto& entry : tiles) {
+        Tile& tile = entry.second;
+        if (tile.vertexCount == 0) continue;
+        if (view && !view->IntersectsBox(tile.bounds)) {
+            ++stats.frustumCulled; // envoi au GPU différé jusqu'à ce qu'elle soit visible
+            continue;
+        }
+        ++stats.drawn;
+        if (!tile.uploaded) Upload(tile);
+        DrawMesh(tile.mesh, material, identity);
+    }
+}
+
+bool RoadMesh::DrawLights(const Frustum* view) {
+    if (!InstanceBatch::IsAvailable()) return false;
+    if (!hasLightMeshes) {
+        // Mêmes volumes que Node::Draw : poteau, boîtier face à Z, lampe
+        lightMeshes[kPole] = GenMeshCylinder(1.0f, Node::kPoleHeight, 8);
+        lightMeshes[kBox] = GenMeshCube(2.2f, 6.0f, 1.6f);
+        lightMeshes[kLamp] = GenMeshSphere(0.9f, 8, 8);
+        const Color colors[kLightPartCount] = {DARKGRAY, BLACK, WHITE}; // lampes : couleur par instance
+        for (int i = 0; i < kLightPartCount; ++i) {
+            lightMaterials[i] = LoadMaterialDefault();
+            lightMaterials[i].maps[MATERIAL_MAP_DIFFUSE].color = colors[i];
+        }
+        hasLightMeshes = true;
+    }
+    Color lamp[3];
+    for (auto& entry : tiles) {
+        Tile& tile = entry.second;
+        if (tile.lightNodes.empty()) continue;
+        if (view && !view->IntersectsBox(tile.bounds)) continue;
+        lampColors.clear();
+        for (const Node* node : tile.lightNodes) {
+            node->GetLampColors(lamp);
+            for (int corner = 0; corner < 4; ++corner) lampColors.insert(lampColors.end(), lamp, lamp + 3);
+        }
+        tile.lamps.SetColors(lampColors); // envoyé seulement si un feu a changé
+        tile.poles.Draw(lightMeshes[kPole], lightMaterials[kPole]);
+        tile.boxes.Draw(lightMeshes[kBox], lightMaterials[kBox]);
+        tile.lamps.Draw(lightMeshes[kLamp], lightMaterials[kLamp]);
+    }
+    return true;
+}
+
+void RoadMesh::ReleaseLightMeshes() {
+    if (!hasLightMeshes) return;
+    for (int i = 0; i < kLightPartCount; ++i) {
+        UnloadMesh(lightMeshes[i]);
+        UnloadMaterial(lightMaterials[i]);
+        lightMeshes[i] = {};
+        lightMaterials[i] = {};
+    }
+    hasLightMeshes = false;
+}
+
+void RoadMesh::Release() {
+    ReleaseLightMeshes();
+    for (auto& entry : tiles) Unload(entry.second);
+    tiles.clear();
+    segmentTile.clear();
+    nodeTile.clear();
+    version = 0;
+    if (hasMaterial) UnloadMaterial(material);
+    hasMaterial = false;
+}
+
+int RoadMesh::GetDrawCallCount() const {
+    int count = 0;
+    for (const auto& entry : tiles) count += entry.second.vertexCount > 0 ? 1 : 0;
+    return count;
+}
+
+int RoadMesh::GetLightCount() const {
+    int count = 0;
+    for (const auto& entry : tiles) count += static_cast<int>(entry.second.lightNodes.size());
+    return count;
+}
+
+int RoadMesh::GetVertexCount() const {
+    int count = 0;
+    for (const auto& entry : tiles) count += entry.second.vertexCount;
+    return count;
+}
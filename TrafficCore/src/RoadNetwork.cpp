@@ -16,21 +16,75 @@ RoadNetwork::~RoadNetwork() {
 }
 
 Node* RoadNetwork::AddNode(Vector3 position, NodeType type, float radius) {
-    auto node = std::make_unique<Node>(nextNodeId++, position, type, radius);
+    return AddNodeWithId(nextNodeId, position, type, radius);
+}
+
+Node* RoadNetwork::AddNodeWithId(int id, Vector3 position, NodeType type, float radius) {
+    if (id > kMaxNodeId) {
+        std::cerr << "Erreur: id de noeud hors limites (" << id << ")" << std::endl;
+        return nullptr;
+    }
+    if (!IndexNode(id, static_cast<int>(nodes.size()))) {
+        std::cerr << "Erreur: id de noeud deja utilise (" << id << ")" << std::endl;
+        return nullptr;
+    }
+    auto node = std::make_unique<Node>(id, position, type, radius);
     Node* nodePtr = node.get();
     nodes.push_back(std::move(node));
+    nextNodeId = std::max(nextNodeId, id + 1);
+    ++topologyVersion;
+    TouchNode(static_cast<int>(nodes.size()) - 1);
     return nodePtr;
 }
 
+bool RoadNetwork::IndexNode(int id, int position) {
+    if (FindNodeById(id)) return false;
+    // Ids compacts : tableau direct, agrandi au besoin ; au-delà, table de hachage
+    const int denseLimit = kDenseIdSlack + 2 * static_cast<int>(nodes.size());
+    if (id >= 0 && id < denseLimit) {
+        if (id >= static_cast<int>(denseNodeIndex.size())) denseNodeIndex.resize(id + 1, -1);
+        denseNodeIndex[id] = position;
+    } else {
+        sparseNodeIndex[id] = position;
+    }
+    return true;
+}
+
+void RoadNetwork::UnindexNode(int id) {
+    if (id >= 0 && id < static_cast<int>(denseNodeIndex.size())) denseNodeIndex[id] = -1;
+    sparseNodeIndex.erase(id);
+}
+
 RoadSegment* RoadNetwork::AddRoadSegment(Node* start, Node* end, int lanes, bool curved) {
     if (!start || !end) {
         std::cerr << "Erreur: Tentative d'ajout d'un segment avec des noeuds null" << std::endl;
         return nullptr;
     }
     
-    auto segment = std::make_unique<RoadSegment>(start, end, lanes, curved);
+    return RegisterSegment(std::make_unique<RoadSegment>(start, end, lanes, curved));
+}
+
+RoadSegment* RoadNetwork::AddBakedRoadSegment(Node* start, Node* end, int lanes, const Vector3* controls,
+                                              int controlCount, std::vector<RoadSegment::Sidewalk> sidewalks) {
+    if (!start || !end || !controls || (controlCount != 2 && controlCount != 4)) {
+        std::cerr << "Erreur: segment precalcule invalide" << std::endl;
+        return nullptr;
+    }
+    return RegisterSegment(std::make_unique<RoadSegment>(start, end, lanes, controls, controlCount,
+                                                         std::move(sidewalks)));
+}
+
+RoadSegment* RoadNetwork::RegisterSegment(std::unique_ptr<RoadSegment> segment) {
     RoadSegment* segmentPtr = segment.get();
+    segmentPtr->SetIndex(static_cast<int>(roadSegments.size()));
     roadSegments.push_back(std::move(segment));
+    ++topologyVersion;
+    TouchSegment(segmentPtr->GetIndex());
+    TouchNode(GetNodeIndex(segmentPtr->GetStartNode()));
+    TouchNode(GetNodeIndex(segmentPtr->GetEndNode()));
+
+    travelTimes.AddSegment(TravelTimeTable::FreeFlowSeconds(segmentPtr->GetLength(), segmentPtr->GetLanes()),
+                           Vector3Distance(segmentPtr->GetStartPos(), segmentPtr->GetEndPos()));
     return segmentPtr;
 }
 
@@ -43,20 +97,334 @@ Intersection* RoadNetwork::AddIntersection(Node* node) {
     auto intersection = std::make_unique<Intersection>(node);
     Intersection* intersectionPtr = intersection.get();
     intersections.push_back(std::move(intersection));
+    ++topologyVersion; // dalle ou rond-point à cuire
+    TouchNode(GetNodeIndex(node));
     return intersectionPtr;
 }
 
-Node* RoadNetwork::FindNodeById(int id) const {
-    for (const auto& node : nodes) {
-        if (node->GetId() == id) {
-            return node.get();
+void RoadNetwork::AddTurnRestriction(int fromNodeId, int viaNodeId, int toNodeId) {
+    turnRestrictions.push_back({fromNodeId, viaNodeId, toNodeId});
+    ++topologyVersion;
+    TouchNode(GetNodeIndex(FindNodeById(viaNodeId)));
+}
+
+bool RoadNetwork::RemoveTurnRestriction(int fromNodeId, int viaNodeId, int toNodeId) {
+    auto it = std::find_if(turnRestrictions.begin(), turnRestrictions.end(), [&](const TurnRestriction& r) {
+        return r.fromNodeId == fromNodeId && r.viaNodeId == viaNodeId && r.toNodeId == toNodeId;
+    });
+    if (it == turnRestrictions.end()) return false;
+    turnRestrictions.erase(it);
+    ++topologyVersion;
+    TouchNode(GetNodeIndex(FindNodeById(viaNodeId)));
+    return true;
+}
+
+void RoadNetwork::SetUTurnsAllowed(bool allowed) {
+    if (uTurnsAllowed == allowed) return;
+    uTurnsAllowed = allowed;
+    ++topologyVersion;
+    ResetJournal(); // toutes les manoeuvres changent
+}
+
+void RoadNetwork::TouchNode(int index) {
+    if (index < 0) return;
+    TrimJournal();
+    editJournal.push_back({topologyVersion, index, false});
+}
+
+void RoadNetwork::TouchSegment(int index) {
+    if (index < 0) return;
+    TrimJournal();
+    editJournal.push_back({topologyVersion, index, true});
+}
+
+void RoadNetwork::TrimJournal() {
+    // Journal plein : on oublie la moitié la plus ancienne, les instantanés récents restent corrigeables
+    if (editJournal.size() < kEditJournalLimit) return;
+    const size_t dropped = editJournal.size() / 2;
+    journalStart = std::max(journalStart, editJournal[dropped - 1].version);
+    editJournal.erase(editJournal.begin(), editJournal.begin() + dropped);
+}
+
+void RoadNetwork::ResetJournal() {
+    editJournal.clear();
+    journalStart = topologyVersion;
+}
+
+bool RoadNetwork::GetEditsSince(uint64_t version, std::vector<int>& nodeSlots, std::vector<int>& segmentSlots) const {
+    nodeSlots.clear();
+    segmentSlots.clear();
+    if (version < journalStart) return false;
+    for (const Edit& e : editJournal) {
+        if (e.version <= version) continue;
+        (e.segment ? segmentSlots : nodeSlots).push_back(e.index);
+    }
+    for (auto* slots : {&nodeSlots, &segmentSlots}) {
+        std::sort(slots->begin(), slots->end());
+        slots->erase(std::unique(slots->begin(), slots->end()), slots->end());
+    }
+    // Au-delà d'un huitième du réseau, reconstruire coûte moins cher que corriger
+    return nodeSlots.size() <= nodes.size() / 8 + 64 && segmentSlots.size() <= roadSegments.size() / 8 + 64;
+}
+
+void RoadNetwork::RemoveSegmentAt(int index) {
+    RoadSegment* segment = roadSegments[index].get();
+    TouchSegment(index);
+    TouchNode(GetNodeIndex(segment->GetStartNode()));
+    TouchNode(GetNodeIndex(segment->GetEndNode()));
+    segment->Detach();
+    travelTimes.RemoveSegment(index);
+    retiredSegments.push_back(std::move(roadSegments[index]));
+
+    const int last = static_cast<int>(roadSegments.size()) - 1;
+    if (index != last) {
+        roadSegments[index] = std::move(roadSegments[last]);
+        RoadSegment* moved = roadSegments[index].get();
+        moved->SetIndex(index);
+        TouchSegment(last);
+        TouchNode(GetNodeIndex(moved->GetStartNode()));
+        TouchNode(GetNodeIndex(moved->GetEndNode()));
+    }
+    roadSegments.pop_back();
+    segment->SetIndex(-1);
+}
+
+bool RoadNetwork::RemoveRoadSegment(RoadSegment* segment) {
+    if (!IsLive(segment)) {
+        std::cerr << "Erreur: segment absent du reseau" << std::endl;
+        return false;
+    }
+    ++topologyVersion;
+    RemoveSegmentAt(segment->GetIndex());
+    travelTimes.Publish();
+    return true;
+}
+
+bool RoadNetwork::RemoveNode(Node* node) {
+    const int index = GetNodeIndex(node);
+    if (index < 0) {
+        std::cerr << "Erreur: noeud absent du reseau" << std::endl;
+        return false;
+    }
+    ++topologyVersion;
+
+    // Copie : chaque retrait modifie la liste des routes connectées (boucle présente deux fois)
+    const std::vector<RoadSegment*> roads = node->GetConnectedRoads();
+    for (RoadSegment* road : roads) {
+        if (IsLive(road)) RemoveSegmentAt(road->GetIndex());
+    }
+    for (auto it = intersections.begin(); it != intersections.end();) {
+        if ((*it)->GetNode() == node) {
+            retiredIntersections.push_back(std::move(*it));
+            it = intersections.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    const int id = node->GetId();
+    for (auto it = turnRestrictions.begin(); it != turnRestrictions.end();) {
+        if (it->fromNodeId == id || it->viaNodeId == id || it->toNodeId == id) {
+            if (it->viaNodeId != id) TouchNode(GetNodeIndex(FindNodeById(it->viaNodeId)));
+            it = turnRestrictions.erase(it);
+        } else {
+            ++it;
+        }
+    }
+
+    // Échange avec le dernier noeud : lui et ses voisins changent d'index
+    TouchNode(index);
+    UnindexNode(id);
+    retiredNodes.push_back(std::move(nodes[index]));
+    const int last = static_cast<int>(nodes.size()) - 1;
+    if (index != last) {
+        nodes[index] = std::move(nodes[last]);
+        Node* moved = nodes[index].get();
+        UnindexNode(moved->GetId());
+        IndexNode(moved->GetId(), index);
+        TouchNode(last);
+        for (RoadSegment* road : moved->GetConnectedRoads()) {
+            TouchNode(GetNodeIndex(road->GetStartNode() == moved ? road->GetEndNode() : road->GetStartNode()));
         }
     }
-    return nullptr;
+    nodes.pop_back();
+    travelTimes.Publish();
+    return true;
+}
+
+void RoadNetwork::RebuildAround(int nodeIndex) {
+    Node* node = nodes[nodeIndex].get();
+    TouchNode(nodeIndex);
+    for (RoadSegment* road : node->GetConnectedRoads()) {
+        road->Rebuild();
+        RefreshSegment(road);
+    }
+    for (const auto& intersection : intersections) {
+        if (intersection->GetNode() == node) intersection->Rebuild();
+    }
+    travelTimes.Publish();
+}
+
+bool RoadNetwork::MoveNode(Node* node, Vector3 position) {
+    const int index = GetNodeIndex(node);
+    if (index < 0) {
+        std::cerr << "Erreur: noeud absent du reseau" << std::endl;
+        return false;
+    }
+    ++topologyVersion;
+    node->SetPosition(position);
+    RebuildAround(index);
+    return true;
+}
+
+bool RoadNetwork::SetNodeShape(Node* node, NodeType type, float radius) {
+    const int index = GetNodeIndex(node);
+    if (index < 0 || !(radius > 0.0f)) {
+        std::cerr << "Erreur: modification de noeud invalide" << std::endl;
+        return false;
+    }
+    ++topologyVersion;
+    node->SetType(type);
+    node->SetRadius(radius);
+    RebuildAround(index);
+    return true;
+}
+
+bool RoadNetwork::SetSegmentLanes(RoadSegment* segment, int lanes) {
+    if (!IsLive(segment) || lanes < 1) {
+        std::cerr << "Erreur: modification de segment invalide" << std::endl;
+        return false;
+    }
+    ++topologyVersion;
+    segment->SetLanes(lanes);
+    RefreshSegment(segment);
+    travelTimes.Publish();
+    return true;
+}
+
+bool RoadNetwork::SetSegmentCurved(RoadSegment* segment, bool curved) {
+    if (!IsLive(segment)) {
+        std::cerr << "Erreur: modification de segment invalide" << std::endl;
+        return false;
+    }
+    if (segment->IsCurved() == curved) return true;
+    segment->SetCurved(curved);
+    // Sans rond-point aux extrémités le raccord est droit de toute façon : rien à recalculer
+    if (segment->GetStartNode()->GetType() != ROUNDABOUT && segment->GetEndNode()->GetType() != ROUNDABOUT) return true;
+    ++topologyVersion;
+    segment->Rebuild();
+    RefreshSegment(segment);
+    travelTimes.Publish();
+    return true;
+}
+
+bool RoadNetwork::SetSegmentVisible(RoadSegment* segment, bool visible) {
+    if (!IsLive(segment)) {
+        std::cerr << "Erreur: modification de segment invalide" << std::endl;
+        return false;
+    }
+    if (segment->IsVisible() == visible) return true;
+    segment->SetVisible(visible);
+    // Routage inchangé ; la version et le journal signalent la tuile à recuire
+    ++topologyVersion;
+    TouchSegment(segment->GetIndex());
+    return true;
+}
+
+void RoadNetwork::RefreshSegment(RoadSegment* segment) {
+    TouchSegment(segment->GetIndex());
+    TouchNode(GetNodeIndex(segment->GetStartNode()));
+    TouchNode(GetNodeIndex(segment->GetEndNode()));
+    travelTimes.ResetSegment(segment->GetIndex(), TravelTimeTable::FreeFlowSeconds(segment->GetLength(), segment->GetLanes()),
+                             Vector3Distance(segment->GetStartPos(), segment->GetEndPos()));
+}
+
+void RoadNetwork::ReleaseRetired() {
+    retiredIntersections.clear();
+    retiredSegments.clear();
+    retiredNodes.clear();
+}
+
+Node* RoadNetwork::FindNodeById(int id) const {
+    if (id >= 0 && id < static_cast<int>(denseNodeIndex.size()) && denseNodeIndex[id] >= 0) {
+        return nodes[denseNodeIndex[id]].get();
+    }
+    if (sparseNodeIndex.empty()) return nullptr;
+    auto it = sparseNodeIndex.find(id);
+    return it == sparseNodeIndex.end() ? nullptr : nodes[it->second].get();
+}
+
+int RoadNetwork::GetNodeIndex(const Node* node) const {
+    if (!node) return -1;
+    const int id = node->GetId();
+    int position = -1;
+    if (id >= 0 && id < static_cast<int>(denseNodeIndex.size()) && denseNodeIndex[id] >= 0) {
+        position = denseNodeIndex[id];
+    } else if (!sparseNodeIndex.empty()) {
+        auto it = sparseNodeIndex.find(id);
+        if (it != sparseNodeIndex.end()) position = it->second;
+    }
+    return position >= 0 && nodes[position].get() == node ? position : -1;
+}
+
+bool RoadNetwork::IsLive(const RoadSegment* segment) const {
+    if (!segment) return false;
+    const int index = segment->GetIndex();
+    return index >= 0 && index < static_cast<int>(roadSegments.size()) && roadSegments[index].get() == segment;
 }
 
 // RoadNetwork no longer contains pathfinding logic; use PathFinder class instead.
 
+void RoadNetwork::RecordTraversal(const RoadSegment* segment, float seconds) {
+    if (!IsLive(segment)) return;
+    travelTimes.Record(segment->GetIndex(), seconds);
+}
+
+void RoadNetwork::SetSegmentClosed(const RoadSegment* segment, bool closed) {
+    if (!IsLive(segment)) return;
+    travelTimes.SetClosed(segment->GetIndex(), closed);
+    travelTimes.Publish();
+}
+
+bool RoadNetwork::IsSegmentClosed(const RoadSegment* segment) const {
+    return IsLive(segment) && travelTimes.IsClosed(segment->GetIndex());
+}
+
+std::shared_ptr<const RoutingGraph> RoadNetwork::GetRoutingGraph() const {
+    if (!routingGraph || routingGraph->GetVersion() != topologyVersion) {
+        std::vector<int> nodeSlots, segmentSlots;
+        if (routingGraph && GetEditsSince(routingGraph->GetVersion(), nodeSlots, segmentSlots)) {
+            routingGraph = RoutingGraph::Patch(*routingGraph, *this, nodeSlots, topologyVersion);
+        } else {
+            routingGraph = RoutingGraph::Build(*this, topologyVersion);
+        }
+    }
+    return routingGraph;
+}
+
+bool RoadNetwork::AdoptRoutingGraph(std::shared_ptr<const RoutingGraph> graph) {
+    if (!graph || graph->GetVersion() != topologyVersion) return false;
+    routingGraph = std::move(graph);
+    return true;
+}
+
+std::shared_ptr<const SpatialIndex> RoadNetwork::GetSpatialIndex() const {
+    if (!spatialIndex || spatialIndex->GetVersion() != topologyVersion) {
+        std::vector<int> nodeSlots, segmentSlots;
+        if (spatialIndex && GetEditsSince(spatialIndex->GetVersion(), nodeSlots, segmentSlots)) {
+            spatialIndex = SpatialIndex::Patch(*spatialIndex, *this, nodeSlots, segmentSlots, topologyVersion);
+        } else {
+            spatialIndex = SpatialIndex::Build(*this, topologyVersion);
+        }
+    }
+    return spatialIndex;
+}
+
+bool RoadNetwork::AdoptSpatialIndex(std::shared_ptr<const SpatialIndex> index) {
+    if (!index || index->GetVersion() != topologyVersion) return false;
+    spatialIndex = std::move(index);
+    return true;
+}
+
 void RoadNetwork::Update(float deltaTime) {
     // Mettre à jour les feux de circulation
     for (const auto& node : nodes) {
@@ -68,14 +436,15 @@ void RoadNetwork::Update(float deltaTime) {
     }
 }
 
-void RoadNetwork::Draw() const {
-    // Dessiner d'abord toutes les routes
-    for (const auto& segment : roadSegments) {
-        segment->Draw();
-    }
+void RoadNetwork::Draw(const Frustum* view) const {
+    // Routes, marquages et carrefours : maillage statique, recuit seulement après une édition
+    roadMesh.Sync(*this);
+    roadMesh.Draw(view);
     
-    // Puis les intersections (par-dessus pour masquer les raccords)
+    // Feux tricolores (état variable) : instanciés par tuile, sinon un par un
+    if (roadMesh.DrawLights(view)) return;
     for (const auto& intersection : intersections) {
+        if (view && !view->IntersectsBox(intersection->GetNode()->GetLightBounds())) continue;
         intersection->Draw();
     }
 }
@@ -92,7 +461,17 @@ void RoadNetwork::Clear() {
     intersections.clear();
     roadSegments.clear();
     nodes.clear();
+    denseNodeIndex.clear();
+    sparseNodeIndex.clear();
+    turnRestrictions.clear();
+    spawnNodeIds.clear();
+    travelTimes.Clear();
     nextNodeId = 1;
+    ++topologyVersion;
+    ResetJournal();
+    routingGraph.reset();
+    spatialIndex.reset();
+    ReleaseRetired();
 }
 
 void RoadNetwork::PrintNetworkInfo() const {
@@ -1,13 +1,13 @@
 #include "RoadSegment.h"
 #include "geometry/StraightGeometry.h"
 #include "geometry/CurvedGeometry.h"
+#include "geometry/RoadMeshBuilder.h"
 #include "raymath.h"
-#include "rlgl.h"
 #include <cfloat>
 #include <cmath>
 
 RoadSegment::RoadSegment(Node* start, Node* end, int lanes, bool useCurvedConnection)
-    : startNode(start), endNode(end), lanes(lanes), laneWidth(16.0f) {
+    : startNode(start), endNode(end), lanes(lanes), laneWidth(16.0f), curvedConnection(useCurvedConnection) {
     
     CreateGeometry(useCurvedConnection);
     CreateSidewalks();
@@ -16,6 +16,46 @@ RoadSegment::RoadSegment(Node* start, Node* end, int lanes, bool useCurvedConnec
     endNode->AddConnectedRoad(this);
 }
 
+RoadSegment::RoadSegment(Node* start, Node* end, int lanes, const Vector3* controls, int controlCount,
+                         std::vector<Sidewalk> bakedSidewalks)
+    : startNode(start), endNode(end), lanes(lanes), laneWidth(16.0f), sidewalks(std::move(bakedSidewalks)) {
+
+    SetGeometry(controls, controlCount);
+    // Sans rond-point aux extrémités, le choix du raccord n'a pas laissé de trace : valeur par défaut
+    curvedConnection = controlPointCount == 4 || (start->GetType() != ROUNDABOUT && end->GetType() != ROUNDABOUT);
+
+    startNode->AddConnectedRoad(this);
+    endNode->AddConnectedRoad(this);
+}
+
+void RoadSegment::SetLanes(int count) {
+    lanes = count;
+    Rebuild();
+}
+
+void RoadSegment::Rebuild() {
+    CreateGeometry(curvedConnection);
+    sidewalks.clear();
+    CreateSidewalks();
+}
+
+void RoadSegment::Detach() {
+    startNode->RemoveConnectedRoad(this);
+    endNode->RemoveConnectedRoad(this);
+}
+
+void RoadSegment::SetGeometry(const Vector3* controls, int count) {
+    controlPointCount = (count == 4) ? 4 : 2;
+    for (int i = 0; i < controlPointCount; ++i) controlPoints[i] = controls[i];
+
+    float totalWidth = lanes * laneWidth;
+    if (controlPointCount == 4) {
+        geometry = std::make_unique<CurvedGeometry>(controls[0], controls[1], controls[2], controls[3], totalWidth);
+    } else {
+        geometry = std::make_unique<StraightGeometry>(controls[0], controls[1], totalWidth, lanes);
+    }
+}
+
 void RoadSegment::CreateGeometry(bool useCurvedConnection) {
     Vector3 startPos = startNode->GetPosition();
     Vector3 endPos = endNode->GetPosition();
@@ -46,9 +86,11 @@ void RoadSegment::CreateGeometry(bool useCurvedConnection) {
         Vector3 control1 = Vector3Add(adjustedStart, Vector3Scale(tangentStart, distance * 0.3f));
         Vector3 control2 = Vector3Add(adjustedEnd, Vector3Scale(tangentEnd, -distance * 0.3f));
 
-        geometry = std::make_unique<CurvedGeometry>(adjustedStart, control1, control2, adjustedEnd, totalWidth);
+        const Vector3 controls[4] = {adjustedStart, control1, control2, adjustedEnd};
+        SetGeometry(controls, 4);
     } else {
-        geometry = std::make_unique<StraightGeometry>(adjustedStart, adjustedEnd, totalWidth, lanes);
+        const Vector3 controls[2] = {adjustedStart, adjustedEnd};
+        SetGeometry(controls, 2);
     }
 }
 
@@ -127,7 +169,7 @@ void RoadSegment::CreateSidewalks() {
     }
 }
 
-void RoadSegment::DrawCrosswalk(Vector3 position, Vector3 direction, float roadWidth) const {
+void RoadSegment::BakeCrosswalk(RoadMeshBuilder& out, Vector3 position, Vector3 direction, float roadWidth) const {
     // Paramètres du passage piéton adaptatifs
     float stripWidth = roadWidth * 0.06f;        // 6% de la largeur de route
     float stripLength = roadWidth * 0.12f;       // 12% de la largeur de route
@@ -141,7 +183,7 @@ void RoadSegment::DrawCrosswalk(Vector3 position, Vector3 direction, float roadW
     
     Color stripColor = {255, 255, 255, 255};
     
-    // Dessiner les bandes blanches
+    // Bandes blanches
     for (int i = 0; i < numStrips; i++) {
         float offset = (i - numStrips/2.0f) * stripSpacing;
         Vector3 stripPos = Vector3Add(position, Vector3Scale(right, offset));
@@ -156,18 +198,11 @@ void RoadSegment::DrawCrosswalk(Vector3 position, Vector3 direction, float roadW
         Vector3 p3 = Vector3Subtract(Vector3Subtract(stripPos, forward), side);
         Vector3 p4 = Vector3Subtract(Vector3Add(stripPos, forward), side);
         
-        // Dessiner la bande
-        rlBegin(RL_QUADS);
-        rlColor4ub(stripColor.r, stripColor.g, stripColor.b, stripColor.a);
-        rlVertex3f(p1.x, p1.y, p1.z);
-        rlVertex3f(p2.x, p2.y, p2.z);
-        rlVertex3f(p3.x, p3.y, p3.z);
-        rlVertex3f(p4.x, p4.y, p4.z);
-        rlEnd();
+        out.Quad(p1, p2, p3, p4, stripColor);
     }
 }
 
-void RoadSegment::DrawSidewalk(const Sidewalk& sidewalk) const {
+void RoadSegment::BakeSidewalk(RoadMeshBuilder& out, const Sidewalk& sidewalk) const {
     if (sidewalk.path.size() < 2) return;
 
     Color sidewalkColor = {180, 180, 180, 255};
@@ -190,27 +225,20 @@ void RoadSegment::DrawSidewalk(const Sidewalk& sidewalk) const {
         p3.y += sidewalk.height;
         p4.y += sidewalk.height;
 
-        rlBegin(RL_QUADS);
-        rlColor4ub(sidewalkColor.r, sidewalkColor.g, sidewalkColor.b, sidewalkColor.a);
-        rlVertex3f(p1.x, p1.y, p1.z);
-        rlVertex3f(p2.x, p2.y, p2.z);
-        rlVertex3f(p4.x, p4.y, p4.z);
-        rlVertex3f(p3.x, p3.y, p3.z);
-        rlEnd();
-
-        DrawLine3D(p1, p3, borderColor);
+        out.Quad(p1, p2, p4, p3, sidewalkColor);
+        out.Line(p1, p3, borderColor);
     }
 }
 
-void RoadSegment::Draw() const {
-    if (!visible) return;
-    if (geometry) geometry->Draw();
+void RoadSegment::Bake(RoadMeshBuilder& out) const {
+    if (!visible || !geometry) return;
+    geometry->Bake(out);
     
-    // Dessiner les trottoirs
+    // Trottoirs
     for (const auto& sidewalk : sidewalks) 
-        DrawSidewalk(sidewalk);
+        BakeSidewalk(out, sidewalk);
     
-    // Dessiner les passages piétons aux extrémités
+    // Passages piétons aux extrémités
     auto roadPoints = geometry->GetPoints();
     if (roadPoints.size() >= 2) {
         float roadWidth = GetWidth();
@@ -226,7 +254,7 @@ void RoadSegment::Draw() const {
             float startOffset = startNode->GetRadius() + 3.0f;
             Vector3 crosswalkStart = Vector3Add(startPos, Vector3Scale(startDir, startOffset));
             
-            DrawCrosswalk(crosswalkStart, startDir, roadWidth);
+            BakeCrosswalk(out, crosswalkStart, startDir, roadWidth);
             
             // Passage piéton à la fin
             Vector3 endPos = roadPoints.back();
@@ -236,7 +264,7 @@ void RoadSegment::Draw() const {
             float endOffset = endNode->GetRadius() + 3.0f;
             Vector3 crosswalkEnd = Vector3Subtract(endPos, Vector3Scale(endDir, endOffset));
             
-            DrawCrosswalk(crosswalkEnd, endDir, roadWidth);
+            BakeCrosswalk(out, crosswalkEnd, endDir, roadWidth);
         }
     }
 }
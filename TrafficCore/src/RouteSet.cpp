@@ -0,0 +1,79 @@
+#include "RouteSet.h"
+#include "PathFinder.h"
+#include "RoutingGraph.h"
+#include "TravelTimeTable.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+static const float INF = std::numeric_limits<float>::infinity();
+
+float RouteSet::RouteSeconds(const RoutingGraph& graph, const EdgeWeights& weights, const std::vector<int>& route) {
+    float total = 0.0f;
+    for (size_t i = 0; i < route.size(); ++i) {
+        total += weights.seconds[route[i]];
+        if (i == 0) continue;
+        uint16_t movement = graph.GetMovement(graph.ArcOfSegment(route[i - 1]), graph.ArcOfSegment(route[i]));
+        if (RoutingGraph::IsForbidden(movement)) return INF;
+        total += RoutingGraph::MovementSeconds(movement);
+    }
+    return total;
+}
+
+// Un itinéraire qui repasse par un noeud n'est pas retenu
+static bool IsLoopless(const RoutingGraph& graph, const std::vector<int>& route) {
+    std::vector<int> visited;
+    visited.reserve(route.size() + 1);
+    visited.push_back(graph.EdgeSource(graph.ArcOfSegment(route.front())));
+    for (int seg : route) visited.push_back(graph.EdgeTarget(graph.ArcOfSegment(seg)));
+    std::sort(visited.begin(), visited.end());
+    return std::adjacent_find(visited.begin(), visited.end()) == visited.end();
+}
+
+std::shared_ptr<const RouteSet> RouteSet::Build(const RoutingGraph& graph, const EdgeWeights& weights,
+                                                int from, int to, int k) {
+    auto set = std::make_shared<RouteSet>();
+    set->topologyVersion = graph.GetVersion();
+    set->from = from;
+    set->to = to;
+    if (k <= 0) return set;
+
+    // Copie pénalisée : les poids ne font qu'augmenter, l'heuristique reste admissible
+    EdgeWeights penalized = weights;
+    float bestSeconds = INF;
+
+    for (int attempt = 0; attempt < 2 * k && static_cast<int>(set->routes.size()) < k; ++attempt) {
+        std::vector<int> route = PathFinder::Search(graph, penalized, from, to);
+        if (route.empty()) break;
+
+        for (int seg : route) penalized.seconds[seg] *= kPenalty;
+
+        float seconds = RouteSeconds(graph, weights, route);
+        if (set->routes.empty()) bestSeconds = seconds;
+        else if (seconds > bestSeconds * kMaxStretch) continue; // détour trop long
+        if (std::find(set->routes.begin(), set->routes.end(), route) != set->routes.end()) continue;
+        if (!IsLoopless(graph, route)) continue;
+        set->routes.push_back(std::move(route));
+    }
+    return set;
+}
+
+int RouteSet::Choose(const RoutingGraph& graph, const EdgeWeights& weights, std::mt19937& rng) const {
+    if (routes.empty()) return -1;
+    if (routes.size() == 1) return RouteSeconds(graph, weights, routes[0]) < INF ? 0 : -1;
+
+    std::vector<float> cost(routes.size());
+    float best = INF;
+    for (size_t i = 0; i < routes.size(); ++i) {
+        cost[i] = RouteSeconds(graph, weights, routes[i]);
+        best = std::min(best, cost[i]);
+    }
+    if (best == INF) return -1;
+
+    std::vector<double> utility(routes.size());
+    for (size_t i = 0; i < routes.size(); ++i) {
+        utility[i] = cost[i] == INF ? 0.0 : std::exp(-kLogitScale * (cost[i] - best) / std::max(best, 1e-3f));
+    }
+    std::discrete_distribution<int> draw(utility.begin(), utility.end());
+    return draw(rng);
+}
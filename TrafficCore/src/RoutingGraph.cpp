@@ -0,0 +1,266 @@
+#include "RoutingGraph.h"
+#include "RoadNetwork.h"
+#include "TravelTimeTable.h"
+#include <algorithm>
+#include <cmath>
+#include <set>
+#include <tuple>
+#include "raymath.h"
+
+// Pénalités de virage hors rond-point (temps fluide, en secondes, pour un quart de tour)
+static constexpr float kCrossingTurnPenalty = 1.5f; // virage qui coupe le flux opposé
+static constexpr float kNearTurnPenalty = 0.3f;     // virage côté proche
+
+// Même règle de détection que Vehicule::updatePhysics (type ou grand rayon)
+static bool IsDrivenAsRoundabout(const Node& node) {
+    return node.GetType() == ROUNDABOUT || node.GetRadius() > 25.0f;
+}
+
+float RoutingGraph::ComputeMovementSeconds(const Node& via, const RoadSegment& in, const RoadSegment& out) {
+    Vector3 dirIn = in.GetDirection();
+    Vector3 dirOut = out.GetDirection();
+    const float R = via.GetRadius();
+
+    if (IsDrivenAsRoundabout(via)) {
+        // Entrée en spirale (0.5 s) puis arc anti-horaire jusqu'à l'angle de sortie, sur la voie médiane
+        float entryAngle = atan2f(-dirIn.z, -dirIn.x);
+        float exitAngle = atan2f(dirOut.z, dirOut.x);
+        float sweep = exitAngle - entryAngle;
+        while (sweep <= 0.0f) sweep += 2.0f * PI;
+        return 0.5f + sweep * (R * 0.8f) / TravelTimeTable::kReferenceSpeed;
+    }
+
+    // Transition de Bézier : ~2 rayons parcourus, durée bornée comme dans le véhicule
+    float base = std::clamp(2.0f * R / TravelTimeTable::kReferenceSpeed, 0.5f, 2.5f);
+
+    // Angle de virage signé ; positif = même sens que la circulation en rond-point (côté proche)
+    float turn = atan2f(dirOut.x, dirOut.z) - atan2f(dirIn.x, dirIn.z);
+    while (turn > PI) turn -= 2.0f * PI;
+    while (turn < -PI) turn += 2.0f * PI;
+    float quarterTurns = fabsf(turn) / (PI * 0.5f);
+    float penalty = (turn >= 0.0f ? kNearTurnPenalty : kCrossingTurnPenalty) * quarterTurns;
+    return base + penalty;
+}
+
+std::shared_ptr<const RoutingGraph> RoutingGraph::Build(const RoadNetwork& network, uint64_t topologyVersion) {
+    auto graph = std::make_shared<RoutingGraph>();
+    graph->version = topologyVersion;
+
+    const auto& netNodes = network.GetNodes();
+    const auto& netSegments = network.GetRoadSegments();
+
+    auto nodeIndex = std::make_shared<std::unordered_map<const Node*, int>>();
+    graph->nodes.reserve(netNodes.size());
+    graph->positions.reserve(netNodes.size());
+    nodeIndex->reserve(netNodes.size());
+    for (const auto& n : netNodes) {
+        (*nodeIndex)[n.get()] = static_cast<int>(graph->nodes.size());
+        graph->nodes.push_back(n.get());
+        graph->positions.push_back(n->GetPosition());
+    }
+    graph->nodeIndex = std::move(nodeIndex);
+
+    graph->segments.reserve(netSegments.size());
+    for (const auto& s : netSegments) graph->segments.push_back(s.get());
+
+    // Tri par comptage : degré sortant, puis remplissage
+    const int nodeCount = graph->GetNodeCount();
+    graph->offsets.assign(nodeCount + 1, 0);
+    for (const auto& s : netSegments) {
+        int u = network.GetNodeIndex(s->GetStartNode());
+        if (u >= 0 && network.GetNodeIndex(s->GetEndNode()) >= 0) graph->offsets[u + 1]++;
+    }
+    for (int i = 0; i < nodeCount; ++i) graph->offsets[i + 1] += graph->offsets[i];
+
+    graph->targets.resize(graph->offsets[nodeCount]);
+    graph->edgeSegments.resize(graph->offsets[nodeCount]);
+    graph->sources.resize(graph->offsets[nodeCount]);
+    graph->segmentArcs.assign(netSegments.size(), -1);
+    std::vector<int> cursor(graph->offsets.begin(), graph->offsets.end() - 1);
+    for (const auto& s : netSegments) {
+        int u = network.GetNodeIndex(s->GetStartNode());
+        int v = network.GetNodeIndex(s->GetEndNode());
+        if (u < 0 || v < 0) continue;
+        int e = cursor[u]++;
+        graph->targets[e] = v;
+        graph->sources[e] = u;
+        graph->edgeSegments[e] = s->GetIndex();
+        graph->segmentArcs[s->GetIndex()] = e;
+    }
+
+    graph->IndexIncoming();
+    graph->movements.assign(graph->movementOffsets[nodeCount], kForbidden);
+
+    std::set<std::tuple<int, int, int>> restricted;
+    for (const auto& r : network.GetTurnRestrictions()) {
+        restricted.emplace(r.fromNodeId, r.viaNodeId, r.toNodeId);
+    }
+    for (int v = 0; v < nodeCount; ++v) graph->FillMovements(v, restricted, network.AreUTurnsAllowed());
+
+    return graph;
+}
+
+std::shared_ptr<const RoutingGraph> RoutingGraph::Patch(const RoutingGraph& previous, const RoadNetwork& network,
+                                                        const std::vector<int>& touchedNodes, uint64_t topologyVersion) {
+    const auto& netNodes = network.GetNodes();
+    const auto& netSegments = network.GetRoadSegments();
+    const int nodeCount = static_cast<int>(netNodes.size());
+
+    // Lignes recalculées : emplacements notés au journal et noeuds absents de l'instantané précédent
+    std::vector<char> touched(nodeCount, 0);
+    for (int v : touchedNodes) {
+        if (v >= 0 && v < nodeCount) touched[v] = 1;
+    }
+    for (int v = previous.GetNodeCount(); v < nodeCount; ++v) touched[v] = 1;
+
+    auto graph = std::make_shared<RoutingGraph>();
+    graph->version = topologyVersion;
+    graph->nodeIndex = previous.nodeIndex;
+    graph->movedNodes = previous.movedNodes;
+    graph->nodes.reserve(nodeCount);
+    graph->positions.reserve(nodeCount);
+    for (int v = 0; v < nodeCount; ++v) {
+        Node* node = netNodes[v].get();
+        graph->nodes.push_back(node);
+        graph->positions.push_back(node->GetPosition());
+        if (touched[v]) graph->movedNodes[node] = v;
+    }
+    // Trop d'écarts à la table partagée : autant tout reconstruire
+    if (!graph->nodeIndex || graph->movedNodes.size() > static_cast<size_t>(nodeCount / 8 + 64)) {
+        return Build(network, topologyVersion);
+    }
+    graph->segments.reserve(netSegments.size());
+    for (const auto& s : netSegments) graph->segments.push_back(s.get());
+
+    // Degrés : recopiés, ou recomptés depuis les routes connectées (même ordre que Build : index de segment)
+    std::vector<int> fresh; // segments sortants des lignes recalculées, dans l'ordre des noeuds
+    std::vector<int> roads;
+    graph->offsets.assign(nodeCount + 1, 0);
+    for (int v = 0; v < nodeCount; ++v) {
+        int degree;
+        if (touched[v]) {
+            roads.clear();
+            for (RoadSegment* road : netNodes[v]->GetConnectedRoads()) {
+                if (road->GetStartNode() == netNodes[v].get() && network.IsLive(road)
+                    && network.GetNodeIndex(road->GetEndNode()) >= 0) {
+                    roads.push_back(road->GetIndex());
+                }
+            }
+            std::sort(roads.begin(), roads.end());
+            roads.erase(std::unique(roads.begin(), roads.end()), roads.end());
+            fresh.insert(fresh.end(), roads.begin(), roads.end());
+            degree = static_cast<int>(roads.size());
+        } else {
+            degree = previous.offsets[v + 1] - previous.offsets[v];
+        }
+        graph->offsets[v + 1] = graph->offsets[v] + degree;
+    }
+
+    const int edgeCount = graph->offsets[nodeCount];
+    graph->targets.resize(edgeCount);
+    graph->edgeSegments.resize(edgeCount);
+    graph->sources.resize(edgeCount);
+    size_t next = 0;
+    for (int v = 0; v < nodeCount; ++v) {
+        const int begin = graph->offsets[v];
+        const int end = graph->offsets[v + 1];
+        if (touched[v]) {
+            for (int e = begin; e < end; ++e) {
+                const int s = fresh[next++];
+                graph->edgeSegments[e] = s;
+                graph->targets[e] = network.GetNodeIndex(netSegments[s]->GetEndNode());
+            }
+        } else {
+            const int from = previous.offsets[v];
+            std::copy(previous.targets.begin() + from, previous.targets.begin() + from + (end - begin),
+                      graph->targets.begin() + begin);
+            std::copy(previous.edgeSegments.begin() + from, previous.edgeSegments.begin() + from + (end - begin),
+                      graph->edgeSegments.begin() + begin);
+        }
+        std::fill(graph->sources.begin() + begin, graph->sources.begin() + end, v);
+    }
+    graph->segmentArcs.assign(netSegments.size(), -1);
+    for (int e = 0; e < edgeCount; ++e) graph->segmentArcs[graph->edgeSegments[e]] = e;
+
+    graph->IndexIncoming();
+    graph->movements.resize(graph->movementOffsets[nodeCount]);
+
+    std::set<std::tuple<int, int, int>> restricted;
+    for (const auto& r : network.GetTurnRestrictions()) {
+        int via = network.GetNodeIndex(network.FindNodeById(r.viaNodeId));
+        if (via >= 0 && touched[via]) restricted.emplace(r.fromNodeId, r.viaNodeId, r.toNodeId);
+    }
+    // Noeud intact : arcs entrants et sortants inchangés, table de manoeuvres recopiée
+    for (int v = 0; v < nodeCount; ++v) {
+        const int begin = graph->movementOffsets[v];
+        const int size = graph->movementOffsets[v + 1] - begin;
+        if (!touched[v] && previous.movementOffsets[v + 1] - previous.movementOffsets[v] == size) {
+            std::copy(previous.movements.begin() + previous.movementOffsets[v],
+                      previous.movements.begin() + previous.movementOffsets[v] + size, graph->movements.begin() + begin);
+        } else {
+            std::fill(graph->movements.begin() + begin, graph->movements.begin() + begin + size, kForbidden);
+            graph->FillMovements(v, restricted, network.AreUTurnsAllowed());
+        }
+    }
+    return graph;
+}
+
+void RoutingGraph::IndexIncoming() {
+    // CSR inverse ; le rang d'un arc dans la liste de sa cible sert d'index de manoeuvre
+    const int nodeCount = GetNodeCount();
+    std::vector<int> inDegree(nodeCount, 0);
+    inLocal.resize(targets.size());
+    for (int e = 0; e < GetEdgeCount(); ++e) {
+        inLocal[e] = inDegree[targets[e]]++;
+    }
+    inOffsets.assign(nodeCount + 1, 0);
+    for (int v = 0; v < nodeCount; ++v) inOffsets[v + 1] = inOffsets[v] + inDegree[v];
+    inArcs.resize(targets.size());
+    for (int e = 0; e < GetEdgeCount(); ++e) {
+        inArcs[inOffsets[targets[e]] + inLocal[e]] = e;
+    }
+
+    movementOffsets.assign(nodeCount + 1, 0);
+    for (int v = 0; v < nodeCount; ++v) {
+        int outDegree = offsets[v + 1] - offsets[v];
+        movementOffsets[v + 1] = movementOffsets[v] + inDegree[v] * outDegree;
+    }
+}
+
+void RoutingGraph::FillMovements(int v, const std::set<std::tuple<int, int, int>>& restricted, bool uTurnsAllowed) {
+    // Pour chaque arc entrant e (u -> v), toutes les sorties f (v -> w)
+    const Node& via = *nodes[v];
+    const int outDegree = offsets[v + 1] - offsets[v];
+    for (int i = inOffsets[v]; i < inOffsets[v + 1]; ++i) {
+        const int e = inArcs[i];
+        const int u = sources[e];
+        const RoadSegment& in = *segments[edgeSegments[e]];
+
+        for (int f = offsets[v]; f < offsets[v + 1]; ++f) {
+            int w = targets[f];
+            if (restricted.count({nodes[u]->GetId(), via.GetId(), nodes[w]->GetId()})) continue;
+
+            // Demi-tour : toujours possible en rond-point ou en impasse
+            bool uTurn = (w == u);
+            if (uTurn && !uTurnsAllowed && !IsDrivenAsRoundabout(via) && outDegree > 1) continue;
+
+            const RoadSegment& out = *segments[edgeSegments[f]];
+            float seconds = ComputeMovementSeconds(via, in, out);
+            float quantized = std::round(seconds / kMovementQuantum);
+            uint16_t cost = static_cast<uint16_t>(std::clamp(quantized, 0.0f, static_cast<float>(kForbidden - 1)));
+            movements[movementOffsets[v] + inLocal[e] * outDegree + (f - offsets[v])] = cost;
+        }
+    }
+}
+
+int RoutingGraph::IndexOf(const Node* node) const {
+    int index = -1;
+    auto moved = movedNodes.find(node);
+    if (moved != movedNodes.end()) {
+        index = moved->second;
+    } else if (nodeIndex) {
+        auto it = nodeIndex->find(node);
+        if (it != nodeIndex->end()) index = it->second;
+    }
+    return index >= 0 && index < GetNodeCount() && nodes[index] == node ? index : -1;
+}
@@ -0,0 +1,457 @@
+#include "SpatialIndex.h"
+#include "RoadNetwork.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include "raymath.h"
+
+// Écart toléré entre les axes de deux sens superposés (aller + retour d'une même rue)
+static constexpr float kOverlapTolerance = 0.5f;
+
+namespace {
+
+template <class B>
+float BoxDistSq(const B& b, float x, float z) {
+    float dx = x < b.minX ? b.minX - x : (x > b.maxX ? x - b.maxX : 0.0f);
+    float dz = z < b.minZ ? b.minZ - z : (z > b.maxZ ? z - b.maxZ : 0.0f);
+    return dx * dx + dz * dz;
+}
+
+template <class B>
+void Expand(B& into, const B& b) {
+    into.minX = std::min(into.minX, b.minX);
+    into.minZ = std::min(into.minZ, b.minZ);
+    into.maxX = std::max(into.maxX, b.maxX);
+    into.maxZ = std::max(into.maxZ, b.maxZ);
+}
+
+// Tri STR : tranches verticales de sqrt(feuilles) boîtes, chacune triée en z
+template <class B>
+void SortStr(std::vector<int32_t>& order, const std::vector<B>& boxes, int fanout) {
+    auto centerX = [&](int32_t i) { return boxes[i].minX + boxes[i].maxX; };
+    auto centerZ = [&](int32_t i) { return boxes[i].minZ + boxes[i].maxZ; };
+    const size_t leaves = (order.size() + fanout - 1) / fanout;
+    const size_t slices = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(leaves)))));
+    const size_t sliceSize = (leaves + slices - 1) / slices * fanout;
+
+    std::sort(order.begin(), order.end(), [&](int32_t a, int32_t b) { return centerX(a) < centerX(b); });
+    for (size_t begin = 0; begin < order.size(); begin += sliceSize) {
+        auto end = order.begin() + std::min(order.size(), begin + sliceSize);
+        std::sort(order.begin() + begin, end, [&](int32_t a, int32_t b) { return centerZ(a) < centerZ(b); });
+    }
+}
+
+// Morceaux rangés par segment croissant : bornes des morceaux d'un segment
+struct BySegment {
+    template <class P>
+    bool operator()(const P& p, int32_t segment) const { return p.segment < segment; }
+    template <class P>
+    bool operator()(int32_t segment, const P& p) const { return segment < p.segment; }
+};
+
+} // namespace
+
+void SpatialIndex::Tree::Pack(const std::vector<Box>& elementBoxes) {
+    boxes.clear();
+    first.clear();
+    count.clear();
+    leafCount = 0;
+    const int n = static_cast<int>(elementBoxes.size());
+    items.resize(n);
+    std::iota(items.begin(), items.end(), 0);
+    if (n == 0) {
+        itemBoxes.clear();
+        return;
+    }
+    SortStr(items, elementBoxes, kFanout);
+    itemBoxes.resize(n);
+    for (int k = 0; k < n; ++k) itemBoxes[k] = elementBoxes[items[k]];
+
+    // Feuilles : kFanout éléments consécutifs
+    for (int i = 0; i < n; i += kFanout) {
+        int c = std::min(kFanout, n - i);
+        Box box = itemBoxes[i];
+        for (int k = 1; k < c; ++k) Expand(box, itemBoxes[i + k]);
+        boxes.push_back(box);
+        first.push_back(i);
+        count.push_back(c);
+    }
+    leafCount = static_cast<int32_t>(boxes.size());
+
+    // Niveaux supérieurs : chaque niveau est rangé (STR) puis regroupé, jusqu'à une racine unique
+    int levelBegin = 0;
+    int levelEnd = leafCount;
+    while (levelEnd - levelBegin > 1) {
+        std::vector<int32_t> order(levelEnd - levelBegin);
+        std::iota(order.begin(), order.end(), levelBegin);
+        SortStr(order, boxes, kFanout);
+        std::vector<Box> sortedBoxes;
+        std::vector<int32_t> sortedFirst, sortedCount;
+        for (int32_t i : order) {
+            sortedBoxes.push_back(boxes[i]);
+            sortedFirst.push_back(first[i]);
+            sortedCount.push_back(count[i]);
+        }
+        std::copy(sortedBoxes.begin(), sortedBoxes.end(), boxes.begin() + levelBegin);
+        std::copy(sortedFirst.begin(), sortedFirst.end(), first.begin() + levelBegin);
+        std::copy(sortedCount.begin(), sortedCount.end(), count.begin() + levelBegin);
+
+        for (int i = levelBegin; i < levelEnd; i += kFanout) {
+            int c = std::min(kFanout, levelEnd - i);
+            Box box = boxes[i];
+            for (int k = 1; k < c; ++k) Expand(box, boxes[i + k]);
+            boxes.push_back(box);
+            first.push_back(i);
+            count.push_back(c);
+        }
+        levelBegin = levelEnd;
+        levelEnd = static_cast<int>(boxes.size());
+    }
+}
+
+bool SpatialIndex::Tree::IsValid(int elementCount) const {
+    const size_t n = boxes.size();
+    if (first.size() != n || count.size() != n || itemBoxes.size() != items.size()
+        || leafCount < 0 || static_cast<size_t>(leafCount) > n) {
+        return false;
+    }
+    if (n == 0) return items.empty();
+    for (int32_t item : items) {
+        if (item < 0 || item >= elementCount) return false;
+    }
+    for (size_t i = 0; i < n; ++i) {
+        if (count[i] <= 0 || count[i] > kFanout || first[i] < 0) return false;
+        // Feuille : dans items ; boîte interne : filles rangées avant elle (pas de cycle)
+        size_t end = static_cast<size_t>(first[i]) + count[i];
+        if (static_cast<int32_t>(i) < leafCount ? end > items.size() : end > i) return false;
+    }
+    return true;
+}
+
+void SpatialIndex::CutPieces(const RoadSegment& segment, int32_t segmentIndex, std::vector<Piece>& out) {
+    // Une droite suffit pour une géométrie rectiligne, sinon la polyligne de la courbe
+    std::vector<Vector3> points;
+    if (segment.GetControlPointCount() == 2) {
+        points.assign(segment.GetControlPoints(), segment.GetControlPoints() + 2);
+    } else if (segment.GetGeometry()) {
+        points = segment.GetGeometry()->GetPoints();
+    } else {
+        points = {segment.GetStartPos(), segment.GetEndPos()};
+    }
+    if (points.size() < 2) return;
+
+    float total = 0.0f;
+    for (size_t i = 1; i < points.size(); ++i) total += Vector3Distance(points[i - 1], points[i]);
+    float along = 0.0f;
+    for (size_t i = 1; i < points.size(); ++i) {
+        const Vector3& a = points[i - 1];
+        const Vector3& b = points[i];
+        float next = along + Vector3Distance(a, b);
+        out.push_back({a.x, a.y, a.z, b.x, b.y, b.z,
+                       total > 0.0f ? along / total : 0.0f, total > 0.0f ? next / total : 0.0f, segmentIndex});
+        along = next;
+    }
+}
+
+std::shared_ptr<const SpatialIndex> SpatialIndex::Build(const RoadNetwork& network, uint64_t topologyVersion) {
+    auto index = std::make_shared<SpatialIndex>();
+    index->version = topologyVersion;
+    auto packed = std::make_shared<Packed>();
+
+    std::vector<Box> nodeBoxes;
+    nodeBoxes.reserve(network.GetNodes().size());
+    for (const auto& node : network.GetNodes()) {
+        Vector3 p = node->GetPosition();
+        nodeBoxes.push_back({p.x, p.z, p.x, p.z});
+    }
+    packed->nodeTree.Pack(nodeBoxes);
+
+    packed->segments.reserve(network.GetRoadSegments().size());
+    for (const auto& segment : network.GetRoadSegments()) {
+        CutPieces(*segment, static_cast<int32_t>(packed->segments.size()), packed->pieces);
+        packed->segments.push_back(segment.get());
+    }
+    std::vector<Box> pieceBoxes;
+    pieceBoxes.reserve(packed->pieces.size());
+    for (const Piece& p : packed->pieces) {
+        pieceBoxes.push_back({std::min(p.ax, p.bx), std::min(p.az, p.bz), std::max(p.ax, p.bx), std::max(p.az, p.bz)});
+    }
+    packed->segmentTree.Pack(pieceBoxes);
+    index->packed = std::move(packed);
+    return index;
+}
+
+std::shared_ptr<const SpatialIndex> SpatialIndex::Patch(const SpatialIndex& previous, const RoadNetwork& network,
+                                                        const std::vector<int>& touchedNodes,
+                                                        const std::vector<int>& touchedSegments, uint64_t topologyVersion) {
+    auto index = std::make_shared<SpatialIndex>();
+    index->version = topologyVersion;
+    index->packed = previous.packed;
+    index->patched = true;
+    const Packed& packed = *index->packed;
+    const int nodeSlots = static_cast<int>(packed.nodeTree.items.size());
+    const int segmentSlots = static_cast<int>(packed.segments.size());
+
+    // Noeuds : emplacement masqué dans l'arbre, contenu courant dans la liste
+    index->maskedNodes = previous.maskedNodes;
+    index->maskedNodeCount = previous.maskedNodeCount;
+    if (index->maskedNodes.empty()) index->maskedNodes.assign(nodeSlots, 0);
+    for (int slot : touchedNodes) {
+        if (slot < nodeSlots && !index->maskedNodes[slot]) {
+            index->maskedNodes[slot] = 1;
+            ++index->maskedNodeCount;
+        }
+    }
+    for (const LooseNode& n : previous.looseNodes) {
+        if (!std::binary_search(touchedNodes.begin(), touchedNodes.end(), n.index)) index->looseNodes.push_back(n);
+    }
+    for (int slot : touchedNodes) {
+        if (slot >= network.GetNodeCount()) break;
+        Vector3 p = network.GetNodes()[slot]->GetPosition();
+        index->looseNodes.push_back({slot, p.x, p.z});
+    }
+
+    // Segments : mêmes règles, morceaux recalculés depuis la géométrie courante
+    index->maskedSegments = previous.maskedSegments;
+    index->maskedPieceCount = previous.maskedPieceCount;
+    if (index->maskedSegments.empty()) index->maskedSegments.assign(segmentSlots, 0);
+    for (int slot : touchedSegments) {
+        if (slot < segmentSlots && !index->maskedSegments[slot]) {
+            index->maskedSegments[slot] = 1;
+            auto range = std::equal_range(packed.pieces.begin(), packed.pieces.end(), slot, BySegment());
+            index->maskedPieceCount += static_cast<int>(range.second - range.first);
+        }
+    }
+    for (const LoosePiece& p : previous.loosePieces) {
+        if (!std::binary_search(touchedSegments.begin(), touchedSegments.end(), p.piece.segment)) {
+            index->loosePieces.push_back(p);
+        }
+    }
+    std::vector<Piece> cut;
+    for (int slot : touchedSegments) {
+        if (slot >= network.GetRoadSegmentCount()) break;
+        RoadSegment* segment = network.GetRoadSegments()[slot].get();
+        cut.clear();
+        CutPieces(*segment, slot, cut);
+        for (const Piece& p : cut) index->loosePieces.push_back({p, segment});
+    }
+
+    if (index->looseNodes.size() > kLooseLimit || index->loosePieces.size() > kLooseLimit) {
+        return Build(network, topologyVersion);
+    }
+    return index;
+}
+
+int SpatialIndex::GetNodeCount() const {
+    return static_cast<int>(packed->nodeTree.items.size()) - maskedNodeCount + static_cast<int>(looseNodes.size());
+}
+
+int SpatialIndex::GetPieceCount() const {
+    return static_cast<int>(packed->pieces.size()) - maskedPieceCount + static_cast<int>(loosePieces.size());
+}
+
+float SpatialIndex::PieceDistSq(const Piece& p, float x, float z, float& u) const {
+    float abx = p.bx - p.ax;
+    float abz = p.bz - p.az;
+    float lenSq = abx * abx + abz * abz;
+    u = 0.0f;
+    if (lenSq > 1e-8f) {
+        u = std::clamp(((x - p.ax) * abx + (z - p.az) * abz) / lenSq, 0.0f, 1.0f);
+    }
+    float dx = p.ax + abx * u - x;
+    float dz = p.az + abz * u - z;
+    return dx * dx + dz * dz;
+}
+
+template <class ItemDistance>
+int SpatialIndex::Nearest(const Tree& tree, float x, float z, float maxDistSq,
+                          ItemDistance itemDistSq, float& bestDistSq) const {
+    bestDistSq = maxDistSq;
+    if (tree.boxes.empty()) return -1;
+
+    // Meilleur d'abord : file triée par distance minimale à la boîte
+    using Entry = std::pair<float, int>;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+    float rootDist = BoxDistSq(tree.boxes[tree.Root()], x, z);
+    if (rootDist <= bestDistSq) open.push({rootDist, tree.Root()});
+
+    int best = -1;
+    while (!open.empty()) {
+        Entry top = open.top();
+        open.pop();
+        if (top.first > bestDistSq) break;
+        const int b = top.second;
+        const int end = tree.first[b] + tree.count[b];
+        if (b < tree.leafCount) {
+            for (int k = tree.first[b]; k < end; ++k) {
+                if (BoxDistSq(tree.itemBoxes[k], x, z) > bestDistSq) continue;
+                float d = itemDistSq(k);
+                if (d == std::numeric_limits<float>::infinity()) continue; // masqué
+                if (d < bestDistSq || (best < 0 && d <= bestDistSq)) {
+                    bestDistSq = d;
+                    best = tree.items[k];
+                }
+            }
+        } else {
+            for (int c = tree.first[b]; c < end; ++c) {
+                float d = BoxDistSq(tree.boxes[c], x, z);
+                if (d <= bestDistSq) open.push({d, c});
+            }
+        }
+    }
+    return best;
+}
+
+void SpatialIndex::Query(const Tree& tree, float x, float z, float radius, std::vector<int>& out) const {
+    out.clear();
+    if (tree.boxes.empty() || !(radius >= 0.0f)) return;
+    const float radiusSq = radius * radius;
+    std::vector<int> stack{tree.Root()};
+    while (!stack.empty()) {
+        int b = stack.back();
+        stack.pop_back();
+        if (BoxDistSq(tree.boxes[b], x, z) > radiusSq) continue;
+        const int end = tree.first[b] + tree.count[b];
+        if (b < tree.leafCount) {
+            for (int k = tree.first[b]; k < end; ++k) {
+                if (BoxDistSq(tree.itemBoxes[k], x, z) <= radiusSq) out.push_back(tree.items[k]);
+            }
+        } else {
+            for (int c = tree.first[b]; c < end; ++c) stack.push_back(c);
+        }
+    }
+}
+
+
+int SpatialIndex::NearestNode(Vector3 position) const {
+    const float x = position.x;
+    const float z = position.z;
+    const Tree& tree = packed->nodeTree;
+    float bestDistSq;
+    int best = Nearest(tree, x, z, std::numeric_limits<float>::infinity(), [&](int k) {
+        return NodeMasked(tree.items[k]) ? std::numeric_limits<float>::infinity() : BoxDistSq(tree.itemBoxes[k], x, z);
+    }, bestDistSq);
+    for (const LooseNode& n : looseNodes) {
+        float d = (n.x - x) * (n.x - x) + (n.z - z) * (n.z - z);
+        if (d < bestDistSq || best < 0) {
+            bestDistSq = d;
+            best = n.index;
+        }
+    }
+    return best;
+}
+
+SegmentMatch SpatialIndex::NearestSegment(Vector3 position, float maxDistance) const {
+    SegmentMatch match;
+    const float x = position.x;
+    const float z = position.z;
+    const Tree& tree = packed->segmentTree;
+    float u = 0.0f;
+    float bestDistSq;
+    int item = Nearest(tree, x, z, maxDistance * maxDistance, [&](int k) {
+        const Piece& p = packed->pieces[tree.items[k]];
+        return SegmentMasked(p.segment) ? std::numeric_limits<float>::infinity() : PieceDistSq(p, x, z, u);
+    }, bestDistSq);
+    const Piece* best = item >= 0 ? &packed->pieces[item] : nullptr;
+    const RoadSegment* bestSegment = best ? packed->segments[best->segment] : nullptr;
+    for (const LoosePiece& loose : loosePieces) {
+        float d = PieceDistSq(loose.piece, x, z, u);
+        if (d < bestDistSq || (!best && d <= bestDistSq)) {
+            bestDistSq = d;
+            best = &loose.piece;
+            bestSegment = loose.segment;
+        }
+    }
+    if (!best) return match;
+
+    // Décalage signé du point, positif à droite du sens de circulation (côté des voies aller)
+    auto lateral = [&](const Piece& p) {
+        float abx = p.bx - p.ax;
+        float abz = p.bz - p.az;
+        float len = std::sqrt(abx * abx + abz * abz);
+        return len > 1e-4f ? ((x - p.ax) * abz - (z - p.az) * abx) / len : 0.0f;
+    };
+
+    // Point à gauche : le retour de la même rue (tracé superposé) le place sur ses voies aller
+    const Piece* chosen = best;
+    const RoadSegment* segment = bestSegment;
+    if (lateral(*best) < 0.0f) {
+        const float reach = std::sqrt(bestDistSq) + kOverlapTolerance;
+        float chosenDistSq = reach * reach;
+        auto consider = [&](const Piece& p, const RoadSegment* s) {
+            if (s->GetStartNode() != bestSegment->GetEndNode() || s->GetEndNode() != bestSegment->GetStartNode()) return;
+            float v;
+            float d = PieceDistSq(p, x, z, v);
+            if (d <= chosenDistSq && lateral(p) >= 0.0f) {
+                chosenDistSq = d;
+                chosen = &p;
+                segment = s;
+            }
+        };
+        std::vector<int> near;
+        Query(tree, x, z, reach, near);
+        for (int candidate : near) {
+            const Piece& p = packed->pieces[candidate];
+            if (!SegmentMasked(p.segment)) consider(p, packed->segments[p.segment]);
+        }
+        for (const LoosePiece& loose : loosePieces) consider(loose.piece, loose.segment);
+    }
+
+    const Piece& p = *chosen;
+    const float distSq = PieceDistSq(p, x, z, u);
+    match.segment = segment->GetIndex();
+    match.t = p.t0 + (p.t1 - p.t0) * u;
+    match.distance = std::sqrt(distSq);
+    match.position = {p.ax + (p.bx - p.ax) * u, p.ay + (p.by - p.ay) * u, p.az + (p.bz - p.az) * u};
+
+    // Voie : décalages de GetTrafficLanePosition (0 = aller, à droite de l'axe)
+    static const float kTwoLaneOffsets[] = {0.5f, -0.5f};
+    static const float kFourLaneOffsets[] = {1.5f, 0.5f, -0.5f, -1.5f};
+    const int lanes = segment->GetLanes();
+    const float laneWidth = lanes > 0 ? segment->GetWidth() / lanes : 0.0f;
+    const float* offsets = lanes <= 2 ? kTwoLaneOffsets : kFourLaneOffsets;
+    const int laneCount = lanes <= 2 ? 2 : 4;
+    const float side = lateral(p);
+    float bestGap = std::numeric_limits<float>::infinity();
+    for (int lane = 0; lane < laneCount; ++lane) {
+        float gap = std::fabs(side - offsets[lane] * laneWidth);
+        if (gap < bestGap) {
+            bestGap = gap;
+            match.lane = lane;
+        }
+    }
+    return match;
+}
+
+void SpatialIndex::QueryNodes(Vector3 center, float radius, std::vector<int>& out) const {
+    Query(packed->nodeTree, center.x, center.z, radius, out);
+    if (maskedNodeCount > 0) {
+        out.erase(std::remove_if(out.begin(), out.end(), [this](int slot) { return NodeMasked(slot); }), out.end());
+    }
+    const float radiusSq = radius * radius;
+    for (const LooseNode& n : looseNodes) {
+        float dx = n.x - center.x;
+        float dz = n.z - center.z;
+        if (dx * dx + dz * dz <= radiusSq) out.push_back(n.index);
+    }
+}
+
+void SpatialIndex::QuerySegments(Vector3 center, float radius, std::vector<int>& out) const {
+    std::vector<int> near;
+    Query(packed->segmentTree, center.x, center.z, radius, near);
+    out.clear();
+    const float radiusSq = radius * radius;
+    float u;
+    for (int candidate : near) {
+        const Piece& p = packed->pieces[candidate];
+        if (!SegmentMasked(p.segment) && PieceDistSq(p, center.x, center.z, u) <= radiusSq) out.push_back(p.segment);
+    }
+    for (const LoosePiece& loose : loosePieces) {
+        if (PieceDistSq(loose.piece, center.x, center.z, u) <= radiusSq) out.push_back(loose.piece.segment);
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+}
@@ -0,0 +1,178 @@
+#include "StaticProps.h"
+#include "core/CellKey.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+StaticProps::~StaticProps() {
+    if (IsWindowReady()) {
+        Release();
+        return;
+    }
+    // Contexte déjà fermé : seuls les tableaux CPU du cube restent à libérer
+    if (hasBoxMesh) {
+        MemFree(unitCube.vertices);
+        MemFree(unitCube.normals);
+        MemFree(unitCube.texcoords);
+        MemFree(unitCube.indices);
+        MemFree(unitCube.vboId);
+        MemFree(boxMaterial.maps);
+    }
+}
+
+Matrix StaticProps::PropTransform(const Prop& prop) {
+    // Même ordre que DrawModelEx : échelle, rotation, translation
+    return MatrixMultiply(MatrixMultiply(MatrixScale(prop.scale, prop.scale, prop.scale),
+                                         MatrixRotateY(prop.rotation * DEG2RAD)),
+                          MatrixTranslate(prop.position.x, prop.position.y, prop.position.z));
+}
+
+int StaticProps::Add(const Model& model, const ModelLod* lod, Vector3 position, float rotation, float scale,
+                     float maxDistance) {
+    const int id = static_cast<int>(props.size());
+    props.push_back({&model, lod, position, rotation, scale, LodLevel::Full});
+    const BoundingBox bounds = TransformBounds(lod ? lod->bounds : GetModelBoundingBox(model), PropTransform(props.back()));
+    grid.Add(bounds, maxDistance);
+    const Vector3 size = Vector3Subtract(bounds.max, bounds.min);
+    const float radius = lod ? lod->GetRadius(scale) : Vector3Length(size) * 0.5f;
+
+    const Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    const int64_t x = static_cast<int64_t>(std::floor(center.x / RenderGrid::kCellSize));
+    const int64_t z = static_cast<int64_t>(std::floor(center.z / RenderGrid::kCellSize));
+    auto inserted = batchIndex.try_emplace({CellKey(x, z), &model}, GetBatchCount());
+    if (inserted.second) {
+        batches.emplace_back();
+        Batch& batch = batches.back();
+        batch.model = &model;
+        batch.lod = lod;
+        batch.bounds = bounds;
+        batch.maxDistance = maxDistance;
+        batch.radius = radius;
+    } else {
+        Batch& batch = batches[inserted.first->second];
+        batch.bounds.min = Vector3Min(batch.bounds.min, bounds.min);
+        batch.bounds.max = Vector3Max(batch.bounds.max, bounds.max);
+        batch.maxDistance = (batch.maxDistance <= 0.0f || maxDistance <= 0.0f) ? 0.0f
+                                                                                : std::max(batch.maxDistance, maxDistance);
+        batch.radius = std::max(batch.radius, radius);
+        if (!lod) batch.lod = nullptr; // un objet sans LOD : groupe toujours complet
+    }
+    Batch& batch = batches[inserted.first->second];
+    batch.props.push_back(id);
+    batch.dirty = true;
+    return id;
+}
+
+void StaticProps::Clear() {
+    props.clear();
+    batches.clear(); // tampons GPU libérés par InstanceBatch si le contexte est ouvert
+    batchIndex.clear();
+    grid.Clear();
+    stats.Reset();
+    drawCalls = 0;
+}
+
+void StaticProps::QueryBatches(const Frustum& view, std::vector<int>& out) {
+    out.clear();
+    stats.Reset();
+    for (int i = 0; i < GetBatchCount(); ++i) {
+        const Batch& batch = batches[i];
+        const int count = static_cast<int>(batch.props.size());
+        if (!view.IntersectsBox(batch.bounds)) {
+            stats.frustumCulled += count;
+        } else if (batch.maxDistance > 0.0f && view.DistanceTo(batch.bounds) > batch.maxDistance) {
+            stats.distanceCulled += count;
+        } else {
+            stats.drawn += count;
+            out.push_back(i);
+        }
+    }
+}
+
+void StaticProps::Bake(Batch& batch) {
+    std::vector<Matrix> transforms, boxTransforms;
+    std::vector<Color> boxColors;
+    transforms.reserve(batch.props.size());
+    // Cube unité étiré sur la boîte du modèle (repère du modèle, model.transform compris)
+    Matrix box = MatrixIdentity();
+    if (batch.lod) {
+        const BoundingBox& b = batch.lod->bounds;
+        const Vector3 center = Vector3Scale(Vector3Add(b.min, b.max), 0.5f);
+        const Vector3 size = Vector3Subtract(b.max, b.min);
+        box = MatrixMultiply(MatrixScale(size.x, size.y, size.z), MatrixTranslate(center.x, center.y, center.z));
+    }
+    for (int id : batch.props) {
+        const Matrix place = PropTransform(props[id]);
+        transforms.push_back(MatrixMultiply(batch.model->transform, place)); // comme DrawModelEx
+        if (batch.lod) {
+            boxTransforms.push_back(MatrixMultiply(box, place));
+            boxColors.push_back(batch.lod->color);
+        }
+    }
+    batch.models.SetTransforms(std::move(transforms));
+    batch.boxes.SetTransforms(std::move(boxTransforms));
+    batch.boxes.SetColors(boxColors);
+    batch.dirty = false;
+}
+
+void StaticProps::Draw(const Frustum& view) {
+    drawCalls = 0;
+    if (!InstanceBatch::IsAvailable()) {
+        DrawFallback(view);
+        return;
+    }
+    if (!hasBoxMesh) {
+        unitCube = GenMeshCube(1.0f, 1.0f, 1.0f);
+        boxMaterial = LoadMaterialDefault(); // blanc : la couleur vient de l'instance
+        hasBoxMesh = true;
+    }
+    QueryBatches(view, visible);
+    const Vector3 eye = view.GetOrigin();
+    for (int i : visible) {
+        Batch& batch = batches[i];
+        if (batch.dirty) Bake(batch);
+        if (batch.lod) {
+            // Niveau de l'objet du groupe le plus grand à l'écran : rayon maximal au point le plus proche
+            const Vector3 closest = Vector3Min(Vector3Max(eye, batch.bounds.min), batch.bounds.max);
+            batch.level = LodSelector::Select(LodSelector::ScreenSize(closest, batch.radius), batch.level);
+        }
+        if (batch.level == LodLevel::Box) {
+            batch.boxes.Draw(unitCube, boxMaterial);
+            ++drawCalls;
+            continue;
+        }
+        const Model& model = (batch.level == LodLevel::Simplified && batch.lod->simplified.meshCount > 0)
+            ? batch.lod->simplified : *batch.model;
+        for (int m = 0; m < model.meshCount; ++m) {
+            batch.models.Draw(model.meshes[m], model.materials[model.meshMaterial[m]]);
+            ++drawCalls;
+        }
+    }
+}
+
+void StaticProps::DrawFallback(const Frustum& view) {
+    grid.Query(view, visible);
+    stats = grid.GetStats();
+    for (int id : visible) {
+        Prop& prop = props[id];
+        if (prop.lod) prop.level = LodSelector::Select(*prop.lod, prop.position, prop.scale, prop.level);
+        DrawModelLod(*prop.model, prop.lod, prop.level, prop.position, prop.rotation, prop.scale, WHITE);
+        if (prop.level == LodLevel::Box) ++drawCalls;
+        else if (prop.level == LodLevel::Simplified && prop.lod->simplified.meshCount > 0) drawCalls += prop.lod->simplified.meshCount;
+        else drawCalls += prop.model->meshCount;
+    }
+}
+
+void StaticProps::Release() {
+    for (Batch& batch : batches) {
+        batch.models.Release();
+        batch.boxes.Release();
+    }
+    if (hasBoxMesh) {
+        UnloadMesh(unitCube);
+        UnloadMaterial(boxMaterial);
+        unitCube = {};
+        boxMaterial = {};
+        hasBoxMesh = false;
+    }
+}
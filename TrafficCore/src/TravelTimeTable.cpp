@@ -0,0 +1,150 @@
+#include "TravelTimeTable.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+float TravelTimeTable::FreeFlowSeconds(float length, int lanes) {
+    // Même forme que l'ancien coût statique : longueur / (1 + k * voies), ramenée en secondes
+    float laneFactor = 1.0f / (1.0f + 0.18f * static_cast<float>(lanes));
+    return std::max(length, 0.1f) * laneFactor / kReferenceSpeed;
+}
+
+void TravelTimeTable::AddSegment(float freeFlowSeconds, float chordLength) {
+    freeFlow.push_back(freeFlowSeconds);
+    estimates.push_back(freeFlowSeconds);
+    chordLengths.push_back(chordLength);
+    closedFlags.push_back(0);
+    pendingFlags.push_back(0);
+    dirty = true;
+}
+
+void TravelTimeTable::RemoveSegment(int segmentIndex) {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(estimates.size())) return;
+    const int last = static_cast<int>(estimates.size()) - 1;
+    if (pendingFlags[last]) {
+        pendingChanges.erase(std::remove(pendingChanges.begin(), pendingChanges.end(), last), pendingChanges.end());
+    }
+    freeFlow[segmentIndex] = freeFlow[last];
+    estimates[segmentIndex] = estimates[last];
+    chordLengths[segmentIndex] = chordLengths[last];
+    closedFlags[segmentIndex] = closedFlags[last];
+    freeFlow.pop_back();
+    estimates.pop_back();
+    chordLengths.pop_back();
+    closedFlags.pop_back();
+    pendingFlags.pop_back();
+    if (segmentIndex < last) MarkChanged(segmentIndex);
+    dirty = true;
+}
+
+void TravelTimeTable::ResetSegment(int segmentIndex, float freeFlowSeconds, float chordLength) {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(estimates.size())) return;
+    freeFlow[segmentIndex] = freeFlowSeconds;
+    estimates[segmentIndex] = freeFlowSeconds;
+    chordLengths[segmentIndex] = chordLength;
+    MarkChanged(segmentIndex);
+}
+
+void TravelTimeTable::MarkChanged(int segmentIndex) {
+    if (!pendingFlags[segmentIndex]) {
+        pendingFlags[segmentIndex] = 1;
+        pendingChanges.push_back(segmentIndex);
+    }
+    dirty = true;
+}
+
+void TravelTimeTable::Record(int segmentIndex, float seconds) {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(estimates.size())) return;
+    if (!(seconds > 0.0f)) return;
+
+    // Borne les observations aberrantes (véhicule supprimé à la main, pause...)
+    float ff = freeFlow[segmentIndex];
+    float observed = std::clamp(seconds, ff * kMinFreeFlowRatio, ff * 50.0f);
+
+    float& est = estimates[segmentIndex];
+    est += kSmoothing * (observed - est);
+    MarkChanged(segmentIndex);
+}
+
+void TravelTimeTable::SetClosed(int segmentIndex, bool closed) {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(closedFlags.size())) return;
+    if (static_cast<bool>(closedFlags[segmentIndex]) == closed) return;
+    closedFlags[segmentIndex] = closed ? 1 : 0;
+    MarkChanged(segmentIndex);
+}
+
+bool TravelTimeTable::IsClosed(int segmentIndex) const {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(closedFlags.size())) return false;
+    return closedFlags[segmentIndex] != 0;
+}
+
+std::shared_ptr<const EdgeWeights> TravelTimeTable::BuildWeights(uint64_t version) const {
+    auto w = std::make_shared<EdgeWeights>();
+    w->version = version;
+    w->seconds = estimates;
+
+    float maxSpeed = kReferenceSpeed;
+    float speedBound = kReferenceSpeed;
+    for (size_t i = 0; i < estimates.size(); ++i) {
+        // Estimations lissées entre des observations bornées : jamais sous ff * kMinFreeFlowRatio
+        if (freeFlow[i] > 0.0f) speedBound = std::max(speedBound, chordLengths[i] / (freeFlow[i] * kMinFreeFlowRatio));
+        if (closedFlags[i]) {
+            w->seconds[i] = std::numeric_limits<float>::infinity();
+            continue;
+        }
+        if (estimates[i] > 0.0f) maxSpeed = std::max(maxSpeed, chordLengths[i] / estimates[i]);
+    }
+    w->maxSpeed = maxSpeed;
+    w->speedBound = std::max(speedBound, maxSpeed);
+
+    // Journal des modifications, consommé par cette publication
+    w->changed = pendingChanges;
+    for (int idx : pendingChanges) pendingFlags[idx] = 0;
+    pendingChanges.clear();
+    return w;
+}
+
+void TravelTimeTable::Publish() {
+    std::lock_guard<std::mutex> lock(publishMutex);
+    auto current = std::atomic_load(&published);
+    if (current && !dirty) return;
+    std::atomic_store(&published, BuildWeights(++lastVersion));
+    dirty = false;
+}
+
+std::shared_ptr<const EdgeWeights> TravelTimeTable::GetWeights() const {
+    auto current = std::atomic_load(&published);
+    if (current && current->seconds.size() == estimates.size()) return current;
+
+    // Réseau modifié depuis la dernière publication : on republie avant de servir
+    std::lock_guard<std::mutex> lock(publishMutex);
+    current = std::atomic_load(&published);
+    if (!current || current->seconds.size() != estimates.size()) {
+        current = BuildWeights(++lastVersion);
+        std::atomic_store(&published, current);
+        dirty = false;
+    }
+    return current;
+}
+
+float TravelTimeTable::GetEstimate(int segmentIndex) const {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(estimates.size())) return 0.0f;
+    return estimates[segmentIndex];
+}
+
+float TravelTimeTable::GetFreeFlow(int segmentIndex) const {
+    if (segmentIndex < 0 || segmentIndex >= static_cast<int>(freeFlow.size())) return 0.0f;
+    return freeFlow[segmentIndex];
+}
+
+void TravelTimeTable::Clear() {
+    std::lock_guard<std::mutex> lock(publishMutex);
+    freeFlow.clear();
+    estimates.clear();
+    chordLengths.clear();
+    closedFlags.clear();
+    pendingChanges.clear();
+    pendingFlags.clear();
+    std::atomic_store(&published, std::shared_ptr<const EdgeWeights>());
+    dirty = true;
+}
@@ -0,0 +1,313 @@
+#include "core/AssetManager.h"
+#include "core/JsonReader.h"
+#include "core/MappedFile.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace fs = std::filesystem;
+
+// ==================== MANIFESTE ====================
+
+static std::string ParentKey(const std::string& path) {
+    std::error_code ec;
+    fs::path parent = fs::weakly_canonical(fs::absolute(fs::path(path), ec), ec).parent_path();
+    return parent.lexically_normal().generic_string();
+}
+
+static void WriteString(std::ostream& out, const std::string& s) {
+    out << '"';
+    for (char c : s) {
+        if (c == '"' || c == '\\') out << '\\';
+        out << c;
+    }
+    out << '"';
+}
+
+std::string AssetManifest::Classify(const std::string& fileName) {
+    std::string lower = fileName;
+    std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+    auto has = [&](const char* word) { return lower.find(word) != std::string::npos; };
+    // Mobilier urbain exclu des bus (abribus, arrêts)
+    if (has("bus") && !has("stop") && !has("station") && !has("abribus")) return "BUS";
+    if (has("truck")) return "TRUCK";
+    if (has("taxi") || has("car") || has("convertible") || has("model")) return "CAR";
+    return "SCENERY";
+}
+
+bool AssetManifest::Load(const std::string& file) {
+    MappedFile mapped;
+    if (!mapped.Open(file)) return false;
+    JsonReader r(mapped.View());
+    std::vector<AssetInfo> loaded;
+    std::string_view key;
+    if (!r.BeginObject()) return false;
+    while (r.NextMember(key)) {
+        if (key != "assets") {
+            r.Skip();
+            continue;
+        }
+        if (!r.BeginArray()) break;
+        while (r.NextElement()) {
+            AssetInfo info;
+            if (!r.BeginObject()) break;
+            while (r.NextMember(key)) {
+                std::string_view text;
+                double number = 0.0;
+                if (key == "name" && r.ReadString(text)) {
+                    info.name = JsonReader::Unescape(text);
+                } else if (key == "category" && r.ReadString(text)) {
+                    info.category = JsonReader::Unescape(text);
+                } else if (key == "size" && r.ReadNumber(number)) {
+                    info.size = static_cast<uint64_t>(number);
+                } else if (key == "time" && r.ReadString(text)) {
+                    // Horloge du système de fichiers (ns) : en chaîne, au-delà de la précision d'un double
+                    std::from_chars(text.data(), text.data() + text.size(), info.writeTime);
+                } else if (key == "bounds" && r.BeginArray()) {
+                    float v[6] = {};
+                    int count = 0;
+                    while (r.NextElement()) {
+                        float f = 0.0f;
+                        if (!r.ReadFloat(f)) break;
+                        if (count < 6) v[count] = f;
+                        ++count;
+                    }
+                    info.hasBounds = (count == 6);
+                    info.bounds = {{v[0], v[1], v[2]}, {v[3], v[4], v[5]}};
+                } else {
+                    r.Skip();
+                }
+            }
+            if (!info.name.empty()) loaded.push_back(std::move(info));
+        }
+    }
+    if (r.HasError()) {
+        error = file + " : " + r.GetError();
+        return false;
+    }
+    assets = std::move(loaded);
+    return true;
+}
+
+bool AssetManifest::Open(const std::string& dir) {
+    std::error_code ec;
+    if (!fs::is_directory(dir, ec)) {
+        error = "Dossier d'assets introuvable : " + dir;
+        return false;
+    }
+    directory = fs::weakly_canonical(fs::absolute(dir, ec), ec).lexically_normal().generic_string();
+    assets.clear();
+    rescanned = 0;
+    // Index illisible ou absent : reconstruit entièrement
+    dirty = !Load(directory + "/" + kFileName);
+
+    std::vector<AssetInfo> current;
+    for (const auto& entry : fs::directory_iterator(directory, ec)) {
+        if (!entry.is_regular_file(ec)) continue;
+        const fs::path& p = entry.path();
+        if (p.extension() != ".glb" && p.extension() != ".GLB") continue;
+        AssetInfo info;
+        info.name = p.filename().string();
+        info.size = static_cast<uint64_t>(entry.file_size(ec));
+        info.writeTime = static_cast<int64_t>(entry.last_write_time(ec).time_since_epoch().count());
+        auto known = std::find_if(assets.begin(), assets.end(), [&](const AssetInfo& a) { return a.name == info.name; });
+        if (known != assets.end() && known->size == info.size && known->writeTime == info.writeTime) {
+            current.push_back(std::move(*known));
+            continue;
+        }
+        info.category = Classify(info.name);
+        current.push_back(std::move(info));
+        ++rescanned;
+    }
+    std::sort(current.begin(), current.end(), [](const AssetInfo& a, const AssetInfo& b) { return a.name < b.name; });
+    if (rescanned > 0 || current.size() != assets.size()) dirty = true;
+    assets = std::move(current);
+    return true;
+}
+
+bool AssetManifest::Save() {
+    if (!dirty || directory.empty()) return true;
+    const std::string file = directory + "/" + kFileName;
+    std::ofstream out(file, std::ios::trunc);
+    if (!out) {
+        error = "Ecriture impossible : " + file;
+        return false;
+    }
+    out.precision(9);
+    out << "{\n  \"version\": 1,\n  \"assets\": [\n";
+    for (size_t i = 0; i < assets.size(); ++i) {
+        const AssetInfo& a = assets[i];
+        out << "    {\"name\": ";
+        WriteString(out, a.name);
+        out << ", \"category\": ";
+        WriteString(out, a.category);
+        out << ", \"size\": " << a.size << ", \"time\": \"" << a.writeTime << "\"";
+        if (a.hasBounds) {
+            out << ", \"bounds\": [" << a.bounds.min.x << ", " << a.bounds.min.y << ", " << a.bounds.min.z << ", "
+                << a.bounds.max.x << ", " << a.bounds.max.y << ", " << a.bounds.max.z << "]";
+        }
+        out << "}" << (i + 1 < assets.size() ? ",\n" : "\n");
+    }
+    out << "  ]\n}\n";
+    dirty = !out.good();
+    return !dirty;
+}
+
+AssetInfo* AssetManifest::FindMutable(const std::string& path) {
+    if (directory.empty() || ParentKey(path) != directory) return nullptr;
+    const std::string name = fs::path(path).filename().string();
+    auto it = std::lower_bound(assets.begin(), assets.end(), name,
+                               [](const AssetInfo& a, const std::string& n) { return a.name < n; });
+    return (it != assets.end() && it->name == name) ? &*it : nullptr;
+}
+
+const AssetInfo* AssetManifest::Find(const std::string& path) const {
+    return const_cast<AssetManifest*>(this)->FindMutable(path);
+}
+
+std::vector<std::string> AssetManifest::GetPaths(const std::string& category) const {
+    std::vector<std::string> paths;
+    for (const AssetInfo& a : assets) {
+        if (a.category == category) paths.push_back(directory + "/" + a.name);
+    }
+    return paths;
+}
+
+void AssetManifest::SetBounds(const std::string& path, const BoundingBox& bounds) {
+    AssetInfo* info = FindMutable(path);
+    if (!info) return;
+    if (info->hasBounds && std::memcmp(&info->bounds, &bounds, sizeof(BoundingBox)) == 0) return;
+    info->bounds = bounds;
+    info->hasBounds = true;
+    dirty = true;
+}
+
+// ==================== CHARGEMENT ====================
+
+// Fichier déjà lu par le thread d'E/S, servi à LoadModel à la place du disque
+static const std::string* g_prefetchedPath = nullptr;
+static const std::vector<unsigned char>* g_prefetchedBytes = nullptr;
+
+static unsigned char* ServePrefetched(const char* fileName, int* dataSize) {
+    std::vector<unsigned char> fromDisk;
+    const std::vector<unsigned char>* source = g_prefetchedBytes;
+    if (!g_prefetchedPath || *g_prefetchedPath != fileName) {
+        // Autre fichier (texture externe d'un .gltf) : lecture directe
+        std::ifstream in(fileName, std::ios::binary);
+        if (!in) {
+            *dataSize = 0;
+            return nullptr;
+        }
+        fromDisk.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        source = &fromDisk;
+    }
+    // Libéré par raylib (UnloadFileData)
+    unsigned char* data = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(source->size())));
+    if (data && !source->empty()) std::memcpy(data, source->data(), source->size());
+    *dataSize = static_cast<int>(source->size());
+    return data;
+}
+
+AssetManager::AssetManager() : io(1) {}
+
+AssetManager::~AssetManager() = default;
+
+bool AssetManager::Request(const std::string& path, ReadyCallback onReady) {
+    if (IsPending(path)) return false;
+    Job job;
+    job.path = path;
+    job.onReady = std::move(onReady);
+    job.bytes = io.Submit([path]() {
+        std::ifstream in(path, std::ios::binary);
+        std::vector<unsigned char> bytes;
+        if (in) bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+        return bytes;
+    });
+    jobs.push_back(std::move(job));
+    return true;
+}
+
+bool AssetManager::OpenArchive(const std::string& file) {
+    if (archive.Open(file)) {
+        TraceLog(LOG_INFO, "[AssetManager] Archive : %d modeles (%s)", archive.GetCount(), file.c_str());
+        return true;
+    }
+    TraceLog(LOG_INFO, "[AssetManager] Pas d'archive de modeles : %s", archive.GetError().c_str());
+    return false;
+}
+
+bool AssetManager::LoadPacked(const std::string& path, Model& out) {
+    if (!archive.IsOpen()) return false;
+    const AssetInfo* info = manifest.Find(path);
+    const int index = info ? archive.Find(info->name) : -1;
+    // Fichier modifié depuis l'empaquetage : le .glb fait foi
+    if (index < 0 || !archive.IsCurrent(index, info->size, info->writeTime)) return false;
+    out = archive.Load(index);
+    if (out.meshCount <= 0) {
+        UnloadModel(out);
+        out = {};
+        return false;
+    }
+    manifest.SetBounds(path, archive.GetBounds(index));
+    return true;
+}
+
+bool AssetManager::IsPending(const std::string& path) const {
+    for (const Job& job : jobs) {
+        if (job.path == path) return true;
+    }
+    return false;
+}
+
+void AssetManager::Deliver(Job& job) {
+    const std::vector<unsigned char> bytes = job.bytes.get();
+    Model model = {};
+    if (bytes.empty()) {
+        TraceLog(LOG_WARNING, "[AssetManager] Fichier illisible : %s", job.path.c_str());
+    } else {
+        g_prefetchedPath = &job.path;
+        g_prefetchedBytes = &bytes;
+        SetLoadFileDataCallback(ServePrefetched);
+        model = LoadModel(job.path.c_str());
+        SetLoadFileDataCallback(nullptr);
+        g_prefetchedPath = nullptr;
+        g_prefetchedBytes = nullptr;
+    }
+    if (model.meshCount > 0) manifest.SetBounds(job.path, GetModelBoundingBox(model));
+    if (job.onReady) job.onReady(job.path, model);
+    else if (model.meshCount > 0) UnloadModel(model);
+}
+
+int AssetManager::Update(float budgetSeconds) {
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point start = Clock::now();
+    int delivered = 0;
+    while (delivered == 0 || Clock::now() - start < std::chrono::duration<float>(budgetSeconds)) {
+        // Premier fichier déjà lu, dans l'ordre des demandes
+        auto ready = std::find_if(jobs.begin(), jobs.end(), [](const Job& job) {
+            return job.bytes.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        });
+        if (ready == jobs.end()) break;
+        Job job = std::move(*ready);
+        jobs.erase(ready); // avant le callback, qui peut faire une nouvelle demande
+        Deliver(job);
+        ++delivered;
+    }
+    return delivered;
+}
+
+int AssetManager::Finish() {
+    int delivered = 0;
+    while (!jobs.empty()) {
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+        Deliver(job);
+        ++delivered;
+    }
+    return delivered;
+}
@@ -0,0 +1,106 @@
+#include "core/FileWatcher.h"
+#include <filesystem>
+
+#ifdef __linux__
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+FileWatcher::~FileWatcher() {
+    Close();
+}
+
+#ifdef __linux__
+
+bool FileWatcher::Watch(const std::string& filePath) {
+    Close();
+    std::filesystem::path p(filePath);
+    path = filePath;
+    fileName = p.filename().string();
+    const std::string dir = p.has_parent_path() ? p.parent_path().string() : ".";
+
+    inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (inotifyFd < 0) {
+        error = "Cannot initialise inotify";
+        return false;
+    }
+    // Écriture terminée, ou fichier remplacé par renommage / recréé
+    watchId = inotify_add_watch(inotifyFd, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+    if (watchId < 0) {
+        Close();
+        error = "Cannot watch directory: " + dir;
+        return false;
+    }
+    watching = true;
+    return true;
+}
+
+void FileWatcher::Close() {
+    if (inotifyFd >= 0) ::close(inotifyFd); // retire aussi la surveillance du dossier
+    inotifyFd = -1;
+    watchId = -1;
+    watching = false;
+    pending = false;
+}
+
+bool FileWatcher::Poll() {
+    if (!watching) return false;
+    alignas(inotify_event) char buffer[4096];
+    for (;;) {
+        ssize_t n = ::read(inotifyFd, buffer, sizeof(buffer));
+        if (n <= 0) break; // EAGAIN : plus rien en attente
+        for (char* p = buffer; p < buffer + n;) {
+            const inotify_event* e = reinterpret_cast<const inotify_event*>(p);
+            if (e->len > 0 && fileName == e->name) {
+                pending = true;
+                lastEvent = Clock::now();
+            }
+            p += sizeof(inotify_event) + e->len;
+        }
+    }
+    if (!pending || Clock::now() - lastEvent < std::chrono::duration<float>(kSettle)) return false;
+    pending = false;
+    return true;
+}
+
+#else
+
+long long FileWatcher::ReadWriteTime() const {
+    std::error_code ec;
+    auto time = std::filesystem::last_write_time(path, ec);
+    return ec ? 0 : static_cast<long long>(time.time_since_epoch().count());
+}
+
+bool FileWatcher::Watch(const std::string& filePath) {
+    Close();
+    path = filePath;
+    fileName = std::filesystem::path(filePath).filename().string();
+    lastWrite = ReadWriteTime();
+    lastStat = Clock::now();
+    watching = true;
+    return true;
+}
+
+void FileWatcher::Close() {
+    watching = false;
+    pending = false;
+}
+
+bool FileWatcher::Poll() {
+    if (!watching) return false;
+    const Clock::time_point now = Clock::now();
+    if (now - lastStat >= std::chrono::duration<float>(kStatInterval)) {
+        lastStat = now;
+        long long write = ReadWriteTime();
+        if (write != lastWrite) {
+            lastWrite = write;
+            pending = true;
+            lastEvent = now;
+        }
+    }
+    if (!pending || now - lastEvent < std::chrono::duration<float>(kSettle)) return false;
+    pending = false;
+    return true;
+}
+
+#endif
@@ -0,0 +1,272 @@
+#include "core/JsonReader.h"
+#include <charconv>
+
+JsonReader::JsonReader(std::string_view text) : text(text) {
+    // BOM UTF-8 éventuel
+    if (this->text.size() >= 3 && this->text.compare(0, 3, "\xEF\xBB\xBF") == 0) pos = 3;
+}
+
+bool JsonReader::Fail(const char* message) {
+    if (!failed) {
+        failed = true;
+        errorOffset = pos;
+        errorMessage = message;
+    }
+    return false;
+}
+
+std::string JsonReader::GetError() const {
+    if (!failed) return std::string();
+    // Position calculée seulement en cas d'erreur
+    int line = 1, column = 1;
+    for (size_t i = 0; i < errorOffset && i < text.size(); ++i) {
+        if (text[i] == '\n') { ++line; column = 1; }
+        else ++column;
+    }
+    return "ligne " + std::to_string(line) + ", colonne " + std::to_string(column) + " : " + errorMessage;
+}
+
+void JsonReader::SkipWhitespace() {
+    while (pos < text.size()) {
+        char c = text[pos];
+        if (c != ' ' && c != '\n' && c != '\r' && c != '\t') break;
+        ++pos;
+    }
+}
+
+bool JsonReader::Expect(char c, const char* message) {
+    SkipWhitespace();
+    if (pos >= text.size() || text[pos] != c) return Fail(message);
+    ++pos;
+    return true;
+}
+
+JsonType JsonReader::Peek() {
+    if (failed) return JsonType::Invalid;
+    SkipWhitespace();
+    if (pos >= text.size()) return JsonType::End;
+    switch (text[pos]) {
+        case '{': return JsonType::Object;
+        case '[': return JsonType::Array;
+        case '"': return JsonType::String;
+        case 't': case 'f': return JsonType::Bool;
+        case 'n': return JsonType::Null;
+        case '}': case ']': return JsonType::End;
+        default:
+            if (text[pos] == '-' || (text[pos] >= '0' && text[pos] <= '9')) return JsonType::Number;
+            return JsonType::Invalid;
+    }
+}
+
+bool JsonReader::Push(bool isObject) {
+    if (failed) return false;
+    if (!Expect(isObject ? '{' : '[', isObject ? "objet attendu" : "tableau attendu")) return false;
+    if (depth >= kMaxDepth) return Fail("imbrication trop profonde");
+    firstInContainer[depth++] = true;
+    return true;
+}
+
+bool JsonReader::BeginObject() { return Push(true); }
+bool JsonReader::BeginArray() { return Push(false); }
+
+bool JsonReader::NextMember(std::string_view& key) {
+    if (failed || depth == 0) return false;
+    SkipWhitespace();
+    if (pos < text.size() && text[pos] == '}') {
+        ++pos;
+        --depth;
+        return false;
+    }
+    if (!firstInContainer[depth - 1] && !Expect(',', "',' ou '}' attendu")) return false;
+    firstInContainer[depth - 1] = false;
+    SkipWhitespace();
+    if (pos >= text.size() || text[pos] != '"') return Fail("cle attendue");
+    if (!ScanString(key)) return false;
+    return Expect(':', "':' attendu");
+}
+
+bool JsonReader::NextElement() {
+    if (failed || depth == 0) return false;
+    SkipWhitespace();
+    if (pos < text.size() && text[pos] == ']') {
+        ++pos;
+        --depth;
+        return false;
+    }
+    if (!firstInContainer[depth - 1] && !Expect(',', "',' ou ']' attendu")) return false;
+    firstInContainer[depth - 1] = false;
+    return true;
+}
+
+bool JsonReader::ScanString(std::string_view& out) {
+    size_t start = ++pos; // après le guillemet ouvrant
+    while (pos < text.size()) {
+        char c = text[pos];
+        if (c == '"') {
+            out = text.substr(start, pos - start);
+            ++pos;
+            return true;
+        }
+        if (c == '\\') ++pos; // le caractère échappé ne termine pas la chaîne
+        else if (static_cast<unsigned char>(c) < 0x20) return Fail("caractere de controle dans une chaine");
+        ++pos;
+    }
+    pos = start - 1;
+    return Fail("chaine non terminee");
+}
+
+bool JsonReader::ScanNumber(std::string_view& out) {
+    size_t start = pos;
+    if (pos < text.size() && text[pos] == '-') ++pos;
+    size_t digits = pos;
+    while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') ++pos;
+    if (pos == digits) return Fail("nombre invalide");
+    if (pos < text.size() && text[pos] == '.') {
+        size_t frac = ++pos;
+        while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') ++pos;
+        if (pos == frac) return Fail("nombre invalide");
+    }
+    if (pos < text.size() && (text[pos] == 'e' || text[pos] == 'E')) {
+        ++pos;
+        if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) ++pos;
+        size_t exp = pos;
+        while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') ++pos;
+        if (pos == exp) return Fail("nombre invalide");
+    }
+    out = text.substr(start, pos - start);
+    return true;
+}
+
+bool JsonReader::ScanLiteral(std::string_view literal) {
+    if (text.compare(pos, literal.size(), literal) != 0) return Fail("valeur invalide");
+    pos += literal.size();
+    return true;
+}
+
+bool JsonReader::ReadNumber(double& out) {
+    if (Peek() != JsonType::Number) return Fail("nombre attendu");
+    std::string_view span;
+    if (!ScanNumber(span)) return false;
+    auto res = std::from_chars(span.data(), span.data() + span.size(), out);
+    if (res.ec != std::errc()) {
+        pos -= span.size();
+        return Fail("nombre hors limites");
+    }
+    return true;
+}
+
+bool JsonReader::ReadFloat(float& out) {
+    double v;
+    if (!ReadNumber(v)) return false;
+    out = static_cast<float>(v);
+    return true;
+}
+
+bool JsonReader::ReadInt(int& out) {
+    if (Peek() != JsonType::Number) return Fail("entier attendu");
+    std::string_view span;
+    if (!ScanNumber(span)) return false;
+    const char* end = span.data() + span.size();
+    auto res = std::from_chars(span.data(), end, out);
+    if (res.ec == std::errc() && res.ptr == end) return true;
+    // Écriture décimale ("3.0", "1e3") : tronquée comme un cast
+    double v;
+    res = std::from_chars(span.data(), end, v);
+    if (res.ec != std::errc() || v < -2147483648.0 || v > 2147483647.0) {
+        pos -= span.size();
+        return Fail("entier hors limites");
+    }
+    out = static_cast<int>(v);
+    return true;
+}
+
+bool JsonReader::ReadBool(bool& out) {
+    if (Peek() != JsonType::Bool) return Fail("booleen attendu");
+    out = text[pos] == 't';
+    return ScanLiteral(out ? "true" : "false");
+}
+
+bool JsonReader::ReadString(std::string_view& out) {
+    if (Peek() != JsonType::String) return Fail("chaine attendue");
+    return ScanString(out);
+}
+
+bool JsonReader::ReadNull() {
+    if (Peek() != JsonType::Null) return Fail("null attendu");
+    return ScanLiteral("null");
+}
+
+bool JsonReader::Skip() {
+    std::string_view ignored;
+    switch (Peek()) {
+        case JsonType::Object: {
+            if (!BeginObject()) return false;
+            while (NextMember(ignored)) {
+                if (!Skip()) return false;
+            }
+            return !failed;
+        }
+        case JsonType::Array: {
+            if (!BeginArray()) return false;
+            while (NextElement()) {
+                if (!Skip()) return false;
+            }
+            return !failed;
+        }
+        case JsonType::String: return ScanString(ignored);
+        case JsonType::Number: return ScanNumber(ignored);
+        case JsonType::Bool: { bool b; return ReadBool(b); }
+        case JsonType::Null: return ReadNull();
+        case JsonType::End: return Fail("valeur attendue");
+        default: return Fail("valeur invalide");
+    }
+}
+
+bool JsonReader::Finish() {
+    if (failed) return false;
+    SkipWhitespace();
+    if (pos != text.size()) return Fail("contenu inattendu apres la racine");
+    return true;
+}
+
+std::string JsonReader::Unescape(std::string_view raw) {
+    std::string out;
+    out.reserve(raw.size());
+    for (size_t i = 0; i < raw.size(); ++i) {
+        char c = raw[i];
+        if (c != '\\' || i + 1 >= raw.size()) {
+            out.push_back(c);
+            continue;
+        }
+        char e = raw[++i];
+        switch (e) {
+            case 'n': out.push_back('\n'); break;
+            case 't': out.push_back('\t'); break;
+            case 'r': out.push_back('\r'); break;
+            case 'b': out.push_back('\b'); break;
+            case 'f': out.push_back('\f'); break;
+            case 'u': {
+                // \uXXXX -> UTF-8 (plan multilingue de base)
+                unsigned code = 0;
+                if (i + 4 < raw.size() &&
+                    std::from_chars(raw.data() + i + 1, raw.data() + i + 5, code, 16).ptr == raw.data() + i + 5) {
+                    i += 4;
+                    if (code < 0x80) out.push_back(static_cast<char>(code));
+                    else if (code < 0x800) {
+                        out.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                    } else {
+                        out.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                        out.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                        out.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                    }
+                } else {
+                    out.push_back(e);
+                }
+                break;
+            }
+            default: out.push_back(e); break; // \" \\ \/
+        }
+    }
+    return out;
+}
@@ -0,0 +1,125 @@
+#include "core/MappedFile.h"
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::~MappedFile() {
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& other) noexcept {
+    *this = std::move(other);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        Close();
+        data = std::exchange(other.data, nullptr);
+        size = std::exchange(other.size, 0);
+        opened = std::exchange(other.opened, false);
+        error = std::move(other.error);
+#ifdef _WIN32
+        fileHandle = std::exchange(other.fileHandle, nullptr);
+        mappingHandle = std::exchange(other.mappingHandle, nullptr);
+#endif
+    }
+    return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        error = "Cannot open file: " + path;
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        error = "Cannot stat file: " + path;
+        return false;
+    }
+    fileHandle = file;
+    opened = true;
+    size = static_cast<size_t>(fileSize.QuadPart);
+    if (size == 0) return true;
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (mapping) CloseHandle(mapping);
+        Close();
+        error = "Cannot map file: " + path;
+        return false;
+    }
+    mappingHandle = mapping;
+    data = static_cast<const char*>(view);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data) UnmapViewOfFile(data);
+    if (mappingHandle) CloseHandle(static_cast<HANDLE>(mappingHandle));
+    if (fileHandle) CloseHandle(static_cast<HANDLE>(fileHandle));
+    data = nullptr;
+    mappingHandle = nullptr;
+    fileHandle = nullptr;
+    size = 0;
+    opened = false;
+}
+
+#else
+
+bool MappedFile::Open(const std::string& path) {
+    Close();
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        error = "Cannot open file: " + path;
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        error = "Cannot stat file: " + path;
+        return false;
+    }
+    opened = true;
+    size = static_cast<size_t>(st.st_size);
+    if (size == 0) {
+        ::close(fd);
+        return true;
+    }
+
+    void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // la projection reste valide après fermeture du descripteur
+    if (view == MAP_FAILED) {
+        size = 0;
+        opened = false;
+        error = "Cannot map file: " + path;
+        return false;
+    }
+    madvise(view, size, MADV_SEQUENTIAL);
+    data = static_cast<const char*>(view);
+    return true;
+}
+
+void MappedFile::Close() {
+    if (data) munmap(const_cast<char*>(data), size);
+    data = nullptr;
+    size = 0;
+    opened = false;
+}
+
+#endif
@@ -0,0 +1,426 @@
+#include "core/ModelArchive.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <type_traits>
+
+constexpr char ModelArchive::kMagic[8];
+
+namespace {
+
+enum SectionKind : uint32_t {
+    kModels = 1,
+    kMeshes,
+    kMaterials,
+    kNames,
+    kData, // tableaux de sommets, d'indices et de pixels
+};
+
+constexpr uint32_t kByteOrderMark = 0x01020304;
+constexpr size_t kSectionAlignment = 16;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint32_t sectionCount;
+    uint32_t flags;
+    uint64_t fileSize;
+};
+
+struct SectionEntry {
+    uint32_t kind;
+    uint32_t elementSize;
+    uint64_t offset;
+    uint64_t count;
+};
+
+// Maillages [firstMesh, firstMesh + meshCount), matériaux de même ; nom dans la section kNames
+struct ModelRecord {
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t firstMesh;
+    uint32_t meshCount;
+    uint32_t firstMaterial;
+    uint32_t materialCount;
+    float bounds[6]; // min, max
+    uint64_t sourceSize;
+    int64_t sourceTime;
+};
+
+enum MeshAttribute : uint32_t {
+    kNormals = 1u << 0,
+    kTexcoords = 1u << 1,
+    kColors = 1u << 2,
+    kIndices = 1u << 3,
+};
+
+// Décalages des tableaux dans la section kData (positions toujours présentes)
+struct MeshRecord {
+    uint32_t vertexCount;
+    uint32_t triangleCount;
+    uint32_t material; // relatif au premier matériau du modèle
+    uint32_t attributes;
+    uint64_t vertices;
+    uint64_t normals;
+    uint64_t texcoords;
+    uint64_t colors;
+    uint64_t indices;
+};
+
+// Texture de base width x height en RGBA8 à pixels (width 0 : couleur seule)
+struct MaterialRecord {
+    uint8_t color[4];
+    uint32_t width;
+    uint32_t height;
+    uint32_t reserved;
+    uint64_t pixels;
+};
+
+static_assert(sizeof(FileHeader) == 32, "en-tete .scpak : 32 octets");
+static_assert(sizeof(SectionEntry) == 24, "entree de section : 24 octets");
+static_assert(sizeof(ModelRecord) == 64, "enregistrement modele : 64 octets");
+static_assert(sizeof(MeshRecord) == 56, "enregistrement maillage : 56 octets");
+static_assert(sizeof(MaterialRecord) == 24, "enregistrement materiau : 24 octets");
+
+size_t Align(size_t v) { return (v + kSectionAlignment - 1) & ~(kSectionAlignment - 1); }
+
+// Section kData en construction : chaque tableau commence sur une frontière de 16 octets
+class DataWriter {
+public:
+    uint64_t Add(const void* source, size_t bytes) {
+        const size_t offset = Align(blob.size());
+        blob.resize(offset + bytes);
+        if (bytes) std::memcpy(&blob[offset], source, bytes);
+        return offset;
+    }
+    std::vector<char> blob;
+};
+
+struct PendingSection {
+    SectionEntry entry;
+    const char* bytes;
+    size_t size;
+};
+
+template <class T>
+PendingSection MakeSection(uint32_t kind, const std::vector<T>& items) {
+    static_assert(std::is_trivially_copyable<T>::value, "section = tableau d'enregistrements POD");
+    return {SectionEntry{kind, static_cast<uint32_t>(sizeof(T)), 0, items.size()},
+            reinterpret_cast<const char*>(items.data()), items.size() * sizeof(T)};
+}
+
+std::string Assemble(std::vector<PendingSection> sections) {
+    size_t offset = Align(sizeof(FileHeader) + sections.size() * sizeof(SectionEntry));
+    for (PendingSection& s : sections) {
+        s.entry.offset = offset;
+        offset = Align(offset + s.size);
+    }
+
+    FileHeader header{};
+    std::memcpy(header.magic, ModelArchive::kMagic, sizeof(header.magic));
+    header.version = ModelArchive::kVersion;
+    header.byteOrder = kByteOrderMark;
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    header.fileSize = offset;
+
+    std::string out(offset, '\0');
+    std::memcpy(&out[0], &header, sizeof(header));
+    for (size_t i = 0; i < sections.size(); ++i) {
+        std::memcpy(&out[sizeof(header) + i * sizeof(SectionEntry)], &sections[i].entry, sizeof(SectionEntry));
+        if (sections[i].size) std::memcpy(&out[sections[i].entry.offset], sections[i].bytes, sections[i].size);
+    }
+    return out;
+}
+
+template <class T>
+T* CopyArray(const char* source, size_t count) {
+    T* out = static_cast<T*>(MemAlloc(static_cast<unsigned int>(count * sizeof(T))));
+    if (out && count) std::memcpy(out, source, count * sizeof(T));
+    return out;
+}
+
+bool InData(uint64_t offset, uint64_t bytes, uint64_t dataSize) {
+    return offset <= dataSize && bytes <= dataSize - offset;
+}
+
+} // namespace
+
+std::string ModelArchive::Serialize(const std::vector<Source>& sources) {
+    std::vector<ModelRecord> modelRecords;
+    std::vector<MeshRecord> meshRecords;
+    std::vector<MaterialRecord> materialRecords;
+    std::vector<char> names;
+    DataWriter data;
+    const bool gpu = IsWindowReady();
+
+    for (const Source& source : sources) {
+        if (!source.model) continue;
+        const Model& model = *source.model;
+        ModelRecord record{};
+        record.nameOffset = static_cast<uint32_t>(names.size());
+        record.nameLength = static_cast<uint32_t>(source.name.size());
+        names.insert(names.end(), source.name.begin(), source.name.end());
+        record.firstMesh = static_cast<uint32_t>(meshRecords.size());
+        record.firstMaterial = static_cast<uint32_t>(materialRecords.size());
+        record.sourceSize = source.size;
+        record.sourceTime = source.writeTime;
+        const BoundingBox bounds = GetModelBoundingBox(model);
+        std::memcpy(record.bounds, &bounds, sizeof(record.bounds));
+
+        // Au moins un matériau, comme LoadModel
+        const int materialCount = std::max(model.materialCount, 1);
+        for (int m = 0; m < materialCount; ++m) {
+            MaterialRecord mr{};
+            Color color = WHITE;
+            if (m < model.materialCount && model.materials[m].maps) {
+                const MaterialMap& albedo = model.materials[m].maps[MATERIAL_MAP_ALBEDO];
+                color = albedo.color;
+                if (gpu && albedo.texture.id > 0) {
+                    Image image = LoadImageFromTexture(albedo.texture);
+                    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+                    if (image.data && image.width > 0 && image.height > 0) {
+                        mr.width = static_cast<uint32_t>(image.width);
+                        mr.height = static_cast<uint32_t>(image.height);
+                        mr.pixels = data.Add(image.data, static_cast<size_t>(mr.width) * mr.height * 4);
+                    }
+                    UnloadImage(image);
+                }
+            }
+            std::memcpy(mr.color, &color, sizeof(mr.color));
+            materialRecords.push_back(mr);
+        }
+        record.materialCount = static_cast<uint32_t>(materialCount);
+
+        for (int i = 0; i < model.meshCount; ++i) {
+            const Mesh& mesh = model.meshes[i];
+            if (mesh.vertexCount <= 0 || !mesh.vertices) continue;
+            const size_t n = static_cast<size_t>(mesh.vertexCount);
+            MeshRecord mr{};
+            mr.vertexCount = static_cast<uint32_t>(mesh.vertexCount);
+            mr.triangleCount = static_cast<uint32_t>(mesh.triangleCount);
+            const int material = model.meshMaterial ? model.meshMaterial[i] : 0;
+            mr.material = static_cast<uint32_t>(std::min(std::max(material, 0), materialCount - 1));
+            mr.vertices = data.Add(mesh.vertices, n * 3 * sizeof(float));
+            if (mesh.normals) {
+                mr.attributes |= kNormals;
+                mr.normals = data.Add(mesh.normals, n * 3 * sizeof(float));
+            }
+            if (mesh.texcoords) {
+                mr.attributes |= kTexcoords;
+                mr.texcoords = data.Add(mesh.texcoords, n * 2 * sizeof(float));
+            }
+            if (mesh.colors) {
+                mr.attributes |= kColors;
+                mr.colors = data.Add(mesh.colors, n * 4);
+            }
+            if (mesh.indices) {
+                mr.attributes |= kIndices;
+                mr.indices = data.Add(mesh.indices, static_cast<size_t>(mesh.triangleCount) * 3 * sizeof(unsigned short));
+            }
+            meshRecords.push_back(mr);
+        }
+        record.meshCount = static_cast<uint32_t>(meshRecords.size()) - record.firstMesh;
+        modelRecords.push_back(record);
+    }
+
+    return Assemble({MakeSection(kModels, modelRecords), MakeSection(kMeshes, meshRecords),
+                     MakeSection(kMaterials, materialRecords), MakeSection(kNames, names),
+                     MakeSection(kData, data.blob)});
+}
+
+bool ModelArchive::Write(const std::vector<Source>& models, const std::string& path, std::string* error) {
+    std::string bytes = Serialize(models);
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out || !out.write(bytes.data(), static_cast<std::streamsize>(bytes.size()))) {
+        if (error) *error = "ecriture impossible : " + path;
+        return false;
+    }
+    return true;
+}
+
+bool ModelArchive::Open(const std::string& path) {
+    Close();
+    if (!file.Open(path)) {
+        error = file.GetError();
+        return false;
+    }
+    if (!Index(file.View())) {
+        const std::string message = path + " : " + error;
+        Close();
+        error = message;
+        return false;
+    }
+    return true;
+}
+
+void ModelArchive::Close() {
+    file.Close();
+    models.clear();
+    byName.clear();
+    meshes = materials = data = Section();
+    error.clear();
+}
+
+bool ModelArchive::Index(std::string_view bytes) {
+    auto fail = [&](const std::string& m) {
+        error = m;
+        return false;
+    };
+
+    FileHeader header{};
+    if (bytes.size() < sizeof(FileHeader) || std::memcmp(bytes.data(), kMagic, sizeof(kMagic)) != 0) {
+        return fail("signature .scpak absente");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (header.byteOrder != kByteOrderMark) return fail("ordre des octets incompatible");
+    if (header.version != kVersion) {
+        return fail("version " + std::to_string(header.version) + " non supportee (attendu "
+                    + std::to_string(kVersion) + "), relancer smartcity-assetpack");
+    }
+    if (header.fileSize > bytes.size()
+        || header.sectionCount > (bytes.size() - sizeof(FileHeader)) / sizeof(SectionEntry)) {
+        return fail("fichier tronque");
+    }
+
+    Section modelSection, nameSection;
+    for (uint32_t i = 0; i < header.sectionCount; ++i) {
+        SectionEntry e;
+        std::memcpy(&e, bytes.data() + sizeof(FileHeader) + i * sizeof(SectionEntry), sizeof(e));
+        if (e.elementSize == 0 || e.offset > header.fileSize
+            || e.count > (header.fileSize - e.offset) / e.elementSize) {
+            return fail("section " + std::to_string(e.kind) + " hors du fichier");
+        }
+        // Sections inconnues ignorées ; taille d'enregistrement vérifiée pour les autres
+        Section* target = nullptr;
+        uint32_t expected = 0;
+        switch (e.kind) {
+            case kModels: target = &modelSection; expected = sizeof(ModelRecord); break;
+            case kMeshes: target = &meshes; expected = sizeof(MeshRecord); break;
+            case kMaterials: target = &materials; expected = sizeof(MaterialRecord); break;
+            case kNames: target = &nameSection; expected = 1; break;
+            case kData: target = &data; expected = 1; break;
+            default: continue;
+        }
+        if (e.elementSize != expected) return fail("section " + std::to_string(e.kind) + " de format inattendu");
+        *target = Section{e.offset, e.count};
+    }
+
+    // Tous les tableaux sont vérifiés ici : Load() n'a plus qu'à recopier
+    for (uint64_t i = 0; i < meshes.count; ++i) {
+        MeshRecord r;
+        std::memcpy(&r, bytes.data() + meshes.offset + i * sizeof(MeshRecord), sizeof(r));
+        const uint64_t n = r.vertexCount;
+        bool ok = n > 0 && InData(r.vertices, n * 3 * sizeof(float), data.count);
+        if (r.attributes & kNormals) ok = ok && InData(r.normals, n * 3 * sizeof(float), data.count);
+        if (r.attributes & kTexcoords) ok = ok && InData(r.texcoords, n * 2 * sizeof(float), data.count);
+        if (r.attributes & kColors) ok = ok && InData(r.colors, n * 4, data.count);
+        if (r.attributes & kIndices) {
+            ok = ok && InData(r.indices, uint64_t(r.triangleCount) * 3 * sizeof(unsigned short), data.count);
+            for (uint64_t k = 0; ok && k < uint64_t(r.triangleCount) * 3; ++k) {
+                unsigned short v;
+                std::memcpy(&v, bytes.data() + data.offset + r.indices + k * sizeof(v), sizeof(v));
+                ok = v < n;
+            }
+        } else {
+            ok = ok && uint64_t(r.triangleCount) * 3 <= n;
+        }
+        if (!ok) return fail("maillage " + std::to_string(i) + " hors de la section de donnees");
+    }
+    for (uint64_t i = 0; i < materials.count; ++i) {
+        MaterialRecord r;
+        std::memcpy(&r, bytes.data() + materials.offset + i * sizeof(MaterialRecord), sizeof(r));
+        if (r.width && !InData(r.pixels, uint64_t(r.width) * r.height * 4, data.count)) {
+            return fail("texture " + std::to_string(i) + " hors de la section de donnees");
+        }
+    }
+
+    std::vector<Entry> entries;
+    entries.reserve(static_cast<size_t>(modelSection.count));
+    for (uint64_t i = 0; i < modelSection.count; ++i) {
+        ModelRecord r;
+        std::memcpy(&r, bytes.data() + modelSection.offset + i * sizeof(ModelRecord), sizeof(r));
+        if (uint64_t(r.nameOffset) + r.nameLength > nameSection.count
+            || uint64_t(r.firstMesh) + r.meshCount > meshes.count
+            || uint64_t(r.firstMaterial) + r.materialCount > materials.count || r.materialCount == 0) {
+            return fail("modele " + std::to_string(i) + " incoherent");
+        }
+        for (uint32_t m = 0; m < r.meshCount; ++m) {
+            MeshRecord mesh;
+            std::memcpy(&mesh, bytes.data() + meshes.offset + (r.firstMesh + m) * sizeof(MeshRecord), sizeof(mesh));
+            if (mesh.material >= r.materialCount) return fail("modele " + std::to_string(i) + " incoherent");
+        }
+        Entry e;
+        e.name.assign(bytes.data() + nameSection.offset + r.nameOffset, r.nameLength);
+        e.size = r.sourceSize;
+        e.writeTime = r.sourceTime;
+        std::memcpy(&e.bounds, r.bounds, sizeof(r.bounds));
+        e.firstMesh = r.firstMesh;
+        e.meshCount = r.meshCount;
+        e.firstMaterial = r.firstMaterial;
+        e.materialCount = r.materialCount;
+        entries.push_back(std::move(e));
+    }
+
+    models = std::move(entries);
+    for (size_t i = 0; i < models.size(); ++i) byName[models[i].name] = static_cast<int>(i);
+    return true;
+}
+
+int ModelArchive::Find(const std::string& name) const {
+    auto it = byName.find(name);
+    return it == byName.end() ? -1 : it->second;
+}
+
+bool ModelArchive::IsCurrent(int index, uint64_t size, int64_t writeTime) const {
+    return index >= 0 && index < GetCount() && models[index].size == size && models[index].writeTime == writeTime;
+}
+
+Model ModelArchive::Load(int index) const {
+    Model model = {};
+    if (index < 0 || index >= GetCount()) return model;
+    const Entry& e = models[index];
+    const char* base = file.Data();
+    const char* blob = base + data.offset;
+    const bool gpu = IsWindowReady();
+
+    model.transform = MatrixIdentity();
+    model.meshCount = static_cast<int>(e.meshCount);
+    model.meshes = static_cast<Mesh*>(MemAlloc(static_cast<unsigned int>(e.meshCount * sizeof(Mesh))));
+    model.meshMaterial = static_cast<int*>(MemAlloc(static_cast<unsigned int>(e.meshCount * sizeof(int))));
+    for (uint32_t i = 0; i < e.meshCount; ++i) {
+        MeshRecord r;
+        std::memcpy(&r, base + meshes.offset + (e.firstMesh + i) * sizeof(MeshRecord), sizeof(r));
+        const size_t n = r.vertexCount;
+        Mesh& mesh = model.meshes[i];
+        mesh.vertexCount = static_cast<int>(r.vertexCount);
+        mesh.triangleCount = static_cast<int>(r.triangleCount);
+        // Tableaux CPU gardés (boîte englobante, LOD) : libérés par UnloadModel comme ceux de LoadModel
+        mesh.vertices = CopyArray<float>(blob + r.vertices, n * 3);
+        if (r.attributes & kNormals) mesh.normals = CopyArray<float>(blob + r.normals, n * 3);
+        if (r.attributes & kTexcoords) mesh.texcoords = CopyArray<float>(blob + r.texcoords, n * 2);
+        if (r.attributes & kColors) mesh.colors = CopyArray<unsigned char>(blob + r.colors, n * 4);
+        if (r.attributes & kIndices) mesh.indices = CopyArray<unsigned short>(blob + r.indices, size_t(r.triangleCount) * 3);
+        model.meshMaterial[i] = static_cast<int>(r.material);
+        if (gpu) UploadMesh(&mesh, false);
+    }
+
+    model.materialCount = static_cast<int>(e.materialCount);
+    model.materials = static_cast<Material*>(MemAlloc(static_cast<unsigned int>(e.materialCount * sizeof(Material))));
+    for (uint32_t i = 0; i < e.materialCount; ++i) {
+        MaterialRecord r;
+        std::memcpy(&r, base + materials.offset + (e.firstMaterial + i) * sizeof(MaterialRecord), sizeof(r));
+        Material& material = model.materials[i];
+        material = LoadMaterialDefault();
+        if (!material.maps) continue;
+        std::memcpy(&material.maps[MATERIAL_MAP_ALBEDO].color, r.color, sizeof(r.color));
+        if (gpu && r.width > 0) {
+            // Pixels lus directement dans la projection : LoadTextureFromImage ne fait que les envoyer
+            Image image = {const_cast<char*>(blob + r.pixels), static_cast<int>(r.width), static_cast<int>(r.height),
+                           1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+            material.maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(image);
+        }
+    }
+    return model;
+}
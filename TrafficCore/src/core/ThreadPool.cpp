@@ -0,0 +1,51 @@
+#include "core/ThreadPool.h"
+#include <algorithm>
+
+ThreadPool::ThreadPool(unsigned threadCount) {
+    if (threadCount == 0) {
+        unsigned hw = std::thread::hardware_concurrency();
+        threadCount = std::max(1u, hw > 1 ? hw - 1 : 1u);
+    }
+    workers.reserve(threadCount);
+    for (unsigned i = 0; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::WorkerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wakeUp.notify_all();
+    for (auto& t : workers) {
+        if (t.joinable()) t.join();
+    }
+}
+
+size_t ThreadPool::GetQueuedCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return jobs.size();
+}
+
+void ThreadPool::Enqueue(std::function<void()> job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        jobs.push_back(std::move(job));
+    }
+    wakeUp.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+    for (;;) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            wakeUp.wait(lock, [this] { return stopping || !jobs.empty(); });
+            if (jobs.empty()) return; // stopping et file vidée
+            job = std::move(jobs.front());
+            jobs.pop_front();
+        }
+        job();
+    }
+}
@@ -0,0 +1,106 @@
+#include "core/XmlReader.h"
+#include <cstring>
+
+static bool IsSpace(char c) {
+    return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+XmlReader::XmlReader(std::string_view text) : text(text) {}
+
+XmlEvent XmlReader::Fail(const char* message) {
+    if (!failed) {
+        failed = true;
+        errorOffset = pos;
+        errorMessage = message;
+    }
+    return XmlEvent::Invalid;
+}
+
+std::string XmlReader::GetError() const {
+    if (!failed) return std::string();
+    // Position calculée seulement en cas d'erreur
+    int line = 1, column = 1;
+    for (size_t i = 0; i < errorOffset && i < text.size(); ++i) {
+        if (text[i] == '\n') { ++line; column = 1; }
+        else ++column;
+    }
+    return "ligne " + std::to_string(line) + ", colonne " + std::to_string(column) + " : " + errorMessage;
+}
+
+XmlEvent XmlReader::Next() {
+    if (failed) return XmlEvent::Invalid;
+    for (;;) {
+        // Texte entre balises ignoré : recherche directe du prochain '<'
+        const void* lt = pos < text.size() ? std::memchr(text.data() + pos, '<', text.size() - pos) : nullptr;
+        if (!lt) {
+            pos = text.size();
+            return XmlEvent::End;
+        }
+        pos = static_cast<const char*>(lt) - text.data();
+        std::string_view rest = text.substr(pos);
+
+        // Commentaires, CDATA, déclarations : sautés en entier
+        const char* closer = nullptr;
+        if (rest.compare(0, 4, "<!--") == 0) closer = "-->";
+        else if (rest.compare(0, 9, "<![CDATA[") == 0) closer = "]]>";
+        else if (rest.compare(0, 2, "<?") == 0) closer = "?>";
+        else if (rest.compare(0, 2, "<!") == 0) closer = ">";
+        if (closer) {
+            size_t end = text.find(closer, pos + 2);
+            if (end == std::string_view::npos) return Fail("balise speciale non fermee");
+            pos = end + std::strlen(closer);
+            continue;
+        }
+
+        const bool closing = rest.size() > 1 && rest[1] == '/';
+        size_t nameStart = pos + (closing ? 2 : 1);
+        size_t i = nameStart;
+        while (i < text.size() && !IsSpace(text[i]) && text[i] != '/' && text[i] != '>') ++i;
+        if (i == nameStart) return Fail("nom de balise attendu");
+        name = text.substr(nameStart, i - nameStart);
+
+        // Fin de balise, en ignorant les '>' entre guillemets
+        size_t attrStart = i;
+        char quote = 0;
+        while (i < text.size() && (quote || text[i] != '>')) {
+            if (quote) {
+                if (text[i] == quote) quote = 0;
+            } else if (text[i] == '"' || text[i] == '\'') {
+                quote = text[i];
+            }
+            ++i;
+        }
+        if (i >= text.size()) return Fail("balise non fermee");
+
+        selfClosing = !closing && i > attrStart && text[i - 1] == '/';
+        attributes = text.substr(attrStart, i - attrStart - (selfClosing ? 1 : 0));
+        pos = i + 1;
+        return closing ? XmlEvent::EndElement : XmlEvent::StartElement;
+    }
+}
+
+bool XmlReader::Attribute(std::string_view key, std::string_view& value) const {
+    size_t i = 0;
+    const size_t n = attributes.size();
+    while (i < n) {
+        while (i < n && IsSpace(attributes[i])) ++i;
+        size_t keyStart = i;
+        while (i < n && attributes[i] != '=' && !IsSpace(attributes[i])) ++i;
+        std::string_view k = attributes.substr(keyStart, i - keyStart);
+        while (i < n && IsSpace(attributes[i])) ++i;
+        if (i >= n || attributes[i] != '=') return false;
+        ++i;
+        while (i < n && IsSpace(attributes[i])) ++i;
+        if (i >= n || (attributes[i] != '"' && attributes[i] != '\'')) return false;
+        char quote = attributes[i++];
+        size_t valueStart = i;
+        while (i < n && attributes[i] != quote) ++i;
+        if (i >= n) return false;
+        if (k == key) {
+            value = attributes.substr(valueStart, i - valueStart);
+            return true;
+        }
+        ++i;
+    }
+    return false;
+}
@@ -1,6 +1,6 @@
 #include "geometry/CurvedGeometry.h"
+#include "geometry/RoadMeshBuilder.h"
 #include "raymath.h"
-#include "rlgl.h"
 #include <cmath>
 
 CurvedGeometry::CurvedGeometry(Vector3 start, Vector3 control1, Vector3 control2, Vector3 end, float width)
@@ -21,18 +21,13 @@ Vector3 CurvedGeometry::CalculateBezierPoint(float t) const {
     return point;
 }
 
-void CurvedGeometry::Draw() const {
-    DrawCurvedSurface();
-    DrawCenterLine();
+void CurvedGeometry::Bake(RoadMeshBuilder& out) const {
+    std::vector<Vector3> curvePoints = GetPoints();
+    BakeCurvedSurface(out, curvePoints);
+    BakeCenterLine(out, curvePoints);
 }
 
-void CurvedGeometry::DrawCurvedSurface() const {
-    std::vector<Vector3> curvePoints;
-    for (int i = 0; i <= segments; i++) {
-        float t = (float)i / segments;
-        curvePoints.push_back(CalculateBezierPoint(t));
-    }
-    
+void CurvedGeometry::BakeCurvedSurface(RoadMeshBuilder& out, const std::vector<Vector3>& curvePoints) const {
     Color roadColor = {50, 50, 50, 255};
     
     for (size_t i = 0; i < curvePoints.size() - 1; i++) {
@@ -50,13 +45,8 @@ void CurvedGeometry::DrawCurvedSurface() const {
         Vector3 p4 = Vector3Subtract(next, Vector3Scale(right, width/2));
         
         // Surface de la route
-        rlBegin(RL_QUADS);
-            rlColor4ub(roadColor.r, roadColor.g, roadColor.b, roadColor.a);
-            rlVertex3f(p1.x, p1.y + 0.02f, p1.z);
-            rlVertex3f(p2.x, p2.y + 0.02f, p2.z);
-            rlVertex3f(p4.x, p4.y + 0.02f, p4.z);
-            rlVertex3f(p3.x, p3.y + 0.02f, p3.z);
-        rlEnd();
+        const Vector3 lift = {0.0f, 0.02f, 0.0f};
+        out.Quad(Vector3Add(p1, lift), Vector3Add(p2, lift), Vector3Add(p4, lift), Vector3Add(p3, lift), roadColor);
     }
     
     // Lignes blanches sur les bords
@@ -77,26 +67,20 @@ void CurvedGeometry::DrawCurvedSurface() const {
         rightCur.y += 0.04f;
         rightNext.y += 0.04f;
         
-        DrawLine3D(leftCur, leftNext, WHITE);
-        DrawLine3D(rightCur, rightNext, WHITE);
+        out.Line(leftCur, leftNext, WHITE);
+        out.Line(rightCur, rightNext, WHITE);
     }
 }
 
-void CurvedGeometry::DrawCenterLine() const {
+void CurvedGeometry::BakeCenterLine(RoadMeshBuilder& out, const std::vector<Vector3>& curvePoints) const {
     // Ligne centrale pointillée
-    std::vector<Vector3> curvePoints;
-    for (int i = 0; i <= segments; i++) {
-        float t = (float)i / segments;
-        curvePoints.push_back(CalculateBezierPoint(t));
-    }
-    
     for (size_t i = 0; i < curvePoints.size() - 1; i += 3) {
         if (i + 1 < curvePoints.size()) {
             Vector3 p1 = curvePoints[i];
             Vector3 p2 = curvePoints[i + 1];
             p1.y += 0.04f;
             p2.y += 0.04f;
-            DrawLine3D(p1, p2, WHITE);
+            out.Line(p1, p2, WHITE);
         }
     }
 }
@@ -0,0 +1,83 @@
+#include "geometry/Frustum.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+void Frustum::SetPlane(int index, Vector3 normal, Vector3 point) {
+    normal = Vector3Normalize(normal);
+    planes[index] = {normal, -Vector3DotProduct(normal, point)};
+}
+
+Frustum Frustum::FromCamera(const Camera3D& camera, float aspect, float nearPlane, float farPlane) {
+    Frustum f;
+    f.origin = camera.position;
+    const Vector3 forward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+    const Vector3 right = Vector3Normalize(Vector3CrossProduct(forward, camera.up));
+    const Vector3 up = Vector3CrossProduct(right, forward);
+    const Vector3 eye = camera.position;
+
+    f.SetPlane(0, forward, Vector3Add(eye, Vector3Scale(forward, nearPlane)));
+    f.SetPlane(1, Vector3Negate(forward), Vector3Add(eye, Vector3Scale(forward, farPlane)));
+
+    if (camera.projection == CAMERA_ORTHOGRAPHIC) {
+        // fovy : hauteur visible, comme rlOrtho dans BeginMode3D
+        const float halfHeight = camera.fovy * 0.5f;
+        const float halfWidth = halfHeight * aspect;
+        f.SetPlane(2, right, Vector3Subtract(eye, Vector3Scale(right, halfWidth)));
+        f.SetPlane(3, Vector3Negate(right), Vector3Add(eye, Vector3Scale(right, halfWidth)));
+        f.SetPlane(4, up, Vector3Subtract(eye, Vector3Scale(up, halfHeight)));
+        f.SetPlane(5, Vector3Negate(up), Vector3Add(eye, Vector3Scale(up, halfHeight)));
+        return f;
+    }
+
+    // Plans latéraux : passent par l'oeil et contiennent une arête de la pyramide
+    const float tanV = std::tan(camera.fovy * DEG2RAD * 0.5f);
+    const float tanH = tanV * aspect;
+    const Vector3 leftEdge = Vector3Subtract(forward, Vector3Scale(right, tanH));
+    const Vector3 rightEdge = Vector3Add(forward, Vector3Scale(right, tanH));
+    const Vector3 bottomEdge = Vector3Subtract(forward, Vector3Scale(up, tanV));
+    const Vector3 topEdge = Vector3Add(forward, Vector3Scale(up, tanV));
+    f.SetPlane(2, Vector3CrossProduct(leftEdge, up), eye);
+    f.SetPlane(3, Vector3CrossProduct(up, rightEdge), eye);
+    f.SetPlane(4, Vector3CrossProduct(right, bottomEdge), eye);
+    f.SetPlane(5, Vector3CrossProduct(topEdge, right), eye);
+    return f;
+}
+
+bool Frustum::IntersectsSphere(Vector3 center, float radius) const {
+    for (const Plane& p : planes) {
+        if (Vector3DotProduct(p.normal, center) + p.distance < -radius) return false;
+    }
+    return true;
+}
+
+bool Frustum::IntersectsBox(const BoundingBox& box) const {
+    for (const Plane& p : planes) {
+        // Coin le plus avancé dans la direction de la normale
+        const Vector3 corner = {p.normal.x >= 0.0f ? box.max.x : box.min.x,
+                                p.normal.y >= 0.0f ? box.max.y : box.min.y,
+                                p.normal.z >= 0.0f ? box.max.z : box.min.z};
+        if (Vector3DotProduct(p.normal, corner) + p.distance < 0.0f) return false;
+    }
+    return true;
+}
+
+float Frustum::DistanceTo(const BoundingBox& box) const {
+    const Vector3 closest = {std::clamp(origin.x, box.min.x, box.max.x),
+                             std::clamp(origin.y, box.min.y, box.max.y),
+                             std::clamp(origin.z, box.min.z, box.max.z)};
+    return Vector3Distance(origin, closest);
+}
+
+BoundingBox TransformBounds(const BoundingBox& box, Matrix transform) {
+    BoundingBox out = {{INFINITY, INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}};
+    for (int i = 0; i < 8; ++i) {
+        const Vector3 corner = {(i & 1) ? box.max.x : box.min.x,
+                                (i & 2) ? box.max.y : box.min.y,
+                                (i & 4) ? box.max.z : box.min.z};
+        const Vector3 p = Vector3Transform(corner, transform);
+        out.min = Vector3Min(out.min, p);
+        out.max = Vector3Max(out.max, p);
+    }
+    return out;
+}
@@ -0,0 +1,197 @@
+#include "geometry/InstanceBatch.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <utility>
+
+namespace {
+    const char* kPropVs = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec4 vertexColor;
+in mat4 instanceTransform;
+in vec4 instanceColor;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+out vec4 fragColor;
+void main() {
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor*instanceColor;
+    gl_Position = mvp*instanceTransform*vec4(vertexPosition, 1.0);
+}
+)";
+
+    const char* kPropFs = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main() {
+    finalColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor;
+}
+)";
+
+    Shader shader = {};
+    int colorLoc = -1;
+    enum class ShaderState { Unloaded, Loaded, Failed } shaderState = ShaderState::Unloaded;
+}
+
+bool InstanceBatch::IsAvailable() {
+    if (shaderState == ShaderState::Unloaded) {
+        if (!IsWindowReady()) return false;
+        shader = LoadShaderFromMemory(kPropVs, kPropFs);
+        if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) {
+            TraceLog(LOG_WARNING, "[InstanceBatch] Shader d'instanciation indisponible : rendu individuel");
+            shaderState = ShaderState::Failed;
+            return false;
+        }
+        shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+        colorLoc = GetShaderLocationAttrib(shader, "instanceColor");
+        shaderState = ShaderState::Loaded;
+    }
+    return shaderState == ShaderState::Loaded;
+}
+
+void InstanceBatch::ReleaseShader() {
+    if (shaderState == ShaderState::Loaded && IsWindowReady()) UnloadShader(shader);
+    shader = {};
+    colorLoc = -1;
+    shaderState = ShaderState::Unloaded; // nouveau contexte : rechargé au besoin
+}
+
+InstanceBatch::~InstanceBatch() {
+    if (IsWindowReady()) Release();
+}
+
+InstanceBatch::InstanceBatch(InstanceBatch&& other) noexcept {
+    *this = std::move(other);
+}
+
+InstanceBatch& InstanceBatch::operator=(InstanceBatch&& other) noexcept {
+    if (this == &other) return *this;
+    if (IsWindowReady()) Release();
+    transforms = std::move(other.transforms);
+    colors = std::move(other.colors);
+    transformVbo = std::exchange(other.transformVbo, 0u);
+    colorVbo = std::exchange(other.colorVbo, 0u);
+    transformsDirty = other.transformsDirty;
+    colorsDirty = other.colorsDirty;
+    colorCapacity = std::exchange(other.colorCapacity, 0);
+    return *this;
+}
+
+void InstanceBatch::SetTransforms(std::vector<Matrix> instanceTransforms) {
+    transforms = std::move(instanceTransforms);
+    transformsDirty = true;
+}
+
+void InstanceBatch::SetColors(const std::vector<Color>& instanceColors) {
+    if (instanceColors.size() == colors.size() &&
+        std::equal(colors.begin(), colors.end(), instanceColors.begin(), [](Color a, Color b) {
+            return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+        })) {
+        return; // feux inchangés : rien à envoyer
+    }
+    colors = instanceColors;
+    colorsDirty = true;
+}
+
+void InstanceBatch::Upload() {
+    if (transformsDirty) {
+        if (transformVbo != 0) rlUnloadVertexBuffer(transformVbo);
+        // Colonnes consécutives, comme MatrixToFloatV (les champs de Matrix sont rangés par ligne)
+        std::vector<float> columns(transforms.size() * 16);
+        for (size_t i = 0; i < transforms.size(); ++i) {
+            const Matrix& m = transforms[i];
+            const float values[16] = {m.m0, m.m1, m.m2, m.m3, m.m4, m.m5, m.m6, m.m7,
+                                      m.m8, m.m9, m.m10, m.m11, m.m12, m.m13, m.m14, m.m15};
+            std::copy(values, values + 16, columns.begin() + i * 16);
+        }
+        transformVbo = transforms.empty() ? 0
+            : rlLoadVertexBuffer(columns.data(), static_cast<int>(columns.size() * sizeof(float)), false);
+        transformsDirty = false;
+    }
+    if (colorsDirty) {
+        const int count = static_cast<int>(colors.size());
+        if (colorVbo != 0 && count == colorCapacity) {
+            rlUpdateVertexBuffer(colorVbo, colors.data(), count * static_cast<int>(sizeof(Color)), 0);
+        } else {
+            if (colorVbo != 0) rlUnloadVertexBuffer(colorVbo);
+            colorVbo = count == 0 ? 0 : rlLoadVertexBuffer(colors.data(), count * static_cast<int>(sizeof(Color)), true);
+            colorCapacity = count;
+        }
+        colorsDirty = false;
+    }
+}
+
+bool InstanceBatch::Draw(const Mesh& mesh, const Material& material) {
+    if (!IsAvailable()) return false;
+    if (transforms.empty() || mesh.vaoId == 0) return true;
+    Upload();
+    const bool hasColors = colorVbo != 0 && colors.size() == transforms.size();
+
+    rlEnableShader(shader.id);
+    const Color diffuse = material.maps ? material.maps[MATERIAL_MAP_DIFFUSE].color : WHITE;
+    const float tint[4] = {diffuse.r / 255.0f, diffuse.g / 255.0f, diffuse.b / 255.0f, diffuse.a / 255.0f};
+    rlSetUniform(shader.locs[SHADER_LOC_COLOR_DIFFUSE], tint, SHADER_UNIFORM_VEC4, 1);
+    const unsigned int texture = (material.maps && material.maps[MATERIAL_MAP_DIFFUSE].texture.id > 0)
+        ? material.maps[MATERIAL_MAP_DIFFUSE].texture.id : rlGetTextureIdDefault();
+    const int slot = 0;
+    rlActiveTextureSlot(slot);
+    rlEnableTexture(texture);
+    rlSetUniform(shader.locs[SHADER_LOC_MAP_DIFFUSE], &slot, SHADER_UNIFORM_INT, 1);
+
+    // Attributs d'instance liés au VAO du maillage le temps de l'appel (le maillage sert aussi ailleurs)
+    const int modelLoc = shader.locs[SHADER_LOC_MATRIX_MODEL];
+    rlEnableVertexArray(mesh.vaoId);
+    rlEnableVertexBuffer(transformVbo);
+    for (int i = 0; i < 4; ++i) {
+        rlEnableVertexAttribute(modelLoc + i);
+        rlSetVertexAttribute(modelLoc + i, 4, RL_FLOAT, false, sizeof(Matrix), reinterpret_cast<void*>(i * sizeof(Vector4)));
+        rlSetVertexAttributeDivisor(modelLoc + i, 1);
+    }
+    if (colorLoc >= 0) {
+        if (hasColors) {
+            rlEnableVertexBuffer(colorVbo);
+            rlEnableVertexAttribute(colorLoc);
+            rlSetVertexAttribute(colorLoc, 4, RL_UNSIGNED_BYTE, true, 0, nullptr);
+            rlSetVertexAttributeDivisor(colorLoc, 1);
+        } else {
+            const float white[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+            rlDisableVertexAttribute(colorLoc);
+            rlSetVertexAttributeDefault(colorLoc, white, SHADER_ATTRIB_VEC4, 4);
+        }
+    }
+
+    // Transformation courante (rlPushMatrix...) et vue, comme DrawMeshInstanced
+    const Matrix modelView = MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview());
+    rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_MVP], MatrixMultiply(modelView, rlGetMatrixProjection()));
+    const int count = static_cast<int>(transforms.size());
+    if (mesh.indices) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount * 3, nullptr, count);
+    else rlDrawVertexArrayInstanced(0, mesh.vertexCount, count);
+
+    for (int i = 0; i < 4; ++i) {
+        rlSetVertexAttributeDivisor(modelLoc + i, 0);
+        rlDisableVertexAttribute(modelLoc + i);
+    }
+    if (colorLoc >= 0 && hasColors) {
+        rlSetVertexAttributeDivisor(colorLoc, 0);
+        rlDisableVertexAttribute(colorLoc);
+    }
+    rlDisableTexture();
+    rlDisableVertexArray();
+    rlDisableVertexBuffer();
+    rlDisableShader();
+    return true;
+}
+
+void InstanceBatch::Release() {
+    if (transformVbo != 0) rlUnloadVertexBuffer(transformVbo);
+    if (colorVbo != 0) rlUnloadVertexBuffer(colorVbo);
+    transformVbo = 0;
+    colorVbo = 0;
+    colorCapacity = 0;
+    transformsDirty = !transforms.empty();
+    colorsDirty = !colors.empty();
+}
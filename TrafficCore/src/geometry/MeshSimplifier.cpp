@@ -0,0 +1,120 @@
+#include "geometry/MeshSimplifier.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace {
+    struct Cluster {
+        Vector3 sum = {0.0f, 0.0f, 0.0f};
+        Vector3 normal = {0.0f, 0.0f, 0.0f};
+        int first = -1; // premier sommet source (texture, couleur)
+        int count = 0;
+        int output = -1; // rang dans le maillage simplifié
+    };
+
+    template <typename T>
+    T* Allocate(size_t count) {
+        return static_cast<T*>(MemAlloc(static_cast<unsigned int>(count * sizeof(T))));
+    }
+}
+
+Mesh MeshSimplifier::Simplify(const Mesh& source, int resolution) {
+    Mesh out = {};
+    if (!source.vertices || source.vertexCount <= 0 || source.triangleCount <= 0 || resolution < 1) return out;
+
+    Vector3 lo = {source.vertices[0], source.vertices[1], source.vertices[2]};
+    Vector3 hi = lo;
+    for (int i = 1; i < source.vertexCount; ++i) {
+        const Vector3 p = {source.vertices[3 * i], source.vertices[3 * i + 1], source.vertices[3 * i + 2]};
+        lo = Vector3Min(lo, p);
+        hi = Vector3Max(hi, p);
+    }
+    const float extent = std::max(hi.x - lo.x, std::max(hi.y - lo.y, hi.z - lo.z));
+    if (extent <= 0.0f) return out;
+    resolution = std::min(resolution, 100); // clés sur 21 bits par axe et par sommet ci-dessous
+    const float cell = extent / static_cast<float>(resolution);
+
+    // Case de chaque sommet ; la grille compte au plus resolution + 1 cases par axe
+    std::unordered_map<int64_t, int> clusterOfCell;
+    std::vector<Cluster> clusters;
+    std::vector<int> clusterOf(source.vertexCount);
+    for (int i = 0; i < source.vertexCount; ++i) {
+        const Vector3 p = {source.vertices[3 * i], source.vertices[3 * i + 1], source.vertices[3 * i + 2]};
+        const int64_t x = static_cast<int64_t>((p.x - lo.x) / cell);
+        const int64_t y = static_cast<int64_t>((p.y - lo.y) / cell);
+        const int64_t z = static_cast<int64_t>((p.z - lo.z) / cell);
+        auto it = clusterOfCell.try_emplace((x << 42) | (y << 21) | z, static_cast<int>(clusters.size())).first;
+        if (it->second == static_cast<int>(clusters.size())) clusters.emplace_back();
+        Cluster& c = clusters[it->second];
+        c.sum = Vector3Add(c.sum, p);
+        if (source.normals) {
+            c.normal = Vector3Add(c.normal, {source.normals[3 * i], source.normals[3 * i + 1], source.normals[3 * i + 2]});
+        }
+        if (c.first < 0) c.first = i;
+        ++c.count;
+        clusterOf[i] = it->second;
+    }
+
+    // Triangles non dégénérés, chacun une seule fois (même sommets, même sens)
+    std::vector<int> triangles;
+    std::unordered_set<uint64_t> seen;
+    for (int t = 0; t < source.triangleCount; ++t) {
+        int v[3];
+        for (int k = 0; k < 3; ++k) {
+            const int index = source.indices ? source.indices[3 * t + k] : 3 * t + k;
+            if (index >= source.vertexCount) return out;
+            v[k] = clusterOf[index];
+        }
+        if (v[0] == v[1] || v[1] == v[2] || v[0] == v[2]) continue;
+        // Rotation qui place le plus petit en tête : même clé pour abc, bca, cab
+        const int r = (v[0] < v[1] && v[0] < v[2]) ? 0 : (v[1] < v[2] ? 1 : 2);
+        const uint64_t a = v[r], b = v[(r + 1) % 3], c = v[(r + 2) % 3];
+        if (!seen.insert((a << 42) | (b << 21) | c).second) continue;
+        triangles.insert(triangles.end(), {v[0], v[1], v[2]});
+    }
+    if (triangles.empty()) return out;
+
+    // Sommets effectivement utilisés, dans l'ordre de première apparition
+    int used = 0;
+    for (int c : triangles) {
+        if (clusters[c].output < 0) clusters[c].output = used++;
+    }
+    const bool indexed = used <= 65535;
+    out.triangleCount = static_cast<int>(triangles.size() / 3);
+    out.vertexCount = indexed ? used : static_cast<int>(triangles.size());
+    out.vertices = Allocate<float>(out.vertexCount * 3);
+    if (source.normals) out.normals = Allocate<float>(out.vertexCount * 3);
+    if (source.texcoords) out.texcoords = Allocate<float>(out.vertexCount * 2);
+    if (source.colors) out.colors = Allocate<unsigned char>(out.vertexCount * 4);
+
+    auto writeVertex = [&](int slot, const Cluster& c) {
+        const Vector3 p = Vector3Scale(c.sum, 1.0f / static_cast<float>(c.count));
+        std::memcpy(out.vertices + 3 * slot, &p, sizeof(p));
+        if (out.normals) {
+            Vector3 n = Vector3Length(c.normal) > 1e-6f
+                ? Vector3Normalize(c.normal)
+                : Vector3{source.normals[3 * c.first], source.normals[3 * c.first + 1], source.normals[3 * c.first + 2]};
+            std::memcpy(out.normals + 3 * slot, &n, sizeof(n));
+        }
+        if (out.texcoords) std::memcpy(out.texcoords + 2 * slot, source.texcoords + 2 * c.first, 2 * sizeof(float));
+        if (out.colors) std::memcpy(out.colors + 4 * slot, source.colors + 4 * c.first, 4);
+    };
+
+    if (indexed) {
+        out.indices = Allocate<unsigned short>(triangles.size());
+        for (const Cluster& c : clusters) {
+            if (c.output >= 0) writeVertex(c.output, c);
+        }
+        for (size_t i = 0; i < triangles.size(); ++i) {
+            out.indices[i] = static_cast<unsigned short>(clusters[triangles[i]].output);
+        }
+    } else {
+        for (size_t i = 0; i < triangles.size(); ++i) writeVertex(static_cast<int>(i), clusters[triangles[i]]);
+    }
+    return out;
+}
@@ -0,0 +1,64 @@
+#include "geometry/RenderGrid.h"
+#include "core/CellKey.h"
+#include "raymath.h"
+#include <algorithm>
+#include <cmath>
+
+int RenderGrid::Add(const BoundingBox& bounds, float maxDistance) {
+    const int id = static_cast<int>(items.size());
+    items.push_back({bounds, maxDistance});
+
+    const Vector3 center = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f);
+    const int64_t x = static_cast<int64_t>(std::floor(center.x / kCellSize));
+    const int64_t z = static_cast<int64_t>(std::floor(center.z / kCellSize));
+    auto inserted = cells.try_emplace(CellKey(x, z));
+    Cell& cell = inserted.first->second;
+    if (inserted.second) {
+        cell.bounds = bounds;
+        cell.maxDistance = maxDistance;
+    } else {
+        // Boîte de la case : union des objets, qui peuvent déborder de la case
+        cell.bounds.min = Vector3Min(cell.bounds.min, bounds.min);
+        cell.bounds.max = Vector3Max(cell.bounds.max, bounds.max);
+        cell.maxDistance = (cell.maxDistance <= 0.0f || maxDistance <= 0.0f) ? 0.0f
+                                                                              : std::max(cell.maxDistance, maxDistance);
+    }
+    cell.items.push_back(id);
+    return id;
+}
+
+void RenderGrid::Clear() {
+    items.clear();
+    cells.clear();
+    stats.Reset();
+}
+
+void RenderGrid::Query(const Frustum& view, std::vector<int>& visible) {
+    visible.clear();
+    stats.Reset();
+    for (const auto& entry : cells) {
+        const Cell& cell = entry.second;
+        const int count = static_cast<int>(cell.items.size());
+        if (!view.IntersectsBox(cell.bounds)) {
+            stats.frustumCulled += count;
+            continue;
+        }
+        if (cell.maxDistance > 0.0f && view.DistanceTo(cell.bounds) > cell.maxDistance) {
+            stats.distanceCulled += count;
+            continue;
+        }
+        for (int id : cell.items) {
+            const Item& item = items[id];
+            if (item.maxDistance > 0.0f && view.DistanceTo(item.bounds) > item.maxDistance) {
+                ++stats.distanceCulled;
+            } else if (!view.IntersectsBox(item.bounds)) {
+                ++stats.frustumCulled;
+            } else {
+                visible.push_back(id);
+            }
+        }
+    }
+    // Ordre d'ajout : rendu identique d'une frame à l'autre
+    std::sort(visible.begin(), visible.end());
+    stats.drawn = static_cast<int>(visible.size());
+}
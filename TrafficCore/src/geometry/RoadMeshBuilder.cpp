@@ -0,0 +1,100 @@
+#include "geometry/RoadMeshBuilder.h"
+#include "raymath.h"
+#include <cmath>
+
+void RoadMeshBuilder::Vertex(Vector3 p, Color color) {
+    vertices.push_back(p.x);
+    vertices.push_back(p.y);
+    vertices.push_back(p.z);
+    colors.push_back(color.r);
+    colors.push_back(color.g);
+    colors.push_back(color.b);
+    colors.push_back(color.a);
+}
+
+void RoadMeshBuilder::Oriented(Vector3 a, Vector3 b, Vector3 c, Vector3 facing, Color color) {
+    // Face avant en sens trigonométrique vue depuis facing (culling des faces arrière de raylib)
+    Vector3 normal = Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a));
+    Vertex(a, color);
+    if (Vector3DotProduct(normal, facing) < 0.0f) {
+        Vertex(c, color);
+        Vertex(b, color);
+    } else {
+        Vertex(b, color);
+        Vertex(c, color);
+    }
+}
+
+BoundingBox RoadMeshBuilder::GetBounds() const {
+    BoundingBox box = {{INFINITY, INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}};
+    for (size_t i = 0; i + 3 <= vertices.size(); i += 3) {
+        const Vector3 p = {vertices[i], vertices[i + 1], vertices[i + 2]};
+        box.min = Vector3Min(box.min, p);
+        box.max = Vector3Max(box.max, p);
+    }
+    return box;
+}
+
+void RoadMeshBuilder::Triangle(Vector3 a, Vector3 b, Vector3 c, Color color) {
+    Oriented(a, b, c, {0.0f, 1.0f, 0.0f}, color);
+}
+
+void RoadMeshBuilder::Quad(Vector3 a, Vector3 b, Vector3 c, Vector3 d, Color color) {
+    Triangle(a, b, c, color);
+    Triangle(a, c, d, color);
+}
+
+void RoadMeshBuilder::Line(Vector3 a, Vector3 b, Color color, float width) {
+    Vector3 direction = {b.x - a.x, 0.0f, b.z - a.z};
+    float length = sqrtf(direction.x * direction.x + direction.z * direction.z);
+    if (length < 1e-4f) return;
+    Vector3 side = {-direction.z / length * width * 0.5f, 0.0f, direction.x / length * width * 0.5f};
+    Quad(Vector3Add(a, side), Vector3Add(b, side), Vector3Subtract(b, side), Vector3Subtract(a, side), color);
+}
+
+void RoadMeshBuilder::Cylinder(Vector3 base, float radius, float height, int slices, Color color) {
+    if (slices < 3 || radius <= 0.0f) return;
+    const Vector3 top = {base.x, base.y + height, base.z};
+    for (int i = 0; i < slices; ++i) {
+        float a1 = (float)i / slices * 2.0f * PI;
+        float a2 = (float)(i + 1) / slices * 2.0f * PI;
+        Vector3 d1 = {cosf(a1) * radius, 0.0f, sinf(a1) * radius};
+        Vector3 d2 = {cosf(a2) * radius, 0.0f, sinf(a2) * radius};
+        Vector3 t1 = Vector3Add(top, d1), t2 = Vector3Add(top, d2);
+        Vector3 b1 = Vector3Add(base, d1), b2 = Vector3Add(base, d2);
+        Triangle(top, t1, t2, color);
+
+        Vector3 outward = Vector3Add(d1, d2);
+        Oriented(b1, b2, t2, outward, color);
+        Oriented(b1, t2, t1, outward, color);
+    }
+}
+
+void RoadMeshBuilder::Box(Vector3 center, Vector3 size, Color color) {
+    const float half[3] = {size.x * 0.5f, size.y * 0.5f, size.z * 0.5f};
+    const float origin[3] = {center.x, center.y, center.z};
+    for (int axis = 0; axis < 3; ++axis) {
+        const int u = (axis + 1) % 3, v = (axis + 2) % 3;
+        for (float side : {-1.0f, 1.0f}) {
+            // Coins de la face dans l'ordre du pourtour
+            Vector3 corners[4];
+            for (int k = 0; k < 4; ++k) {
+                float p[3];
+                p[axis] = origin[axis] + side * half[axis];
+                p[u] = origin[u] + ((k == 1 || k == 2) ? half[u] : -half[u]);
+                p[v] = origin[v] + (k >= 2 ? half[v] : -half[v]);
+                corners[k] = {p[0], p[1], p[2]};
+            }
+            float n[3] = {0.0f, 0.0f, 0.0f};
+            n[axis] = side;
+            const Vector3 facing = {n[0], n[1], n[2]};
+            Oriented(corners[0], corners[1], corners[2], facing, color);
+            Oriented(corners[0], corners[2], corners[3], facing, color);
+        }
+    }
+}
+
+void RoadMeshBuilder::Clear() {
+    vertices.clear();
+    colors.clear();
+}
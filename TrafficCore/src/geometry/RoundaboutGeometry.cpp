@@ -1,6 +1,6 @@
 #include "geometry/RoundaboutGeometry.h"
+#include "geometry/RoadMeshBuilder.h"
 #include "raymath.h"
-#include "rlgl.h"
 #include <cmath>
 
 #ifndef PI
@@ -13,20 +13,17 @@ RoundaboutGeometry::RoundaboutGeometry(Vector3 center, float radius, float roadW
     this->innerRadius = radius - roadWidth;
 }
 
-void RoundaboutGeometry::Draw() const {
-    DrawRoadCircle();
-    DrawCentralIsland();
-    DrawRoadMarkings();
-    DrawDirectionalArrows();
+void RoundaboutGeometry::Bake(RoadMeshBuilder& out) const {
+    BakeRoadCircle(out);
+    BakeCentralIsland(out);
+    BakeRoadMarkings(out);
+    BakeDirectionalArrows(out);
 }
 
-void RoundaboutGeometry::DrawRoadCircle() const {
+void RoundaboutGeometry::BakeRoadCircle(RoadMeshBuilder& out) const {
     Color roadColor = {50, 50, 50, 255};
     
-    // Dessiner le cercle de route avec transitions douces
-    rlBegin(RL_TRIANGLES);
-    rlColor4ub(roadColor.r, roadColor.g, roadColor.b, roadColor.a);
-    
+    // Anneau de route
     for(int i = 0; i < segments; i++) {
         float angle1 = (float)i / segments * 2 * PI;
         float angle2 = (float)(i + 1) / segments * 2 * PI;
@@ -41,20 +38,12 @@ void RoundaboutGeometry::DrawRoadCircle() const {
         Vector3 outer2 = {center.x + outerRadius * cos2, center.y + 0.02f, center.z + outerRadius * sin2};
         Vector3 inner2 = {center.x + innerRadius * cos2, center.y + 0.02f, center.z + innerRadius * sin2};
         
-        rlVertex3f(outer1.x, outer1.y, outer1.z);
-        rlVertex3f(inner1.x, inner1.y, inner1.z);
-        rlVertex3f(outer2.x, outer2.y, outer2.z);
-        
-        rlVertex3f(inner1.x, inner1.y, inner1.z);
-        rlVertex3f(inner2.x, inner2.y, inner2.z);
-        rlVertex3f(outer2.x, outer2.y, outer2.z);
+        out.Triangle(outer1, inner1, outer2, roadColor);
+        out.Triangle(inner1, inner2, outer2, roadColor);
     }
-    rlEnd();
     
-    // Dessiner des lignes blanches sur les bords extérieurs pour délimiter
-    rlBegin(RL_LINES);  // CHANGÉ ICI : RL_LINE_STRIP -> RL_LINES
-    rlColor4ub(255, 255, 255, 180);
-    for(int i = 0; i < segments; i++) {  // CHANGÉ: <= en 
+    // Lignes blanches sur le bord extérieur pour délimiter
+    for(int i = 0; i < segments; i++) {
         float angle1 = (float)i / segments * 2 * PI;
         float angle2 = (float)(i + 1) / segments * 2 * PI;
         
@@ -68,30 +57,19 @@ void RoundaboutGeometry::DrawRoadCircle() const {
             center.y + 0.05f,
             center.z + outerRadius * sinf(angle2)
         };
-        rlVertex3f(p1.x, p1.y, p1.z);
-        rlVertex3f(p2.x, p2.y, p2.z);
+        out.Line(p1, p2, {255, 255, 255, 180});
     }
-    rlEnd();
 }
 
-void RoundaboutGeometry::DrawCentralIsland() const {
+void RoundaboutGeometry::BakeCentralIsland(RoadMeshBuilder& out) const {
     Color islandColor = {34, 139, 34, 255};
     Color borderColor = {255, 255, 255, 255};
     
     // Îlot central
-    DrawCylinder(
-        {center.x, center.y + 0.2f, center.z},
-        innerRadius * 0.95f,
-        innerRadius * 0.95f,
-        0.4f,
-        segments,
-        islandColor
-    );
+    out.Cylinder({center.x, center.y + 0.2f, center.z}, innerRadius * 0.95f, 0.4f, segments, islandColor);
     
     // Bordure blanche autour de l'îlot
-    rlBegin(RL_LINES);  // CHANGÉ ICI : RL_LINE_STRIP -> RL_LINES
-    rlColor4ub(borderColor.r, borderColor.g, borderColor.b, borderColor.a);
-    for(int i = 0; i < segments; i++) {  // CHANGÉ: <= en 
+    for(int i = 0; i < segments; i++) {
         float angle1 = (float)i / segments * 2 * PI;
         float angle2 = (float)(i + 1) / segments * 2 * PI;
         
@@ -105,13 +83,11 @@ void RoundaboutGeometry::DrawCentralIsland() const {
             center.y + 0.05f,
             center.z + innerRadius * sinf(angle2)
         };
-        rlVertex3f(p1.x, p1.y, p1.z);
-        rlVertex3f(p2.x, p2.y, p2.z);
+        out.Line(p1, p2, borderColor);
     }
-    rlEnd();
 }
 
-void RoundaboutGeometry::DrawRoadMarkings() const {
+void RoundaboutGeometry::BakeRoadMarkings(RoadMeshBuilder& out) const {
     float midRadius = (outerRadius + innerRadius) / 2.0f;
     
     // Lignes pointillées au centre de la voie
@@ -130,11 +106,11 @@ void RoundaboutGeometry::DrawRoadMarkings() const {
             center.z + midRadius * sinf(angle2)
         };
         
-        DrawLine3D(p1, p2, WHITE);
+        out.Line(p1, p2, WHITE);
     }
 }
 
-void RoundaboutGeometry::DrawDirectionalArrows() const {
+void RoundaboutGeometry::BakeDirectionalArrows(RoadMeshBuilder& out) const {
     int numArrows = 6;
     float arrowRadius = (outerRadius + innerRadius) / 2.0f;
     Color arrowColor = {255, 255, 255, 230};
@@ -174,12 +150,7 @@ void RoundaboutGeometry::DrawDirectionalArrows() const {
             tip.z - direction.z * 0.7f - perpendicular.z * arrowWidth
         };
         
-        rlBegin(RL_TRIANGLES);
-        rlColor4ub(arrowColor.r, arrowColor.g, arrowColor.b, arrowColor.a);
-        rlVertex3f(tip.x, tip.y, tip.z);
-        rlVertex3f(left.x, left.y, left.z);
-        rlVertex3f(right.x, right.y, right.z);
-        rlEnd();
+        out.Triangle(tip, left, right, arrowColor);
         
         Vector3 bodyStart = {
             arrowPos.x - direction.x * 0.5f,
@@ -193,13 +164,7 @@ void RoundaboutGeometry::DrawDirectionalArrows() const {
         Vector3 b3 = Vector3Add(left, Vector3Scale(direction, 0.3f));
         Vector3 b4 = Vector3Add(right, Vector3Scale(direction, 0.3f));
         
-        rlBegin(RL_QUADS);
-        rlColor4ub(arrowColor.r, arrowColor.g, arrowColor.b, arrowColor.a);
-        rlVertex3f(b1.x, b1.y, b1.z);
-        rlVertex3f(b2.x, b2.y, b2.z);
-        rlVertex3f(b4.x, b4.y, b4.z);
-        rlVertex3f(b3.x, b3.y, b3.z);
-        rlEnd();
+        out.Quad(b1, b2, b4, b3, arrowColor);
     }
 }
 
@@ -1,18 +1,18 @@
 #include "geometry/StraightGeometry.h"
+#include "geometry/RoadMeshBuilder.h"
 #include "raymath.h"
-#include "rlgl.h"
 #include <cmath>
 
 StraightGeometry::StraightGeometry(Vector3 start, Vector3 end, float width, int lanes)
     : start(start), end(end), width(width), lanes(lanes) {}
 
-void StraightGeometry::Draw() const {
-    DrawRoadSurface();
-    DrawLaneMarkings();
-    DrawEdgeLines();
+void StraightGeometry::Bake(RoadMeshBuilder& out) const {
+    BakeRoadSurface(out);
+    BakeLaneMarkings(out);
+    BakeEdgeLines(out);
 }
 
-void StraightGeometry::DrawRoadSurface() const {
+void StraightGeometry::BakeRoadSurface(RoadMeshBuilder& out) const {
     Vector3 direction = Vector3Subtract(end, start);
     direction = Vector3Normalize(direction);
     
@@ -25,16 +25,11 @@ void StraightGeometry::DrawRoadSurface() const {
     Vector3 p4 = Vector3Subtract(end, Vector3Scale(right, width/2));
     
     // Surface d'asphalte
-    rlBegin(RL_QUADS);
-        rlColor4ub(50, 50, 50, 255);
-        rlVertex3f(p1.x, p1.y + 0.02f, p1.z);
-        rlVertex3f(p2.x, p2.y + 0.02f, p2.z);
-        rlVertex3f(p4.x, p4.y + 0.02f, p4.z);
-        rlVertex3f(p3.x, p3.y + 0.02f, p3.z);
-    rlEnd();
+    const Vector3 lift = {0.0f, 0.02f, 0.0f};
+    out.Quad(Vector3Add(p1, lift), Vector3Add(p2, lift), Vector3Add(p4, lift), Vector3Add(p3, lift), {50, 50, 50, 255});
 }
 
-void StraightGeometry::DrawEdgeLines() const {
+void StraightGeometry::BakeEdgeLines(RoadMeshBuilder& out) const {
     // Lignes blanches continues sur les bords
     Vector3 direction = Vector3Subtract(end, start);
     direction = Vector3Normalize(direction);
@@ -46,17 +41,17 @@ void StraightGeometry::DrawEdgeLines() const {
     Vector3 leftEnd = Vector3Add(end, Vector3Scale(right, width/2 - 0.1f));
     leftStart.y += 0.04f;
     leftEnd.y += 0.04f;
-    DrawLine3D(leftStart, leftEnd, WHITE);
+    out.Line(leftStart, leftEnd, WHITE);
     
     // Ligne droite
     Vector3 rightStart = Vector3Subtract(start, Vector3Scale(right, width/2 - 0.1f));
     Vector3 rightEnd = Vector3Subtract(end, Vector3Scale(right, width/2 - 0.1f));
     rightStart.y += 0.04f;
     rightEnd.y += 0.04f;
-    DrawLine3D(rightStart, rightEnd, WHITE);
+    out.Line(rightStart, rightEnd, WHITE);
 }
 
-void StraightGeometry::DrawLaneMarkings() const {
+void StraightGeometry::BakeLaneMarkings(RoadMeshBuilder& out) const {
     if (lanes <= 1) return;
     
     Vector3 direction = Vector3Subtract(end, start);
@@ -87,7 +82,7 @@ void StraightGeometry::DrawLaneMarkings() const {
             dash1.y += 0.04f;
             dash2.y += 0.04f;
             
-            DrawLine3D(dash1, dash2, WHITE);
+            out.Line(dash1, dash2, WHITE);
         }
     }
 }
@@ -63,7 +63,7 @@ Car::Car(Vector3 startPos, const std::string& modelPath, CarModel model, int id)
 }
 
 Car::~Car() {
-    // UnloadModel(this->model); // Déchargement si nécessaire
+    // Modèle partagé : rendu au cache de ModelManager par Vehicule
 }
 
 void Car::update(float deltaTime) {
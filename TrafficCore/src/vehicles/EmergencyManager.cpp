@@ -3,10 +3,15 @@
 #include "Vehicules/Vehicule.h"
 #include "Vehicules/ModelManager.h"
 #include "PathFinder.h"
+#include "RoutingGraph.h"
+#include "SpatialIndex.h"
+#include "TravelTimeTable.h"
 #include "Node.h"
 #include "RoadSegment.h"
 #include <algorithm>
 #include <cmath>
+#include <deque>
+#include <iostream>
 
 EmergencyManager::EmergencyManager(RoadNetwork* net) : network(net) {
     hospital.entryNode = nullptr;
@@ -24,14 +29,8 @@ void EmergencyManager::addHospital(Vector2 pos2D) {
     
     if (!network) return;
     
-    float minDist = 999999.0f;
-    for (const auto& node : network->GetNodes()) {
-        float d = Vector3Distance(hospital.position, node->GetPosition());
-        if (d < minDist) {
-            minDist = d;
-            hospital.entryNode = node.get();
-        }
-    }
+    int entry = network->GetSpatialIndex()->NearestNode(hospital.position);
+    hospital.entryNode = entry >= 0 ? network->GetNodes()[entry].get() : nullptr;
 
     // Create parking area next to the hospital
     // Spawn 3 stationary emergency vehicles (Ambulance, Fire, Police)
@@ -46,6 +45,7 @@ void EmergencyManager::addHospital(Vector2 pos2D) {
         
         auto* ev = new EmergencyVehicle(parkPos, type, m, network);
         ev->completeMission(); // Ensure they are stationary/parked
+        ev->setStationNode(hospital.entryNode);
         emergencyVehicles.push_back(ev);
     }
 }
@@ -53,37 +53,39 @@ void EmergencyManager::addHospital(Vector2 pos2D) {
 void EmergencyManager::dispatchEmergencyVehicle(int vehicleType, Vector2 destination) {
     if (!network) return;
     
-    // Find a parked vehicle of the requested type
-    EmergencyVehicle* ev = nullptr;
-    for (size_t i = 0; i < emergencyVehicles.size(); i++) {
-        // Assuming order 0=Ambulance, 1=Fire, 2=Police based on addHospital loop
-        if (i % 3 == vehicleType) {
-            if (!emergencyVehicles[i]->isOnMission()) {
-                ev = emergencyVehicles[i];
-                break;
-            }
-        }
-    }
+    // Un seul instantané (topologie + temps de parcours) pour toute la décision
+    std::shared_ptr<const RoutingGraph> graph = network->GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network->GetEdgeWeights();
     
-    if (!ev) return; // No vehicle available
+    // Noeud d'intervention : le plus proche de la position demandée (index commun au graphe)
+    int target = network->GetSpatialIndex()->NearestNode(Vector3{destination.x, 0.0f, destination.y});
+    if (target < 0) return;
     
-    // Trouver le noeud de destination le plus proche
-    Node* destNode = nullptr;
-    float minDist = 999999.0f;
-    Vector3 dest3D = {destination.x, 0.0f, destination.y};
+    // Unités libres du type demandé, où qu'elles attendent
+    std::vector<int> sources;
+    std::vector<EmergencyVehicle*> candidates;
+    for (auto* ev : emergencyVehicles) {
+        if (ev->getType() != vehicleType || ev->isOnMission()) continue;
+        int at = graph->IndexOf(ev->getStationNode());
+        if (at < 0) continue;
+        sources.push_back(at);
+        candidates.push_back(ev);
+    }
+    if (candidates.empty()) return; // No vehicle available
     
-    for (const auto& node : network->GetNodes()) {
-        float d = Vector3Distance(dest3D, node->GetPosition());
-        if (d < minDist) {
-            minDist = d;
-            destNode = node.get();
-        }
+    // Recherche arrière multi-sources : l'unité au plus faible temps d'arrivée
+    PathFinder::SourceMatch match = PathFinder::SearchNearestSource(*graph, *weights, sources, target);
+    if (match.source < 0) {
+        std::cout << "[URGENCE] Aucune unite ne peut atteindre l'intervention" << std::endl;
+        return;
     }
+    EmergencyVehicle* ev = candidates[std::find(sources.begin(), sources.end(), match.source) - sources.begin()];
     
-    if (!destNode) return;
+    std::deque<RoadSegment*> route;
+    for (int idx : match.route) route.push_back(graph->GetSegment(idx));
     
     // Définir la mission d'urgence
-    ev->setEmergencyMission(destNode);
+    ev->setEmergencyMission(graph->GetNode(target), route);
 }
 
 void EmergencyManager::dispatchEmergencyVehicle(int vehicleType, Vector3 destination) {
@@ -182,6 +184,11 @@ void EmergencyManager::yieldToEmergencyVehicle(std::vector<Vehicule*>& normalTra
 }
 
 void EmergencyManager::update(float deltaTime) {
+    // Entrée de l'hôpital retirée par une édition : noeud le plus proche
+    if (network && hospital.entryNode && network->GetNodeIndex(hospital.entryNode) < 0) {
+        int entry = network->GetSpatialIndex()->NearestNode(hospital.position);
+        hospital.entryNode = entry >= 0 ? network->GetNodes()[entry].get() : nullptr;
+    }
     for (auto* ev : emergencyVehicles) {
         if (ev->hasReachedDestination()) {
             ev->completeMission();
@@ -192,6 +199,54 @@ void EmergencyManager::update(float deltaTime) {
     updateTrafficLights(deltaTime);
 }
 
+const ReachResult& EmergencyManager::getHospitalCoverage(float budgetSeconds) {
+    if (!network || !hospital.entryNode) {
+        coverage = ReachResult();
+        return coverage;
+    }
+    std::shared_ptr<const RoutingGraph> graph = network->GetRoutingGraph();
+    std::shared_ptr<const EdgeWeights> weights = network->GetEdgeWeights();
+    if (coverage.topologyVersion == graph->GetVersion() && coverage.weightsVersion == weights->version
+        && coverage.budgetSeconds == budgetSeconds) {
+        return coverage;
+    }
+    coverage = Isochrone::Compute(*graph, *weights, {graph->IndexOf(hospital.entryNode)}, budgetSeconds);
+    return coverage;
+}
+
+void EmergencyManager::setCoverageOverlay(bool visible, float budgetSeconds) {
+    coverageVisible = visible;
+    coverageBudget = budgetSeconds;
+}
+
+void EmergencyManager::drawCoverageOverlay() {
+    const ReachResult& reach = getHospitalCoverage(coverageBudget);
+    if (reach.segmentSeconds.empty() || coverageBudget <= 0.0f) return;
+
+    for (const auto& seg : network->GetRoadSegments()) {
+        int idx = seg->GetIndex();
+        if (idx < 0 || idx >= (int)reach.segmentSeconds.size()) continue;
+        float part = reach.SegmentCoverage(idx);
+        if (part <= 0.0f) continue;
+
+        // Couleur selon l'heure d'entrée sur le segment
+        float entry = reach.segmentSeconds[idx] - reach.segmentTravel[idx];
+        float ratio = Clamp(entry / coverageBudget, 0.0f, 1.0f);
+        Color c = {
+            (unsigned char)Lerp(GREEN.r, RED.r, ratio),
+            (unsigned char)Lerp(GREEN.g, RED.g, ratio),
+            (unsigned char)Lerp(GREEN.b, RED.b, ratio),
+            255
+        };
+
+        Vector3 a = seg->GetStartPos();
+        Vector3 b = Vector3Lerp(a, seg->GetEndPos(), part);
+        a.y = b.y = 1.5f;
+        DrawLine3D(a, b, c);
+        DrawCylinderEx(a, b, 1.2f, 1.2f, 4, Fade(c, 0.6f));
+    }
+}
+
 void EmergencyManager::updateAndDraw(float dt) {
     update(dt);
     
@@ -208,9 +263,10 @@ void EmergencyManager::updateAndDraw(float dt) {
     Vector3 parkingPos = { hospital.position.x + 60.0f, 0.2f, hospital.position.z };
     DrawCubeWires(parkingPos, 50.0f, 0.0f, 20.0f, YELLOW);
     
-    for (auto* ev : emergencyVehicles) {
-        ev->draw();
-    }
+    drawList.assign(emergencyVehicles.begin(), emergencyVehicles.end());
+    renderer.Draw(drawList);
+    
+    if (coverageVisible) drawCoverageOverlay();
 }
 
 std::vector<EmergencyVehicle*>& EmergencyManager::getEmergencyVehicles() {
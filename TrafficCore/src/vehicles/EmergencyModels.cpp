@@ -0,0 +1,183 @@
+#include "Vehicules/EmergencyModels.h"
+#include "Vehicules/ModelManager.h"
+#include "geometry/RoadMeshBuilder.h"
+#include "raymath.h"
+#include <cstring>
+
+namespace {
+
+constexpr int kTypeCount = 3;
+constexpr int kMaterialMaps = 12; // MAX_MATERIAL_MAPS de raylib
+
+struct Baked {
+    EmergencyModel model;
+    bool baked = false;
+    bool uploaded = false;
+};
+
+Baked g_types[kTypeCount];
+Baked g_lamp; // model.body : cube des lampes
+
+// ==================== GÉOMÉTRIE ====================
+// Mêmes volumes que l'ancien rendu immédiat (DrawCube : centre et dimensions, DrawCylinder : base)
+
+void Siren(RoadMeshBuilder& out, std::vector<Vector3>& lamps, Vector3 base) {
+    out.Box(base, {1.2f, 0.1f, 0.3f}, DARKGRAY);
+    lamps.push_back({base.x - 0.4f, base.y + 0.15f, base.z}); // rouge
+    lamps.push_back({base.x + 0.4f, base.y + 0.15f, base.z}); // bleu
+}
+
+void Ambulance(RoadMeshBuilder& out, std::vector<Vector3>& lamps) {
+    // Châssis arrière, cabine avant
+    out.Box({0.0f, 1.6f, -0.5f}, {4.0f, 2.2f, 4.0f}, WHITE);
+    out.Box({0.0f, 1.2f, 2.2f}, {4.0f, 1.4f, 1.6f}, WHITE);
+    // Bande latérale, pare-chocs
+    out.Box({0.0f, 1.6f, -0.5f}, {4.05f, 0.4f, 4.1f}, RED);
+    out.Box({0.0f, 0.8f, 2.2f}, {4.05f, 0.6f, 1.65f}, WHITE);
+    // Croix médicales sur les flancs
+    for (float side : {2.05f, -2.05f}) {
+        out.Box({side, 1.8f, -0.5f}, {0.1f, 0.8f, 0.25f}, RED);
+        out.Box({side, 1.8f, -0.5f}, {0.1f, 0.25f, 0.8f}, RED);
+    }
+    out.Box({0.0f, 1.5f, 2.5f}, {3.9f, 0.6f, 1.05f}, DARKGRAY); // pare-brise
+    for (float z : {1.8f, -1.5f}) {
+        out.Cylinder({1.9f, 0.5f, z}, 0.5f, 0.4f, 10, BLACK);
+        out.Cylinder({-1.9f, 0.5f, z}, 0.5f, 0.4f, 10, BLACK);
+    }
+    Siren(out, lamps, {0.0f, 2.75f, 2.0f});
+}
+
+void PoliceCar(RoadMeshBuilder& out, std::vector<Vector3>& lamps) {
+    // Corps bas, habitacle, portes blanches, vitres teintées
+    out.Box({0.0f, 0.7f, 0.0f}, {3.2f, 0.8f, 4.8f}, DARKBLUE);
+    out.Box({0.0f, 1.3f, -0.2f}, {2.9f, 0.7f, 2.5f}, WHITE);
+    out.Box({0.0f, 0.7f, 0.0f}, {3.25f, 0.75f, 2.0f}, WHITE);
+    out.Box({0.0f, 1.35f, -0.2f}, {2.8f, 0.55f, 2.6f}, BLACK);
+    // Capot, coffre, pare-chocs
+    out.Box({0.0f, 0.75f, 1.8f}, {3.0f, 0.1f, 1.2f}, DARKBLUE);
+    out.Box({0.0f, 0.75f, -2.0f}, {3.0f, 0.1f, 0.8f}, DARKBLUE);
+    out.Box({0.0f, 0.4f, 2.4f}, {3.2f, 0.4f, 0.2f}, BLACK);
+    out.Box({0.0f, 0.4f, -2.4f}, {3.2f, 0.4f, 0.2f}, BLACK);
+    for (float z : {1.6f, -1.6f}) {
+        out.Cylinder({1.5f, 0.4f, z}, 0.4f, 0.3f, 10, BLACK);
+        out.Cylinder({-1.5f, 0.4f, z}, 0.4f, 0.3f, 10, BLACK);
+    }
+    Siren(out, lamps, {0.0f, 1.7f, -0.2f}); // barre de toit
+}
+
+void FireTruck(RoadMeshBuilder& out, std::vector<Vector3>& lamps) {
+    // Réservoir, cabine, bande blanche
+    out.Box({0.0f, 1.8f, -1.0f}, {4.5f, 2.2f, 5.0f}, RED);
+    out.Box({0.0f, 1.5f, 2.5f}, {4.5f, 1.8f, 1.8f}, RED);
+    out.Box({0.0f, 1.0f, 0.0f}, {4.55f, 0.4f, 7.0f}, WHITE);
+    // Grande échelle : base, barreaux, vérins
+    out.Box({0.0f, 3.0f, -0.5f}, {1.4f, 0.2f, 5.0f}, LIGHTGRAY);
+    for (int i = 0; i < 5; ++i) out.Box({0.0f, 3.2f, -2.0f + i * 1.0f}, {1.6f, 0.1f, 0.1f}, DARKGRAY);
+    out.Cylinder({1.2f, 3.0f, -2.0f}, 0.1f, 2.0f, 6, GRAY);
+    out.Cylinder({-1.2f, 3.0f, -2.0f}, 0.1f, 2.0f, 6, GRAY);
+    out.Box({0.0f, 1.8f, 2.8f}, {4.4f, 0.8f, 1.3f}, BLACK); // vitres de la cabine
+    // Six roues
+    for (float z : {2.5f, -1.5f, -2.8f}) {
+        out.Cylinder({2.15f, 0.6f, z}, 0.6f, 0.5f, 12, BLACK);
+        out.Cylinder({-2.15f, 0.6f, z}, 0.6f, 0.5f, 12, BLACK);
+    }
+    Siren(out, lamps, {1.8f, 2.5f, 2.8f});
+    Siren(out, lamps, {-1.8f, 2.5f, 2.8f});
+}
+
+// ==================== MODÈLES ====================
+
+using Baker = void (*)(RoadMeshBuilder&, std::vector<Vector3>&);
+
+void LampCube(RoadMeshBuilder& out, std::vector<Vector3>&) {
+    const float s = EmergencyModels::kLampSize;
+    out.Box({0.0f, 0.0f, 0.0f}, {s, s, s}, WHITE); // teinte de l'instance
+}
+
+// Dans l'ordre d'EmergencyType
+const Baker kBakers[kTypeCount] = {Ambulance, FireTruck, PoliceCar};
+
+// Maillage non indexé à couleurs par sommet, côté CPU
+Mesh MakeMesh(Baker bake, std::vector<Vector3>& lamps) {
+    RoadMeshBuilder geometry;
+    bake(geometry, lamps);
+    const auto& vertices = geometry.GetVertices();
+    const auto& colors = geometry.GetColors();
+    Mesh mesh = {};
+    mesh.vertexCount = geometry.GetVertexCount();
+    mesh.triangleCount = mesh.vertexCount / 3;
+    mesh.vertices = static_cast<float*>(MemAlloc(static_cast<unsigned int>(vertices.size() * sizeof(float))));
+    mesh.colors = static_cast<unsigned char*>(MemAlloc(static_cast<unsigned int>(colors.size())));
+    std::memcpy(mesh.vertices, vertices.data(), vertices.size() * sizeof(float));
+    std::memcpy(mesh.colors, colors.data(), colors.size());
+    return mesh;
+}
+
+// Matériau blanc sans shader ni texture, remplacé par LoadMaterialDefault() à l'envoi au GPU
+Material CpuMaterial() {
+    Material material = {};
+    material.maps = static_cast<MaterialMap*>(MemAlloc(kMaterialMaps * sizeof(MaterialMap)));
+    material.maps[MATERIAL_MAP_DIFFUSE].color = WHITE;
+    return material;
+}
+
+// Tableaux du Model alloués une fois et jamais libérés : les handles de ModelManager et les lots de
+// VehicleRenderer en gardent des copies, valides après Release()
+void Ensure(Baked& entry, Baker bake, bool withLod) {
+    ModelManager& mm = ModelManager::getInstance();
+    Model& body = entry.model.body;
+    if (!entry.baked) {
+        body.transform = MatrixIdentity();
+        body.meshCount = 1;
+        body.meshes = static_cast<Mesh*>(MemAlloc(sizeof(Mesh)));
+        body.meshes[0] = MakeMesh(bake, entry.model.lamps);
+        body.materialCount = 1;
+        body.materials = static_cast<Material*>(MemAlloc(sizeof(Material)));
+        body.materials[0] = CpuMaterial();
+        body.meshMaterial = static_cast<int*>(MemAlloc(sizeof(int)));
+        entry.baked = true;
+    }
+    if (!entry.uploaded && IsWindowReady()) {
+        // Sommets gardés côté CPU (boîte englobante, LOD)
+        if (withLod) mm.releaseLod(body); // LOD CPU d'avant la fenêtre
+        UploadMesh(&body.meshes[0], false);
+        MemFree(body.materials[0].maps);
+        body.materials[0] = LoadMaterialDefault();
+        entry.uploaded = true;
+    }
+    // Régénéré aussi après ModelManager::releaseLods()
+    if (withLod && !mm.getLod(body)) mm.buildLod(body);
+}
+
+// Tampons GPU libérés, maillage recuit côté CPU dans le même emplacement
+void ReleaseGpu(Baked& entry, Baker bake) {
+    if (!entry.uploaded) return;
+    Model& body = entry.model.body;
+    UnloadMesh(body.meshes[0]);
+    UnloadMaterial(body.materials[0]);
+    std::vector<Vector3> lamps;
+    body.meshes[0] = MakeMesh(bake, lamps);
+    body.materials[0] = CpuMaterial();
+    entry.uploaded = false;
+}
+
+} // namespace
+
+const EmergencyModel& EmergencyModels::Get(EmergencyType type) {
+    const int index = (type >= 0 && type < kTypeCount) ? static_cast<int>(type) : 0;
+    Ensure(g_types[index], kBakers[index], true);
+    return g_types[index].model;
+}
+
+const Model& EmergencyModels::GetLampModel() {
+    Ensure(g_lamp, LampCube, false);
+    return g_lamp.model.body;
+}
+
+void EmergencyModels::Release() {
+    for (int i = 0; i < kTypeCount; ++i) {
+        if (g_types[i].baked) ModelManager::getInstance().releaseLod(g_types[i].model.body);
+        ReleaseGpu(g_types[i], kBakers[i]);
+    }
+    ReleaseGpu(g_lamp, LampCube);
+}
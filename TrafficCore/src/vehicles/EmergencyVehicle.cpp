@@ -1,11 +1,12 @@
 #include "Vehicules/EmergencyVehicle.h"
+#include "Vehicules/EmergencyModels.h"
 #include "Vehicules/Vehicule.h"
-#include "PathFinder.h"
+#include "PathService.h"
+#include "DStarLite.h"
 #include "RoadNetwork.h"
 #include "Node.h"
 #include "RoadSegment.h"
 #include <deque>
-#include "rlgl.h"
 #include <algorithm>
 
 EmergencyVehicle::EmergencyVehicle(Vector3 pos, EmergencyType type, Model model, RoadNetwork* network)
@@ -32,13 +33,51 @@ EmergencyVehicle::EmergencyVehicle(Vector3 pos, EmergencyType type, Model model,
             debugColor = BLUE;
             break;
     }
+
+    // Pas de modèle externe : géométrie procédurale cuite une fois pour le type, aux dimensions
+    // de l'ancien rendu immédiat (échelle 1)
+    if (!this->model.isLoaded()) {
+        this->model = ModelManager::getInstance().share(EmergencyModels::Get(type).body);
+        procedural = true;
+        setScale(1.0f);
+        updateLamps();
+    }
 }
 
 void EmergencyVehicle::update(float deltaTime) {
     sirenTimer += deltaTime;
+    updateLamps();
+
+    // Réseau édité à chaud : segment engagé ou destination retirés, l'unité quitte la chaussée
+    // et attend au noeud le plus proche
+    if (network) {
+        RoadSegment* committed = getCommittedRoad();
+        bool roadGone = committed && !network->IsLive(committed);
+        bool destinationGone = destinationNode && network->GetNodeIndex(destinationNode) < 0;
+        if (roadGone || destinationGone) {
+            leaveRoad();
+            destinationNode = nullptr;
+            completeMission();
+            stationNode = findNearestNode();
+            return;
+        }
+        if (stationNode && network->GetNodeIndex(stationNode) < 0) stationNode = findNearestNode();
+    }
     
     // If not on mission, stay parked (do not move)
     if (!isOnEmergencyMission) return;
+
+    // Itinéraire initial encore en calcul : on attend sur place
+    if (plannerPending) {
+        applyPendingPlanner();
+        if (plannerPending && !replanFromRoute) return;
+    }
+
+    replanTimer += deltaTime;
+    if (replanTimer >= REPLAN_INTERVAL) {
+        replanTimer = 0.0f;
+        replan();
+    }
     
     // Si en mission d'urgence, ignorer les feux rouges
     if (isOnEmergencyMission) {
@@ -50,162 +89,51 @@ void EmergencyVehicle::update(float deltaTime) {
 }
 
 void EmergencyVehicle::draw() {
-    if (model.meshCount > 0) {
-        // Rendu du modèle 3D externe si disponible
-        Vehicule::draw();
-        
-        // Effet visuel de gyrophare simple pour le modèle
-        if (isSirenActive) {
-            Color lightColor1 = ((int)(sirenTimer * 10) % 2 == 0) ? RED : BLUE;
-            Color lightColor2 = ((int)(sirenTimer * 10) % 2 == 0) ? BLUE : RED;
-            Vector3 lightPos1 = { position.x - 1.0f, position.y + 2.5f, position.z };
-            Vector3 lightPos2 = { position.x + 1.0f, position.y + 2.5f, position.z };
-            DrawSphere(lightPos1, 0.6f, lightColor1);
-            DrawSphere(lightPos2, 0.6f, lightColor2);
-        }
-    } else {
-        // Rendu Procédural Réaliste (si pas de modèle)
-        rlPushMatrix();
-        rlTranslatef(position.x, position.y, position.z);
-        rlRotatef(getRotationAngle(), 0, 1, 0); // Rotation locale
-
-        switch (emergencyType) {
-            case AMBULANCE: drawAmbulance(); break;
-            case POLICE: drawPoliceCar(); break;
-            case FIRE_TRUCK: drawFireTruck(); break;
-        }
+    // Modèle externe, ou carrosserie cuite (EmergencyModels) : même rendu que les autres véhicules
+    Vehicule::draw();
+    if (lodLevel == LodLevel::Box) return; // gyrophares invisibles au niveau boîte
 
-        rlPopMatrix();
+    if (procedural) {
+        // Rendu individuel (sans instanciation) : lampes placées comme le modèle par DrawModelEx
+        const Matrix transform = MatrixMultiply(MatrixMultiply(MatrixScale(scale, scale, scale),
+                                                               MatrixRotateY(getRotationAngle() * DEG2RAD)),
+                                                MatrixTranslate(position.x, position.y + getRenderHeight(), position.z));
+        const float size = EmergencyModels::kLampSize * scale;
+        for (const Lamp& lamp : lamps) DrawCubeV(Vector3Transform(lamp.offset, transform), {size, size, size}, lamp.color);
+    } else if (isSirenActive) {
+        // Effet visuel de gyrophare simple pour le modèle
+        Color lightColor1 = ((int)(sirenTimer * 10) % 2 == 0) ? RED : BLUE;
+        Color lightColor2 = ((int)(sirenTimer * 10) % 2 == 0) ? BLUE : RED;
+        Vector3 lightPos1 = { position.x - 1.0f, position.y + 2.5f, position.z };
+        Vector3 lightPos2 = { position.x + 1.0f, position.y + 2.5f, position.z };
+        DrawSphere(lightPos1, 0.6f, lightColor1);
+        DrawSphere(lightPos2, 0.6f, lightColor2);
     }
 }
 
-void EmergencyVehicle::drawSiren(Vector3 localPos) {
-    // Base du gyrophare
-    DrawCube(localPos, 1.2f, 0.1f, 0.3f, DARKGRAY);
-    
-    if (isSirenActive) {
-        Color c1 = ((int)(sirenTimer * 12) % 2 == 0) ? RED : Fade(RED, 0.2f);
-        Color c2 = ((int)(sirenTimer * 12) % 2 == 0) ? Fade(BLUE, 0.2f) : BLUE;
-        
-        // Lumières clignotantes
-        DrawCube({localPos.x - 0.4f, localPos.y + 0.15f, localPos.z}, 0.3f, 0.3f, 0.3f, c1);
-        DrawCube({localPos.x + 0.4f, localPos.y + 0.15f, localPos.z}, 0.3f, 0.3f, 0.3f, c2);
-        
-        // Halo lumineux
-        DrawSphere({localPos.x - 0.4f, localPos.y + 0.15f, localPos.z}, 0.6f, Fade(c1, 0.3f));
-        DrawSphere({localPos.x + 0.4f, localPos.y + 0.15f, localPos.z}, 0.6f, Fade(c2, 0.3f));
-    } else {
-        // Éteint
-        DrawCube({localPos.x - 0.4f, localPos.y + 0.15f, localPos.z}, 0.3f, 0.3f, 0.3f, MAROON);
-        DrawCube({localPos.x + 0.4f, localPos.y + 0.15f, localPos.z}, 0.3f, 0.3f, 0.3f, DARKBLUE);
-    }
+const Model* EmergencyVehicle::getLampModel() const {
+    return procedural ? &EmergencyModels::GetLampModel() : nullptr;
 }
 
-void EmergencyVehicle::drawAmbulance() {
-    // --- AMBULANCE (Type Box) ---
-    // Châssis principal (Arrière)
-    DrawCube({0.0f, 1.6f, -0.5f}, 4.0f, 2.2f, 4.0f, WHITE);
-    // Cabine (Avant)
-    DrawCube({0.0f, 1.2f, 2.2f}, 4.0f, 1.4f, 1.6f, WHITE);
-    
-    // Bandes Rouges
-    DrawCube({0.0f, 1.6f, -0.5f}, 4.05f, 0.4f, 4.1f, RED); // Bande latérale
-    DrawCube({0.0f, 0.8f, 2.2f}, 4.05f, 0.6f, 1.65f, WHITE); // Pare-chocs avant
-    
-    // Croix Médicale (Sur les flancs)
-    // Gauche
-    DrawCube({2.05f, 1.8f, -0.5f}, 0.1f, 0.8f, 0.25f, RED);
-    DrawCube({2.05f, 1.8f, -0.5f}, 0.1f, 0.25f, 0.8f, RED);
-    // Droite
-    DrawCube({-2.05f, 1.8f, -0.5f}, 0.1f, 0.8f, 0.25f, RED);
-    DrawCube({-2.05f, 1.8f, -0.5f}, 0.1f, 0.25f, 0.8f, RED);
-    
-    // Vitres (Cabine)
-    DrawCube({0.0f, 1.5f, 2.5f}, 3.9f, 0.6f, 1.05f, DARKGRAY); // Pare-brise
-    
-    // Roues
-    DrawCylinder({1.9f, 0.5f, 1.8f}, 0.5f, 0.5f, 0.4f, 10, BLACK); // AV G
-    DrawCylinder({-1.9f, 0.5f, 1.8f}, 0.5f, 0.5f, 0.4f, 10, BLACK); // AV D
-    DrawCylinder({1.9f, 0.5f, -1.5f}, 0.5f, 0.5f, 0.4f, 10, BLACK); // AR G
-    DrawCylinder({-1.9f, 0.5f, -1.5f}, 0.5f, 0.5f, 0.4f, 10, BLACK); // AR D
-    
-    // Gyrophare
-    drawSiren({0.0f, 2.75f, 2.0f});
-}
-
-void EmergencyVehicle::drawPoliceCar() {
-    // --- POLICE (Sedan Sportive) ---
-    // Corps bas
-    DrawCube({0.0f, 0.7f, 0.0f}, 3.2f, 0.8f, 4.8f, DARKBLUE);
-    // Habitacle (Haut)
-    DrawCube({0.0f, 1.3f, -0.2f}, 2.9f, 0.7f, 2.5f, WHITE);
-    
-    // Portes Blanches (Contraste Police)
-    DrawCube({0.0f, 0.7f, 0.0f}, 3.25f, 0.75f, 2.0f, WHITE);
-    
-    // Vitres
-    DrawCube({0.0f, 1.35f, -0.2f}, 2.8f, 0.55f, 2.6f, BLACK); // Vitres teintées
-    
-    // Capot et Coffre (Détails)
-    DrawCube({0.0f, 0.75f, 1.8f}, 3.0f, 0.1f, 1.2f, DARKBLUE); // Capot
-    DrawCube({0.0f, 0.75f, -2.0f}, 3.0f, 0.1f, 0.8f, DARKBLUE); // Coffre
-    
-    // Pare-chocs
-    DrawCube({0.0f, 0.4f, 2.4f}, 3.2f, 0.4f, 0.2f, BLACK); // Avant
-    DrawCube({0.0f, 0.4f, -2.4f}, 3.2f, 0.4f, 0.2f, BLACK); // Arrière
-    
-    // Roues
-    float wheelZ = 1.6f;
-    DrawCylinder({1.5f, 0.4f, wheelZ}, 0.4f, 0.4f, 0.3f, 10, BLACK);
-    DrawCylinder({-1.5f, 0.4f, wheelZ}, 0.4f, 0.4f, 0.3f, 10, BLACK);
-    DrawCylinder({1.5f, 0.4f, -wheelZ}, 0.4f, 0.4f, 0.3f, 10, BLACK);
-    DrawCylinder({-1.5f, 0.4f, -wheelZ}, 0.4f, 0.4f, 0.3f, 10, BLACK);
-    
-    // Gyrophare (Barre de toit)
-    drawSiren({0.0f, 1.7f, -0.2f});
+// Lampe éteinte : l'instanciation ignore l'alpha, Fade(c, 0.2f) devient une teinte assombrie
+static Color Dimmed(Color c) {
+    return {static_cast<unsigned char>(c.r / 4), static_cast<unsigned char>(c.g / 4), static_cast<unsigned char>(c.b / 4), 255};
 }
 
-void EmergencyVehicle::drawFireTruck() {
-    // --- FIRE TRUCK (Camion Pompier) ---
-    // Corps Principal (Grand réservoir)
-    DrawCube({0.0f, 1.8f, -1.0f}, 4.5f, 2.2f, 5.0f, RED);
-    
-    // Cabine Avant
-    DrawCube({0.0f, 1.5f, 2.5f}, 4.5f, 1.8f, 1.8f, RED);
-    
-    // Détails Blancs (Bandes)
-    DrawCube({0.0f, 1.0f, 0.0f}, 4.55f, 0.4f, 7.0f, WHITE);
-    
-    // Grande Échelle (Sur le toit)
-    // Base échelle
-    DrawCube({0.0f, 3.0f, -0.5f}, 1.4f, 0.2f, 5.0f, LIGHTGRAY);
-    // Barreaux (Simulation visuelle)
-    for(int i=0; i<5; i++) {
-        DrawCube({0.0f, 3.2f, -2.0f + i*1.0f}, 1.6f, 0.1f, 0.1f, DARKGRAY);
+void EmergencyVehicle::updateLamps() {
+    if (!procedural) return;
+    // Get() envoie aussi les maillages au GPU dès que la fenêtre est ouverte
+    const EmergencyModel& baked = EmergencyModels::Get(emergencyType);
+    const bool phase = (int)(sirenTimer * 12) % 2 == 0;
+    lamps.resize(baked.lamps.size());
+    for (size_t i = 0; i < lamps.size(); ++i) {
+        const bool red = i % 2 == 0; // gauche rouge, droite bleue, pour chaque gyrophare
+        Color color;
+        if (!isSirenActive) color = red ? MAROON : DARKBLUE;
+        else if (red) color = phase ? RED : Dimmed(RED);
+        else color = phase ? Dimmed(BLUE) : BLUE;
+        lamps[i] = {baked.lamps[i], color};
     }
-    // Vérins hydrauliques (Déco)
-    DrawCylinder({1.2f, 3.0f, -2.0f}, 0.1f, 0.1f, 2.0f, 6, GRAY);
-    DrawCylinder({-1.2f, 3.0f, -2.0f}, 0.1f, 0.1f, 2.0f, 6, GRAY);
-    
-    // Vitres Cabine
-    DrawCube({0.0f, 1.8f, 2.8f}, 4.4f, 0.8f, 1.3f, BLACK);
-    
-    // Roues (6 roues pour camion)
-    float wheelY = 0.6f;
-    float wheelR = 0.6f;
-    // Avant
-    DrawCylinder({2.15f, wheelY, 2.5f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    DrawCylinder({-2.15f, wheelY, 2.5f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    // Arrière 1
-    DrawCylinder({2.15f, wheelY, -1.5f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    DrawCylinder({-2.15f, wheelY, -1.5f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    // Arrière 2
-    DrawCylinder({2.15f, wheelY, -2.8f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    DrawCylinder({-2.15f, wheelY, -2.8f}, wheelR, wheelR, 0.5f, 12, BLACK);
-    
-    // Gyrophares (Multiples)
-    drawSiren({1.8f, 2.5f, 2.8f});
-    drawSiren({-1.8f, 2.5f, 2.8f});
 }
 
 void EmergencyVehicle::setEmergencyMission(Node* destination) {
@@ -216,62 +144,110 @@ void EmergencyVehicle::setEmergencyMission(Node* destination) {
     isSirenActive = true;
     
     // Calculer le chemin le plus court vers la destination
-    Node* startNode = findNearestNode();
+    Node* startNode = stationNode ? stationNode : findNearestNode();
     if (!startNode) return;
     
-    PathFinder pathfinder(network);
-    std::vector<Node*> nodePath = pathfinder.FindPath(startNode, destination);
-    
-    if (nodePath.empty()) {
-        isOnEmergencyMission = false;
+    planner.reset();
+    replanTimer = 0.0f;
+    replanFromRoute = false;
+    pendingPlanner = PathService::GetInstance().RequestPlanner(*network, startNode, destination);
+    plannerPending = true;
+    applyPendingPlanner(); // Requête triviale (déjà sur place) : résolue immédiatement
+}
+
+void EmergencyVehicle::setEmergencyMission(Node* destination, const std::deque<RoadSegment*>& route) {
+    if (!network || !destination) return;
+    if (route.empty()) {
+        setEmergencyMission(destination);
         return;
     }
-    
-    // Convertir le chemin de noeuds en chemin de segments routiers
-    std::deque<RoadSegment*> roadRoute;
-    for (size_t i = 0; i < nodePath.size() - 1; ++i) {
-        Node* u = nodePath[i];
-        Node* v = nodePath[i+1];
-        
-        RoadSegment* connecting = nullptr;
-        const auto& allSegments = network->GetRoadSegments();
-        for (const auto& segPtr : allSegments) {
-            if (segPtr->GetStartNode() == u && segPtr->GetEndNode() == v) {
-                connecting = segPtr.get();
-                break;
-            }
-        }
-        if (connecting) {
-            roadRoute.push_back(connecting);
-        }
+
+    destinationNode = destination;
+    isOnEmergencyMission = true;
+    isSirenActive = true;
+    startRoute(route);
+
+    // Le planificateur prendra le relais en route pour les réparations
+    planner.reset();
+    replanTimer = 0.0f;
+    replanFromRoute = true;
+    pendingPlanner = PathService::GetInstance().RequestPlanner(*network, route.front()->GetStartNode(), destination);
+    plannerPending = true;
+}
+
+void EmergencyVehicle::startRoute(const std::deque<RoadSegment*>& route) {
+    // Utiliser la voie la plus à gauche pour dépasser plus facilement
+    RoadSegment* firstRoad = route.front();
+    int forwardLanes = firstRoad->GetLanes() / 2;
+    if (forwardLanes > 0) {
+        setLane(forwardLanes - 1); // Voie la plus à gauche
     }
-    
-    if (!roadRoute.empty()) {
-        // Utiliser la voie la plus à gauche pour dépasser plus facilement
-        RoadSegment* firstRoad = roadRoute.front();
-        int forwardLanes = firstRoad->GetLanes() / 2;
-        if (forwardLanes > 0) {
-            setLane(forwardLanes - 1); // Voie la plus à gauche
-        }
-        setRoute(roadRoute);
+    setRoute(route);
+}
+
+std::deque<RoadSegment*> EmergencyVehicle::plannedRoute() const {
+    std::deque<RoadSegment*> route;
+    if (!planner) return route;
+    for (int idx : planner->ExtractRoute()) route.push_back(planner->GetGraph().GetSegment(idx));
+    return route;
+}
+
+void EmergencyVehicle::applyPendingPlanner() {
+    if (!PathService::IsReady(pendingPlanner)) return;
+    plannerPending = false;
+
+    planner = pendingPlanner.get();
+    if (!planner || planner->GetGraph().GetVersion() != network->GetTopologyVersion()) {
+        planner.reset();
+        if (!replanFromRoute) isOnEmergencyMission = false;
+        return;
     }
+
+    if (replanFromRoute) {
+        // Véhicule déjà en route : le départ de la recherche est recalé sur le segment engagé
+        replan();
+        return;
+    }
+    std::deque<RoadSegment*> route = plannedRoute();
+    if (route.empty()) {
+        isOnEmergencyMission = false;
+        return;
+    }
+    startRoute(route);
+}
+
+void EmergencyVehicle::replan() {
+    if (!planner || plannerPending || !destinationNode) return;
+
+    RoadSegment* committed = getCommittedRoad();
+    if (!committed) return;
+
+    // Réseau modifié : l'arbre ne correspond plus, nouvelle recherche depuis la fin du segment engagé
+    if (planner->GetGraph().GetVersion() != network->GetTopologyVersion()) {
+        planner.reset();
+        replanFromRoute = true;
+        pendingPlanner = PathService::GetInstance().RequestPlanner(*network, committed->GetEndNode(), destinationNode);
+        plannerPending = true;
+        return;
+    }
+
+    int arc = planner->GetGraph().ArcOfSegment(committed->GetIndex());
+    if (arc < 0) return;
+
+    // Réparation incrémentale : départ déplacé + segments dont le poids a changé
+    planner->MoveStart(arc);
+    planner->UpdateWeights(network->GetEdgeWeights());
+    if (!planner->ComputeShortestPath()) return; // plus de chemin : on garde l'itinéraire courant
+
+    std::deque<RoadSegment*> route = plannedRoute();
+    if (route != getRemainingRoute()) replaceRemainingRoute(route);
 }
 
 Node* EmergencyVehicle::findNearestNode() const {
     if (!network) return nullptr;
     
-    Node* nearest = nullptr;
-    float minDist = 999999.0f;
-    
-    for (const auto& node : network->GetNodes()) {
-        float dist = Vector3Distance(position, node->GetPosition());
-        if (dist < minDist) {
-            minDist = dist;
-            nearest = node.get();
-        }
-    }
-    
-    return nearest;
+    int nearest = network->GetSpatialIndex()->NearestNode(position);
+    return nearest >= 0 ? network->GetNodes()[nearest].get() : nullptr;
 }
 
 bool EmergencyVehicle::hasReachedDestination() const {
@@ -282,9 +258,12 @@ bool EmergencyVehicle::hasReachedDestination() const {
 }
 
 void EmergencyVehicle::completeMission() {
+    if (destinationNode) stationNode = destinationNode; // l'unité attend sur place la prochaine intervention
     isOnEmergencyMission = false;
     isSirenActive = false;
     destinationNode = nullptr;
+    plannerPending = false;
+    planner.reset();
 }
 
 EmergencyType EmergencyVehicle::getType() const {
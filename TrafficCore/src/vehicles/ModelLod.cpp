@@ -0,0 +1,219 @@
+#include "Vehicules/ModelLod.h"
+#include "geometry/Frustum.h"
+#include "geometry/MeshSimplifier.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace {
+    Camera3D viewCamera = {};
+    float viewHeight = 0.0f;
+    bool hasView = false;
+
+    // Seuil entre le niveau k et le niveau k + 1
+    constexpr float kThresholds[2] = {LodSelector::kSimplifiedBelow, LodSelector::kBoxBelow};
+
+    // Couleur moyenne d'une texture, sur une grille de points (lecture GPU, à l'import seulement)
+    Color AverageTextureColor(Texture2D texture) {
+        if (texture.id == 0 || !IsWindowReady()) return WHITE;
+        Image image = LoadImageFromTexture(texture);
+        if (!image.data || image.width <= 0 || image.height <= 0) return WHITE;
+        constexpr int kSamples = 8;
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        for (int j = 0; j < kSamples; ++j) {
+            for (int i = 0; i < kSamples; ++i) {
+                Color c = GetImageColor(image, (2 * i + 1) * image.width / (2 * kSamples),
+                                        (2 * j + 1) * image.height / (2 * kSamples));
+                r += c.r;
+                g += c.g;
+                b += c.b;
+            }
+        }
+        UnloadImage(image);
+        const float n = kSamples * kSamples;
+        return {static_cast<unsigned char>(r / n), static_cast<unsigned char>(g / n), static_cast<unsigned char>(b / n), 255};
+    }
+
+    Color Modulate(Color a, Color b) {
+        return {static_cast<unsigned char>(a.r * b.r / 255), static_cast<unsigned char>(a.g * b.g / 255),
+                static_cast<unsigned char>(a.b * b.b / 255), static_cast<unsigned char>(a.a * b.a / 255)};
+    }
+
+    // Couleur moyenne des sommets (maillages à couleurs par sommet), blanc sans couleurs
+    Color AverageVertexColor(const Mesh& mesh) {
+        if (!mesh.colors || mesh.vertexCount <= 0) return WHITE;
+        float r = 0.0f, g = 0.0f, b = 0.0f;
+        for (int v = 0; v < mesh.vertexCount; ++v) {
+            r += mesh.colors[4 * v];
+            g += mesh.colors[4 * v + 1];
+            b += mesh.colors[4 * v + 2];
+        }
+        const float n = static_cast<float>(mesh.vertexCount);
+        return {static_cast<unsigned char>(r / n), static_cast<unsigned char>(g / n), static_cast<unsigned char>(b / n), 255};
+    }
+
+    // Moyenne des matériaux pondérée par le nombre de triangles de leurs maillages
+    Color AverageModelColor(const Model& model) {
+        float r = 0.0f, g = 0.0f, b = 0.0f, weight = 0.0f;
+        for (int i = 0; i < model.meshCount; ++i) {
+            const int m = model.meshMaterial ? model.meshMaterial[i] : 0;
+            if (!model.materials || m < 0 || m >= model.materialCount || !model.materials[m].maps) continue;
+            const MaterialMap& diffuse = model.materials[m].maps[MATERIAL_MAP_DIFFUSE];
+            const Color texel = Modulate(AverageTextureColor(diffuse.texture), AverageVertexColor(model.meshes[i]));
+            const float w = static_cast<float>(std::max(1, model.meshes[i].triangleCount));
+            r += w * diffuse.color.r * texel.r / 255.0f;
+            g += w * diffuse.color.g * texel.g / 255.0f;
+            b += w * diffuse.color.b * texel.b / 255.0f;
+            weight += w;
+        }
+        if (weight <= 0.0f) return GRAY;
+        return {static_cast<unsigned char>(r / weight), static_cast<unsigned char>(g / weight),
+                static_cast<unsigned char>(b / weight), 255};
+    }
+
+    // Boîte des sommets CPU, dans le repère du modèle (model.transform appliqué)
+    BoundingBox ModelBounds(const Model& model) {
+        BoundingBox box = {{INFINITY, INFINITY, INFINITY}, {-INFINITY, -INFINITY, -INFINITY}};
+        for (int i = 0; i < model.meshCount; ++i) {
+            const Mesh& mesh = model.meshes[i];
+            if (!mesh.vertices) return GetModelBoundingBox(model);
+            for (int v = 0; v < mesh.vertexCount; ++v) {
+                const Vector3 p = {mesh.vertices[3 * v], mesh.vertices[3 * v + 1], mesh.vertices[3 * v + 2]};
+                box.min = Vector3Min(box.min, p);
+                box.max = Vector3Max(box.max, p);
+            }
+        }
+        if (box.min.x > box.max.x) return BoundingBox{};
+        return TransformBounds(box, model.transform);
+    }
+
+    // Buffers CPU d'un maillage dont le contexte GPU a déjà disparu
+    void FreeMeshData(Mesh& mesh) {
+        MemFree(mesh.vertices);
+        MemFree(mesh.normals);
+        MemFree(mesh.texcoords);
+        MemFree(mesh.colors);
+        MemFree(mesh.indices);
+        MemFree(mesh.vboId);
+        mesh = {};
+    }
+}
+
+Vector3 ModelLod::GetCenter(Vector3 position, float scale) const {
+    const Vector3 local = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f * scale);
+    // Rotation autour de Y ignorée : seul le décalage vertical compte vraiment, le rayon couvre le reste
+    return {position.x, position.y + local.y, position.z};
+}
+
+float ModelLod::GetRadius(float scale) const {
+    const Vector3 half = Vector3Scale(Vector3Subtract(bounds.max, bounds.min), 0.5f * scale);
+    const Vector3 offset = Vector3Scale(Vector3Add(bounds.min, bounds.max), 0.5f * scale);
+    return Vector3Length(half) + std::sqrt(offset.x * offset.x + offset.z * offset.z);
+}
+
+ModelLod BuildModelLod(const Model& model, int resolution) {
+    ModelLod lod;
+    lod.bounds = ModelBounds(model);
+    lod.color = AverageModelColor(model);
+    if (model.meshCount <= 0 || !model.meshes) return lod;
+
+    std::vector<Mesh> meshes;
+    std::vector<int> materials;
+    for (int i = 0; i < model.meshCount; ++i) {
+        lod.fullTriangles += model.meshes[i].triangleCount;
+        Mesh simplified = MeshSimplifier::Simplify(model.meshes[i], resolution);
+        if (simplified.vertexCount == 0) continue; // pièce plus petite qu'une case : disparaît de loin
+        lod.simplifiedTriangles += simplified.triangleCount;
+        meshes.push_back(simplified);
+        materials.push_back(model.meshMaterial ? model.meshMaterial[i] : 0);
+    }
+    // Gain trop faible (modèle déjà léger) : le niveau intermédiaire reprend le modèle complet
+    if (meshes.empty() || lod.simplifiedTriangles * 10 > lod.fullTriangles * 7) {
+        for (Mesh& m : meshes) FreeMeshData(m);
+        lod.simplifiedTriangles = lod.fullTriangles;
+        return lod;
+    }
+
+    Model& out = lod.simplified;
+    out.transform = model.transform;
+    out.meshCount = static_cast<int>(meshes.size());
+    out.meshes = static_cast<Mesh*>(MemAlloc(static_cast<unsigned int>(meshes.size() * sizeof(Mesh))));
+    out.meshMaterial = static_cast<int*>(MemAlloc(static_cast<unsigned int>(meshes.size() * sizeof(int))));
+    out.materialCount = model.materialCount; // partagés avec le modèle complet, jamais libérés ici
+    out.materials = model.materials;
+    for (size_t i = 0; i < meshes.size(); ++i) {
+        if (IsWindowReady()) UploadMesh(&meshes[i], false);
+        out.meshes[i] = meshes[i];
+        out.meshMaterial[i] = materials[i];
+    }
+    return lod;
+}
+
+void UnloadModelLod(ModelLod& lod) {
+    Model& m = lod.simplified;
+    for (int i = 0; i < m.meshCount; ++i) {
+        if (IsWindowReady() && m.meshes[i].vaoId != 0) UnloadMesh(m.meshes[i]);
+        else FreeMeshData(m.meshes[i]);
+    }
+    MemFree(m.meshes);
+    MemFree(m.meshMaterial);
+    lod = ModelLod();
+}
+
+void LodSelector::SetView(const Camera3D& camera, int screenHeight) {
+    viewCamera = camera;
+    viewHeight = static_cast<float>(screenHeight);
+    hasView = screenHeight > 0;
+}
+
+void LodSelector::ClearView() {
+    hasView = false;
+}
+
+bool LodSelector::HasView() {
+    return hasView;
+}
+
+float LodSelector::ScreenSize(Vector3 center, float radius) {
+    if (!hasView) return INFINITY;
+    if (viewCamera.projection == CAMERA_ORTHOGRAPHIC) return 2.0f * radius / viewCamera.fovy * viewHeight;
+    const float distance = Vector3Distance(viewCamera.position, center);
+    if (distance <= radius) return INFINITY;
+    // Diamètre apparent rapporté à la hauteur visible à cette distance
+    return radius / (distance * std::tan(viewCamera.fovy * DEG2RAD * 0.5f)) * viewHeight;
+}
+
+LodLevel LodSelector::Select(float screenSize, LodLevel current) {
+    int level = static_cast<int>(current);
+    while (level < 2 && screenSize < kThresholds[level]) ++level;
+    while (level > 0 && screenSize > kThresholds[level - 1] * kHysteresis) --level;
+    return static_cast<LodLevel>(level);
+}
+
+LodLevel LodSelector::Select(const ModelLod& lod, Vector3 position, float scale, LodLevel current) {
+    return Select(ScreenSize(lod.GetCenter(position, scale), lod.GetRadius(scale)), current);
+}
+
+void DrawModelLod(const Model& model, const ModelLod* lod, LodLevel level,
+                  Vector3 position, float rotationAngle, float scale, Color tint) {
+    if (!lod || level == LodLevel::Full) {
+        DrawModelEx(model, position, {0.0f, 1.0f, 0.0f}, rotationAngle, {scale, scale, scale}, tint);
+        return;
+    }
+    if (level == LodLevel::Simplified) {
+        const Model& m = lod->simplified.meshCount > 0 ? lod->simplified : model;
+        DrawModelEx(m, position, {0.0f, 1.0f, 0.0f}, rotationAngle, {scale, scale, scale}, tint);
+        return;
+    }
+    // Boîte dans le repère de l'instance (même ordre que DrawModelEx : échelle, rotation, translation)
+    const Vector3 center = Vector3Scale(Vector3Add(lod->bounds.min, lod->bounds.max), 0.5f);
+    const Vector3 size = Vector3Subtract(lod->bounds.max, lod->bounds.min);
+    rlPushMatrix();
+    rlTranslatef(position.x, position.y, position.z);
+    rlRotatef(rotationAngle, 0.0f, 1.0f, 0.0f);
+    rlScalef(scale, scale, scale);
+    DrawCube(center, size.x, size.y, size.z, Modulate(lod->color, tint));
+    rlPopMatrix();
+}
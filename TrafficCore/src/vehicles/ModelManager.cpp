@@ -1,10 +1,151 @@
 #include "Vehicules/ModelManager.h"
+#include "core/AssetManager.h"
+#include <utility>
 
 ModelManager& ModelManager::getInstance() {
     static ModelManager instance;
     return instance;
 }
 
+// Destruction statique sans unloadAll() : les handles de la bibliothèque sont rendus tant que
+// cache, shared et retired existent encore (les membres sont détruits dans l'ordre inverse)
+ModelManager::~ModelManager() {
+    modelLibrary.clear();
+}
+
+ModelHandle::ModelHandle(CachedModel* e) : entry(e) {
+    if (entry) ++entry->refs;
+}
+
+ModelHandle::ModelHandle(const ModelHandle& other) : ModelHandle(other.entry) {}
+
+ModelHandle& ModelHandle::operator=(ModelHandle other) noexcept {
+    std::swap(entry, other.entry);
+    return *this;
+}
+
+ModelHandle::~ModelHandle() {
+    if (entry) ModelManager::getInstance().release(entry);
+}
+
+const Model& ModelHandle::get() const {
+    static const Model empty = {};
+    return entry ? entry->model : empty;
+}
+
+const std::string& ModelHandle::getPath() const {
+    static const std::string none;
+    return entry ? entry->path : none;
+}
+
+ModelHandle ModelManager::acquire(const std::string& path, bool wait) {
+    auto it = cache.find(path);
+    if (it != cache.end()) return ModelHandle(it->second.get());
+
+    auto entry = std::make_unique<CachedModel>();
+    entry->path = path;
+    const AssetInfo* info = assets ? assets->GetManifest().Find(path) : nullptr;
+    if (info && info->hasBounds) {
+        entry->bounds = info->bounds;
+        entry->hasBounds = true;
+    }
+    Model packed = {};
+    if (assets && assets->LoadPacked(path, packed)) {
+        // Archive projetée : plus rapide qu'un passage par le thread d'E/S
+        setLoaded(*entry, packed);
+    } else if (assets && (!wait || entry->hasBounds)) {
+        entry->pending = assets->Request(path, [this](const std::string& p, Model m) { onLoaded(p, m); });
+    }
+    if (!entry->pending && packed.meshCount == 0) {
+        // Support spaces in file names; use std::string to hold path
+        Model model = LoadModel(path.c_str());
+        setLoaded(*entry, model);
+        if (assets && model.meshCount > 0) assets->GetManifest().SetBounds(path, entry->bounds);
+    }
+    CachedModel* raw = entry.get();
+    cache.emplace(path, std::move(entry));
+    return ModelHandle(raw);
+}
+
+void ModelManager::setLoaded(CachedModel& entry, const Model& model) {
+    entry.pending = false;
+    entry.model = model;
+    if (model.meshCount > 0) {
+        byMeshes[model.meshes] = &entry;
+        entry.bounds = GetModelBoundingBox(model);
+        entry.hasBounds = true;
+        buildLod(model);
+        TraceLog(LOG_INFO, "[ModelManager] Chargé : %s", entry.path.c_str());
+    } else {
+        TraceLog(LOG_WARNING, "[ModelManager] Erreur chargement : %s", entry.path.c_str());
+    }
+}
+
+void ModelManager::onLoaded(const std::string& path, Model model) {
+    auto it = cache.find(path);
+    if (it == cache.end() || !it->second->pending) {
+        // Entrée libérée entre-temps (unloadAll) : le modèle n'a plus de propriétaire
+        if (model.meshCount > 0) UnloadModel(model);
+        return;
+    }
+    setLoaded(*it->second, model);
+}
+
+ModelHandle ModelManager::share(const Model& model) {
+    if (model.meshCount <= 0) return ModelHandle();
+    auto found = byMeshes.find(model.meshes);
+    if (found != byMeshes.end()) return ModelHandle(found->second);
+    auto entry = std::make_unique<CachedModel>();
+    entry->model = model;
+    entry->bounds = GetModelBoundingBox(model);
+    entry->hasBounds = true;
+    CachedModel* raw = entry.get();
+    shared.emplace(model.meshes, std::move(entry));
+    byMeshes[model.meshes] = raw;
+    return ModelHandle(raw);
+}
+
+void ModelManager::release(CachedModel* entry) {
+    if (--entry->refs > 0) return;
+    if (entry->path.empty()) {
+        // Modèle de l'appelant : seule l'entrée disparaît (son LOD éventuel reste à l'appelant)
+        const Mesh* key = entry->model.meshes;
+        byMeshes.erase(key);
+        shared.erase(key);
+        return;
+    }
+    // Modèle déchargé par unloadAll() pendant qu'il était encore référencé
+    for (auto it = retired.begin(); it != retired.end(); ++it) {
+        if (it->get() != entry) continue;
+        retired.erase(it);
+        return;
+    }
+}
+
+void ModelManager::unloadEntry(CachedModel& entry) {
+    entry.pending = false;
+    if (entry.model.meshCount > 0) {
+        releaseLod(entry.model);
+        byMeshes.erase(entry.model.meshes);
+        UnloadModel(entry.model);
+    }
+    entry.model = {};
+}
+
+int ModelManager::releaseUnused() {
+    int released = 0;
+    for (auto it = cache.begin(); it != cache.end();) {
+        if (it->second->refs > 0 || it->second->pending) {
+            ++it;
+            continue;
+        }
+        unloadEntry(*it->second);
+        it = cache.erase(it);
+        ++released;
+    }
+    return released;
+}
+
 void ModelManager::loadModel(const std::string& category, const std::string& path) {
     // Vérifier que le fichier existe avant de tenter de le charger
     if (!FileExists(path.c_str())) {
@@ -12,12 +153,10 @@ void ModelManager::loadModel(const std::string& category, const std::string& pat
         return;
     }
 
-    Model m = LoadModel(path.c_str());
-    if (m.meshCount > 0) {
-        modelLibrary[category].push_back({path, m});
+    ModelHandle handle = acquire(path);
+    if (handle.isLoaded()) {
+        modelLibrary[category].push_back(handle);
         TraceLog(LOG_INFO, "[ModelManager] Chargé : %s -> %s", path.c_str(), category.c_str());
-    } else {
-        TraceLog(LOG_ERROR, "[ModelManager] Erreur chargement : %s", path.c_str());
     }
 }
 
@@ -26,28 +165,57 @@ Model ModelManager::getRandomModel(const std::string& category) {
         return Model{0}; 
     }
     // Deterministic: return the first model in the category for predictable behavior
-    return modelLibrary[category][0].second;
+    return modelLibrary[category][0].get();
 }
 
 std::vector<std::string> ModelManager::getModelPaths(const std::string& category) {
     std::vector<std::string> paths;
     if (modelLibrary.find(category) == modelLibrary.end()) return paths;
-    for (auto &p : modelLibrary[category]) paths.push_back(p.first);
+    for (auto &h : modelLibrary[category]) paths.push_back(h.getPath());
     return paths;
 }
 
 Model ModelManager::getModelByPath(const std::string& path) {
-    for (auto &pair : modelLibrary) {
-        for (auto &p : pair.second) {
-            if (p.first == path) return p.second;
-        }
+    auto it = cache.find(path);
+    return it == cache.end() ? Model{0} : it->second->model;
+}
+
+const ModelLod* ModelManager::buildLod(const Model& model) {
+    if (model.meshCount <= 0) return nullptr;
+    auto it = lods.find(model.meshes);
+    if (it == lods.end()) {
+        it = lods.emplace(model.meshes, BuildModelLod(model)).first;
+        const ModelLod& lod = it->second;
+        TraceLog(LOG_INFO, "[ModelManager] LOD : %d -> %d triangles", lod.fullTriangles, lod.simplifiedTriangles);
     }
-    return Model{0};
+    return &it->second;
+}
+
+const ModelLod* ModelManager::getLod(const Model& model) const {
+    if (model.meshCount <= 0) return nullptr;
+    auto it = lods.find(model.meshes);
+    return it == lods.end() ? nullptr : &it->second;
+}
+
+void ModelManager::releaseLod(const Model& model) {
+    auto it = lods.find(model.meshes);
+    if (it == lods.end()) return;
+    UnloadModelLod(it->second);
+    lods.erase(it);
+}
+
+void ModelManager::releaseLods() {
+    for (auto& entry : lods) UnloadModelLod(entry.second);
+    lods.clear();
 }
 
 void ModelManager::unloadAll() {
-    for (auto& pair : modelLibrary) {
-        for (auto& p : pair.second) UnloadModel(p.second);
-    }
     modelLibrary.clear();
-}
\ No newline at end of file
+    releaseLods();
+    for (auto& entry : cache) {
+        unloadEntry(*entry.second);
+        // Entrée encore référencée : vide, supprimée avec son dernier handle
+        if (entry.second->refs > 0) retired.push_back(std::move(entry.second));
+    }
+    cache.clear();
+}
@@ -1,11 +1,19 @@
 #include "Vehicules/TrafficManager.h"
 #include "Vehicules/VehiculeFactory.h"
+#include "core/CellKey.h"
 #include "Vehicules/EmergencyVehicle.h"
 #include "RoadNetwork.h"
 #include <algorithm>
 #include <iostream> // For runtime warnings when model loading fails
 #include "PathFinder.h"
+#include "PathService.h"
+#include "RouteSet.h"
+#include "RoutingGraph.h"
+#include "NetworkPartition.h"
+#include "SpatialIndex.h"
 #include <cmath>
+#include <future>
+#include <thread>
 // For sorting utilities
 #include <limits>
 
@@ -52,22 +60,69 @@ TrafficManager& TrafficManager::getInstance() {
 }
 
 void TrafficManager::addVehicle(std::unique_ptr<Vehicule> vehicle) {
+    // Graine propre au véhicule : mêmes tirages quel que soit le découpage en régions
+    vehicle->seedRandom(nextVehicleSeed++ * 2654435761u);
+    vehicle->setRegion(-1);
     vehicles.push_back(std::move(vehicle));
 }
 
 void TrafficManager::update(float deltaTime) {
+    if (network) applyNetworkEdits();
+
     // === GESTION DU DÉCALAGE DE SPAWN (User Request) ===
     // 1. Mettre à jour les cooldowns des noeuds
     for (auto& pair : nodeCooldowns) {
         if (pair.second > 0) pair.second -= deltaTime;
     }
 
-    // 2. Traiter les spawns en attente
-    if (!pendingSharedSpawns.empty()) {
+    // 2. Traiter les spawns en attente (itinéraires alternatifs calculés par le PathService)
+    if (network && !pendingSharedSpawns.empty()) {
+        std::shared_ptr<const RoutingGraph> graph = network->GetRoutingGraph();
+        std::shared_ptr<const EdgeWeights> weights = network->GetEdgeWeights();
         auto it = pendingSharedSpawns.begin();
         while (it != pendingSharedSpawns.end()) {
+            if (!it->routes) {
+                if (!PathService::IsReady(it->ticket)) { ++it; continue; }
+                it->routes = it->ticket.get();
+                if (it->routes && it->routes->topologyVersion == graph->GetVersion()) {
+                    if (routeSetsVersion != graph->GetVersion()) { routeSets.clear(); routeSetsVersion = graph->GetVersion(); }
+                    routeSets[odKey(it->startNodeId, it->endNodeId)] = it->routes;
+                }
+            }
+
+            if (!it->routes) {
+                std::cout << "[SPAWN] Node " << it->startNodeId << " -> " << it->endNodeId << " (aucun itinéraire)" << std::endl;
+                it = pendingSharedSpawns.erase(it);
+                continue;
+            }
+
+            // Réseau modifié pendant le calcul : les index de segments ne sont plus sûrs, et un
+            // ensemble vide (couple coupé le temps d'une édition) est redemandé
+            if (it->routes->topologyVersion != graph->GetVersion()) {
+                it->routes = findRouteSet(it->startNodeId, it->endNodeId);
+                if (!it->routes) {
+                    Node* startNode = network->FindNodeById(it->startNodeId);
+                    Node* endNode = network->FindNodeById(it->endNodeId);
+                    if (!startNode || !endNode) { it = pendingSharedSpawns.erase(it); continue; }
+                    it->ticket = PathService::GetInstance().RequestRouteSet(*network, startNode, endNode, ROUTE_ALTERNATIVES);
+                }
+                ++it;
+                continue;
+            }
+
+            // Vide sur le réseau courant : aucun itinéraire
+            if (it->routes->routes.empty()) {
+                std::cout << "[SPAWN] Node " << it->startNodeId << " -> " << it->endNodeId << " (aucun itinéraire)" << std::endl;
+                it = pendingSharedSpawns.erase(it);
+                continue;
+            }
+
             if (nodeCooldowns[it->startNodeId] <= 0) {
-                if (internalExecuteNodeSpawn(it->startNodeId, it->endNodeId, it->type)) {
+                int choice = it->routes->Choose(*graph, *weights, routeRng);
+                if (choice < 0) { ++it; continue; } // tout est fermé pour l'instant : on attend
+                std::deque<RoadSegment*> route;
+                for (int idx : it->routes->routes[choice]) route.push_back(graph->GetSegment(idx));
+                if (internalExecuteNodeSpawn(*it, route)) {
                     it = pendingSharedSpawns.erase(it);
                     continue; // Skip ++it
                 }
@@ -76,233 +131,419 @@ void TrafficManager::update(float deltaTime) {
         }
     }
 
-    // If we have a network, assign leaders per segment by computing progress
     if (network) {
-        // First, clear all leaders and waiting states to start fresh each frame
-        // This prevents vehicles from getting permanently stuck if they were waiting
-        // for a leader or intersection that is no longer blocking them.
-        for (auto& vptr : vehicles) {
-            vptr->setLeader(nullptr);
-            vptr->setWaiting(false);
-        }
-        
-        // For each road segment, collect vehicles on it
-        const auto& segments = network->GetRoadSegments();
-        for (const auto& segPtr : segments) {
-            RoadSegment* seg = segPtr.get();
-            // collect (vehicle*, progress)
-            std::vector<std::pair<Vehicule*, float>> onSeg;
-            for (auto& vptr : vehicles) {
-                Vehicule* v = vptr.get();
-                float p = seg->ComputeProgressOnSegment(v->getPosition());
-                if (p >= 0.0f) onSeg.emplace_back(v, p);
+        // Simulation par régions : interactions (leaders, voies, intersections) puis pas de
+        // temps, chaque région sur un worker ; tout ce qui traverse une région est différé
+        prepareRegions();
+        runRegions([this](int r) { interactRegion(r); });
+        for (auto& region : regions) {
+            for (const IntersectionOp& op : region.intersectionOps) {
+                if (op.enter) op.intersection->Enter(op.vehicle);
+                else op.intersection->Exit(op.vehicle);
             }
+            region.intersectionOps.clear();
+        }
 
-            if (onSeg.empty()) continue;
+        // Les urgences replanifient via le réseau (caches non partagés) : thread appelant
+        for (auto& v : vehicles) {
+            if (dynamic_cast<EmergencyVehicle*>(v.get())) v->update(deltaTime);
+        }
+        runRegions([this, deltaTime](int r) { stepRegion(r, deltaTime); });
+
+        // Passages de frontière : files fusionnées par région cible puis source croissantes
+        lastHandoffCount = 0;
+        for (size_t to = 0; to < regions.size(); ++to) {
+            for (auto& from : regions) {
+                for (int i : from.handoff[to]) vehicles[i]->setRegion(static_cast<int>(to));
+                lastHandoffCount += static_cast<int>(from.handoff[to].size());
+                from.handoff[to].clear();
+            }
+        }
+    } else {
+        for (auto& v : vehicles) {
+            v->update(deltaTime);
+        }
+    }
 
-            // sort descending so first is front-most
-            std::sort(onSeg.begin(), onSeg.end(), [](const auto& a, const auto& b){ return a.second > b.second; });
+    // Temps de parcours réels -> coûts de routage (les urgences grillent les feux : non représentatives)
+    if (network) {
+        for (auto& v : vehicles) {
+            if (!dynamic_cast<EmergencyVehicle*>(v.get())) {
+                for (const auto& tr : v->getPendingTraversals()) {
+                    network->RecordTraversal(tr.road, tr.seconds);
+                }
+            }
+            v->clearPendingTraversals();
+        }
 
-            // assign leaders within segment - UNIQUEMENT SUR LA MÊME VOIE
-            for (size_t i = 0; i < onSeg.size(); ++i) {
-                Vehicule* v = onSeg[i].first;
-                v->setLeader(nullptr); 
-                for (int j = (int)i - 1; j >= 0; --j) {
-                    if (onSeg[j].first->getLane() == v->getLane()) {
-                        v->setLeader(onSeg[j].first);
-                        break;
+        travelTimePublishTimer += deltaTime;
+        if (travelTimePublishTimer >= TRAVEL_TIME_PUBLISH_INTERVAL) {
+            travelTimePublishTimer = 0.0f;
+            network->PublishTravelTimes();
+        }
+    }
+    
+    // Efficient cleanup using erase-remove idiom (std::erase_if equivalent for C++17)
+    // Efficient cleanup using erase-remove idiom (std::erase_if equivalent for C++17)
+    vehicles.erase(
+        std::remove_if(vehicles.begin(), vehicles.end(),
+            [this](const std::unique_ptr<Vehicule>& v) {
+                if (v->readyToRemove()) {
+                    // CRITICAL FIX: Remote from Intersection occupants BEFORE deletion
+                    // Otherwise, the intersection thinks it's still full of dead pointers
+                    // and blocks new spawns.
+                    if (network) {
+                        for (const auto& interPtr : network->GetIntersections()) {
+                            interPtr->Exit(v.get());
+                        }
                     }
+                    return true; 
+                }
+                return false;
+            }),
+        vehicles.end());
+}
+
+void TrafficManager::applyNetworkEdits() {
+    const uint64_t version = network->GetTopologyVersion();
+    if (version == seenTopology) return;
+    seenTopology = version;
+
+    // Segments retirés depuis le dernier update : ils restent valides jusqu'à ReleaseRetired(),
+    // le temps de sortir les véhicules engagés et de contourner ceux qui restent à parcourir
+    PathFinder finder(network);
+    for (auto& v : vehicles) {
+        if (dynamic_cast<EmergencyVehicle*>(v.get())) continue; // gérées par leur propre update
+        RoadSegment* committed = v->getCommittedRoad();
+        if (!committed) continue;
+        RoadSegment* current = v->getCurrentRoad();
+        if (!network->IsLive(committed) || (current && !network->IsLive(current))) {
+            v->leaveRoad();
+            continue;
+        }
+
+        const auto& remaining = v->getRemainingRoute();
+        int last = -1;
+        for (size_t k = 0; k < remaining.size(); ++k) {
+            if (!network->IsLive(remaining[k])) last = static_cast<int>(k);
+        }
+        if (last < 0) continue;
+
+        // Détour local jusqu'à la fin du dernier segment retiré, puis suite inchangée ;
+        // noeud retiré lui aussi : nouvel itinéraire jusqu'à la destination
+        Node* to = remaining[last]->GetEndNode();
+        if (network->GetNodeIndex(to) < 0) {
+            last = static_cast<int>(remaining.size()) - 1;
+            to = remaining.back()->GetEndNode();
+        }
+        std::deque<RoadSegment*> route;
+        if (network->GetNodeIndex(to) >= 0) route = finder.FindRoute(committed->GetEndNode(), to);
+        if (route.empty() && committed->GetEndNode() != to) {
+            v->replaceRemainingRoute({}); // destination inaccessible : fin de parcours au bout du segment
+            continue;
+        }
+        route.insert(route.end(), remaining.begin() + last + 1, remaining.end());
+        v->replaceRemainingRoute(route);
+    }
+}
+
+void TrafficManager::setRegionCount(int count) {
+    requestedRegions = std::max(0, count);
+}
+
+int TrafficManager::getRegionCount() const {
+    return partition ? partition->GetRegionCount() : 1;
+}
+
+int TrafficManager::homeRegion(const Vehicule& v) const {
+    // Région du segment engagé ; à défaut (véhicule hors itinéraire), celle du noeud le plus proche
+    if (RoadSegment* road = v.getCommittedRoad()) return partition->RegionOfSegment(road->GetIndex());
+    int node = spatial->NearestNode(v.getPosition());
+    return node >= 0 ? partition->RegionOfNode(node) : 0;
+}
+
+void TrafficManager::prepareRegions() {
+    spatial = network->GetSpatialIndex();
+    int wanted = requestedRegions;
+    if (wanted == 0) {
+        int cores = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+        wanted = std::clamp(network->GetNodeCount() / NODES_PER_REGION, 1, cores);
+    }
+
+    const uint64_t version = network->GetTopologyVersion();
+    if (!partition || partition->GetVersion() != version || partitionRequest != wanted) {
+        std::vector<int> nodeSlots, segmentSlots;
+        if (partition && partitionRequest == wanted
+            && network->GetEditsSince(partition->GetVersion(), nodeSlots, segmentSlots)) {
+            // Édition à chaud : seuls les noeuds touchés changent de région
+            partition = NetworkPartition::Patch(*partition, *network, nodeSlots, version);
+        } else {
+            partition = NetworkPartition::Build(*network, wanted, version);
+        }
+        partitionRequest = wanted;
+
+        std::shared_ptr<const RoutingGraph> graph = network->GetRoutingGraph();
+        const auto& intersections = network->GetIntersections();
+        intersectionOfNode.assign(network->GetNodeCount(), -1);
+        maxIntersectionRadius = 0.0f;
+        for (size_t k = 0; k < intersections.size(); ++k) {
+            int node = graph->IndexOf(intersections[k]->GetNode());
+            if (node >= 0 && intersectionOfNode[node] < 0) intersectionOfNode[node] = static_cast<int>(k);
+            maxIntersectionRadius = std::max(maxIntersectionRadius, intersections[k]->GetNode()->GetRadius());
+        }
+
+        const int count = partition->GetRegionCount();
+        regions.assign(count, RegionState{});
+        for (auto& region : regions) region.handoff.resize(count);
+        for (auto& v : vehicles) v->setRegion(-1);
+        if (count > 1 && (!workers || static_cast<int>(workers->GetThreadCount()) != count - 1)) {
+            workers = std::make_unique<ThreadPool>(count - 1);
+        } else if (count == 1) {
+            workers.reset();
+        }
+    }
+
+    // Résidents dans l'ordre de vehicles ; les nouveaux venus rejoignent leur région
+    for (auto& region : regions) region.residents.clear();
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+        Vehicule* v = vehicles[i].get();
+        int r = v->getRegion();
+        if (r < 0 || r >= static_cast<int>(regions.size())) {
+            r = homeRegion(*v);
+            v->setRegion(r);
+        }
+        regions[r].residents.push_back(static_cast<int>(i));
+    }
+
+    // Grille des positions de début de frame (lecture seule pendant les phases parallèles)
+    vehicleGrid.clear();
+    for (size_t i = 0; i < vehicles.size(); ++i) {
+        vehicleGrid.push_back({gridCell(vehicles[i]->getPosition(), 0, 0), static_cast<int>(i)});
+    }
+    std::sort(vehicleGrid.begin(), vehicleGrid.end());
+}
+
+int64_t TrafficManager::gridCell(const Vector3& p, int dx, int dz) {
+    int64_t cx = static_cast<int64_t>(std::floor(p.x / GRID_CELL)) + dx;
+    int64_t cz = static_cast<int64_t>(std::floor(p.z / GRID_CELL)) + dz;
+    return CellKey(cx, cz);
+}
+
+void TrafficManager::runRegions(const std::function<void(int)>& task) {
+    std::vector<std::future<void>> pending;
+    for (int r = 1; r < static_cast<int>(regions.size()); ++r) {
+        pending.push_back(workers->Submit([&task, r]() { task(r); }));
+    }
+    task(0); // la première région tourne sur le thread appelant
+    for (auto& f : pending) f.get();
+}
+
+void TrafficManager::interactRegion(int r) {
+    RegionState& region = regions[r];
+
+    // First, clear all leaders and waiting states to start fresh each frame
+    // This prevents vehicles from getting permanently stuck if they were waiting
+    // for a leader or intersection that is no longer blocking them.
+    for (int i : region.residents) {
+        vehicles[i]->setLeader(nullptr);
+        vehicles[i]->setWaiting(false);
+    }
+
+    // Véhicules en route regroupés par segment (tous résidents : le segment est à la région)
+    struct OnRoad {
+        int segment;
+        float progress;
+        int vehicle;
+    };
+    std::vector<OnRoad> onRoad;
+    for (int i : region.residents) {
+        Vehicule* v = vehicles[i].get();
+        if (v->getState() == Vehicule::State::ON_ROAD && v->getCurrentRoad()) {
+            onRoad.push_back({v->getCurrentRoad()->GetIndex(), v->getRoadProgress(), i});
+        }
+    }
+    // sort descending so first is front-most (index du véhicule en cas d'égalité : ordre stable)
+    std::sort(onRoad.begin(), onRoad.end(), [](const OnRoad& a, const OnRoad& b) {
+        if (a.segment != b.segment) return a.segment < b.segment;
+        if (a.progress != b.progress) return a.progress > b.progress;
+        return a.vehicle < b.vehicle;
+    });
+
+    std::vector<std::pair<Vehicule*, float>> onSeg;
+    for (size_t begin = 0; begin < onRoad.size();) {
+        size_t end = begin;
+        onSeg.clear();
+        while (end < onRoad.size() && onRoad[end].segment == onRoad[begin].segment) {
+            onSeg.emplace_back(vehicles[onRoad[end].vehicle].get(), onRoad[end].progress);
+            ++end;
+        }
+        RoadSegment* seg = network->GetRoadSegments()[onRoad[begin].segment].get();
+        begin = end;
+
+        // assign leaders within segment - UNIQUEMENT SUR LA MÊME VOIE
+        for (size_t i = 0; i < onSeg.size(); ++i) {
+            Vehicule* v = onSeg[i].first;
+            for (int j = (int)i - 1; j >= 0; --j) {
+                if (onSeg[j].first->getLane() == v->getLane()) {
+                    v->setLeader(onSeg[j].first);
+                    break;
                 }
             }
+        }
 
-            // --- LOGIQUE DE CHANGEMENT DE VOIE (User Request) ---
-            // Si une voie est encombrée et l'autre est libre, les véhicules changent de voie.
-            int forwardLanes = seg->GetLanes() / 2;
-            if (forwardLanes > 1) {
-                std::vector<int> laneWaitCount(forwardLanes, 0);
-                for (auto& pair : onSeg) {
-                    if (pair.first->isWaitingStatus()) {
-                        int l = pair.first->getLane();
-                        if (l < forwardLanes) laneWaitCount[l]++;
-                    }
+        // --- LOGIQUE DE CHANGEMENT DE VOIE (User Request) ---
+        // Si une voie est encombrée et l'autre est libre, les véhicules changent de voie.
+        int forwardLanes = seg->GetLanes() / 2;
+        if (forwardLanes > 1) {
+            std::vector<int> laneWaitCount(forwardLanes, 0);
+            for (auto& pair : onSeg) {
+                if (pair.first->isWaitingStatus()) {
+                    int l = pair.first->getLane();
+                    if (l < forwardLanes) laneWaitCount[l]++;
                 }
+            }
 
-                for (auto& pair : onSeg) {
-                    Vehicule* v = pair.first;
-                    // Uniquement si on attend, qu'on est sur une route normale et avec une probabilité de décision
-                    if (v->isWaitingStatus() && v->getState() == Vehicule::State::ON_ROAD && (GetRandomValue(0, 100) < 10)) {
-                        int myLane = v->getLane();
-                        if (myLane >= forwardLanes) continue;
-
-                        for (int otherLane = 0; otherLane < forwardLanes; ++otherLane) {
-                            if (otherLane == myLane) continue;
-
-                            // Si la différence est marquée (ex: 2+ véhicules)
-                            if (laneWaitCount[otherLane] < laneWaitCount[myLane] - 1) {
-                                // Vérification de sécurité : l'espace est-il libre dans la voie cible ?
-                                bool spaceFree = true;
-                                for (auto& checkPair : onSeg) {
-                                    if (checkPair.first->getLane() == otherLane) {
-                                        float distT = fabsf(checkPair.second - pair.second);
-                                        if (distT < 0.08f) { // ~8% de la route, ajustable
-                                            spaceFree = false;
-                                            break;
-                                        }
+            for (auto& pair : onSeg) {
+                Vehicule* v = pair.first;
+                // Uniquement si on attend, qu'on est sur une route normale et avec une probabilité de décision
+                if (v->isWaitingStatus() && v->getState() == Vehicule::State::ON_ROAD && (v->nextRandom(0, 100) < 10)) {
+                    int myLane = v->getLane();
+                    if (myLane >= forwardLanes) continue;
+
+                    for (int otherLane = 0; otherLane < forwardLanes; ++otherLane) {
+                        if (otherLane == myLane) continue;
+
+                        // Si la différence est marquée (ex: 2+ véhicules)
+                        if (laneWaitCount[otherLane] < laneWaitCount[myLane] - 1) {
+                            // Vérification de sécurité : l'espace est-il libre dans la voie cible ?
+                            bool spaceFree = true;
+                            for (auto& checkPair : onSeg) {
+                                if (checkPair.first->getLane() == otherLane) {
+                                    float distT = fabsf(checkPair.second - pair.second);
+                                    if (distT < 0.08f) { // ~8% de la route, ajustable
+                                        spaceFree = false;
+                                        break;
                                     }
                                 }
+                            }
 
-                                if (spaceFree) {
-                                    v->setLane(otherLane);
-                                    laneWaitCount[myLane]--;
-                                    laneWaitCount[otherLane]++;
-                                    break; // Un changement à la fois
-                                }
+                            if (spaceFree) {
+                                v->setLane(otherLane);
+                                laneWaitCount[myLane]--;
+                                laneWaitCount[otherLane]++;
+                                break; // Un changement à la fois
                             }
                         }
                     }
                 }
             }
+        }
 
-            // CROSS-SEGMENT LEADER DETECTION
-            // For the front-most vehicle on this segment, find the next segment in its path 
-            // and check if there's a vehicle there that should be followed.
-            if (!onSeg.empty()) {
-                Vehicule* frontV = onSeg[0].first;
-                // frontV->setLeader(nullptr); // Already cleared above
-
-                // Enhanced proximity check for cross-segment and waiting vehicles
-                // This helps catch vehicles waiting at intersections
-                Vehicule* closestAhead = nullptr;
-                float closestDist = 30.0f; // Portée réduite pour éviter les interférences dans les ronds-points
-                
-                for (auto& otherPtr : vehicles) {
-                    Vehicule* other = otherPtr.get();
+        // CROSS-SEGMENT LEADER DETECTION
+        // For the front-most vehicle on this segment, check if there's a vehicle ahead
+        // (possibly in another region: positions are read-only during this phase).
+        Vehicule* frontV = onSeg[0].first;
+        Vehicule* closestAhead = nullptr;
+        float closestDist = 30.0f; // Portée réduite pour éviter les interférences dans les ronds-points
+        Vector3 dir = {
+            sinf(frontV->getRotationAngle() * DEG2RAD),
+            0,
+            cosf(frontV->getRotationAngle() * DEG2RAD)
+        };
+        for (int dx = -1; dx <= 1; ++dx) {
+            for (int dz = -1; dz <= 1; ++dz) {
+                const int64_t cell = gridCell(frontV->getPosition(), dx, dz);
+                auto it = std::lower_bound(vehicleGrid.begin(), vehicleGrid.end(), std::make_pair(cell, -1));
+                for (; it != vehicleGrid.end() && it->first == cell; ++it) {
+                    Vehicule* other = vehicles[it->second].get();
                     if (other == frontV) continue;
-
                     Vector3 toOther = Vector3Subtract(other->getPosition(), frontV->getPosition());
                     float dist = Vector3Length(toOther);
-                    
-                    // IMPROVED: Use tighter distance check to prevent false leader assignments
-                    // and ensure proper queue formation with correct spacing
-                    if (dist < closestDist && dist > 2.0f) { // Minimum 2m to avoid self-detection issues
-                        Vector3 dir = {
-                            sinf(frontV->getRotationAngle() * DEG2RAD),
-                            0,
-                            cosf(frontV->getRotationAngle() * DEG2RAD)
-                        };
-                        
-                        float dot = Vector3DotProduct(Vector3Normalize(toOther), dir);
-                        
-                        // More lenient angle for curve detection and stopped vehicles
-                        // This helps detect vehicles waiting at intersections ahead
-                        if (dot > 0.5f) { // Relaxed to 60 degrees for curves/roundabouts
-                            closestAhead = other;
-                            closestDist = dist;
-                        }
+                    // Minimum 2m to avoid self-detection issues ; 60 degrees for curves/roundabouts
+                    if (dist < closestDist && dist > 2.0f && Vector3DotProduct(Vector3Normalize(toOther), dir) > 0.5f) {
+                        closestAhead = other;
+                        closestDist = dist;
                     }
                 }
-                
-                if (closestAhead) {
-                    frontV->setLeader(closestAhead);
-                }
             }
         }
+        if (closestAhead) {
+            frontV->setLeader(closestAhead);
+        }
     }
 
-    // Gestion des intersections (verrou simple)
-    if (network) {
-        const auto& intersections = network->GetIntersections();
-        for (auto& vptr : vehicles) {
-            Vehicule* v = vptr.get();
-            bool insideAny = false;
-
-            for (const auto& interPtr : intersections) {
-                Intersection* inter = interPtr.get();
-                float dist = Vector3Distance(v->getPosition(), inter->GetNode()->GetPosition());
-                float radius = inter->GetNode()->GetRadius();
-
-                // Zone d'approche ÉLARGIE pour arrêter les véhicules plus tôt et former une queue
-                // Node 2 is a large intersection (radius 20), so we need a generous approach zone
-                const float APPROACH_ZONE = 30.0f; // Increased from 20.0f
-                
-                if (dist < radius + APPROACH_ZONE && dist > radius) {
-                     const auto& occ = inter->GetOccupants();
-                     bool isOccupant = (std::find(occ.begin(), occ.end(), v) != occ.end());
-
-                     if (!isOccupant) {
-                         // TRAFFIC LIGHT LOGIC
-                         bool redLightStop = false;
-                         if (inter->GetNode()->GetType() == TRAFFIC_LIGHT) {
-                             // Check if emergency vehicle on mission (they ignore lights)
-                             bool isEmergencyOnMission = false;
-                             if (auto* ev = dynamic_cast<EmergencyVehicle*>(v)) {
-                                 if (ev->isOnMission()) isEmergencyOnMission = true;
-                             }
-
-                             if (!isEmergencyOnMission) {
-                                 auto state = inter->GetNode()->GetLightState();
-                                 if (state == LIGHT_RED || state == LIGHT_YELLOW) {
-                                     redLightStop = true;
-                                 }
-                             }
-                         }
-
-                         if (redLightStop) {
-                             v->setWaiting(true);
-                         } else {
-                             inter->Enter(v);
-                             v->setWaiting(false);
-                         }
-                     }
-                }
-                // Zone intérieure
-                else if (dist <= radius) {
-                    insideAny = true;
-                    // S'assurer qu'on ne bloque pas (en cas de reprise)
-                     const auto& occ = inter->GetOccupants();
-                     bool isOccupant = (std::find(occ.begin(), occ.end(), v) != occ.end());
-                     if (!isOccupant) {
-                        inter->Enter(v); // Force enter si on a glitché dedans
-                     }
-                     v->setWaiting(false);
+    // Gestion des intersections (verrou simple) : intersections proches seulement, dans l'ordre
+    // du réseau (la dernière décide, comme le parcours complet). Entrées / sorties différées.
+    const auto& intersections = network->GetIntersections();
+    const float reach = maxIntersectionRadius + 2.0f * APPROACH_ZONE;
+    std::vector<int> nearNodes, nearIntersections;
+    for (int i : region.residents) {
+        Vehicule* v = vehicles[i].get();
+        spatial->QueryNodes(v->getPosition(), reach, nearNodes);
+        nearIntersections.clear();
+        for (int node : nearNodes) {
+            if (intersectionOfNode[node] >= 0) nearIntersections.push_back(intersectionOfNode[node]);
+        }
+        std::sort(nearIntersections.begin(), nearIntersections.end());
+
+        for (int k : nearIntersections) {
+            Intersection* inter = intersections[k].get();
+            float dist = Vector3Distance(v->getPosition(), inter->GetNode()->GetPosition());
+            float radius = inter->GetNode()->GetRadius();
+            const auto& occ = inter->GetOccupants();
+            bool isOccupant = (std::find(occ.begin(), occ.end(), v) != occ.end());
+
+            if (dist < radius + APPROACH_ZONE && dist > radius) {
+                if (!isOccupant) {
+                    // TRAFFIC LIGHT LOGIC
+                    bool redLightStop = false;
+                    if (inter->GetNode()->GetType() == TRAFFIC_LIGHT) {
+                        // Check if emergency vehicle on mission (they ignore lights)
+                        bool isEmergencyOnMission = false;
+                        if (auto* ev = dynamic_cast<EmergencyVehicle*>(v)) {
+                            if (ev->isOnMission()) isEmergencyOnMission = true;
+                        }
+
+                        if (!isEmergencyOnMission) {
+                            auto state = inter->GetNode()->GetLightState();
+                            if (state == LIGHT_RED || state == LIGHT_YELLOW) {
+                                redLightStop = true;
+                            }
+                        }
+                    }
+
+                    if (redLightStop) {
+                        v->setWaiting(true);
+                    } else {
+                        region.intersectionOps.push_back({inter, v, true});
+                        v->setWaiting(false);
+                    }
                 }
-                // Zone de sortie (juste après)
-                else {
-                    // Si on était occupant et qu'on est loin, on sort
-                     const auto& occ = inter->GetOccupants();
-                     if (std::find(occ.begin(), occ.end(), v) != occ.end()) {
-                         if (dist > radius + 5.0f) {
-                             inter->Exit(v);
-                         }
-                     }
+            }
+            // Zone intérieure
+            else if (dist <= radius) {
+                // S'assurer qu'on ne bloque pas (en cas de reprise)
+                if (!isOccupant) {
+                    region.intersectionOps.push_back({inter, v, true}); // Force enter si on a glitché dedans
                 }
+                v->setWaiting(false);
+            }
+            // Zone de sortie : si on était occupant et qu'on est loin, on sort
+            else if (isOccupant && dist > radius + 5.0f) {
+                region.intersectionOps.push_back({inter, v, false});
             }
         }
     }
+}
 
-    for (auto& v : vehicles) {
-        v->update(deltaTime);
+void TrafficManager::stepRegion(int r, float deltaTime) {
+    RegionState& region = regions[r];
+    for (int i : region.residents) {
+        Vehicule* v = vehicles[i].get();
+        if (!dynamic_cast<EmergencyVehicle*>(v)) v->update(deltaTime);
+        int home = homeRegion(*v);
+        if (home != r) region.handoff[home].push_back(i);
     }
-    
-    // Efficient cleanup using erase-remove idiom (std::erase_if equivalent for C++17)
-    // Efficient cleanup using erase-remove idiom (std::erase_if equivalent for C++17)
-    vehicles.erase(
-        std::remove_if(vehicles.begin(), vehicles.end(),
-            [this](const std::unique_ptr<Vehicule>& v) {
-                if (v->readyToRemove()) {
-                    // CRITICAL FIX: Remote from Intersection occupants BEFORE deletion
-                    // Otherwise, the intersection thinks it's still full of dead pointers
-                    // and blocks new spawns.
-                    if (network) {
-                        for (const auto& interPtr : network->GetIntersections()) {
-                            interPtr->Exit(v.get());
-                        }
-                    }
-                    return true; 
-                }
-                return false;
-            }),
-        vehicles.end());
 }
 
 const std::vector<Vector3> TrafficManager::getVehiclePositions() const {
@@ -385,8 +626,8 @@ bool TrafficManager::spawnNext(const std::function<std::string(VehiculeType)>& m
             if (!modelPath.empty()) v = VehiculeFactory::createVehicule(t, spawnPos, modelPath);
             else v = VehiculeFactory::createVehicule(t, spawnPos);
 
-            // Warn if a model path was provided but loading failed (meshCount == 0)
-            if (!modelPath.empty() && v && !v->hasLoadedModel()) {
+            // Warn if a model path was provided but loading failed (meshCount == 0, not still streaming)
+            if (!modelPath.empty() && v && !v->hasLoadedModel() && !v->getModelHandle().isPending()) {
                 std::cerr << "Warning: Failed to load model '" << modelPath << "' for vehicle type " << static_cast<int>(t) << std::endl;
             }
 
@@ -466,33 +707,15 @@ int TrafficManager::getPendingCount() const {
     return c;
 }
 
-void TrafficManager::draw() {
-    for (auto& v : vehicles) {
-        v->draw();
-    }
+void TrafficManager::draw(const Frustum* view) {
+    renderer.Draw(vehicles, view);
 }
 
 bool TrafficManager::spawnVehicleByNodeIds(int startNodeId, int endNodeId, VehiculeType type) {
-    // Si un cooldown est actif pour ce noeud, on met en attente
-    if (nodeCooldowns.count(startNodeId) > 0 && nodeCooldowns[startNodeId] > 0.0f) {
-        pendingSharedSpawns.push_back({startNodeId, endNodeId, type});
-        return true; // Donnée acceptée pour le futur
-    }
-
-    // Sinon on tente le spawn immédiat
-    return internalExecuteNodeSpawn(startNodeId, endNodeId, type);
-}
-
-bool TrafficManager::internalExecuteNodeSpawn(int startNodeId, int endNodeId, VehiculeType type) {
-    auto& nodes = network->GetNodes();
-    Node* startNode = nullptr;
-    Node* endNode = nullptr;
-
-    for (auto& n : nodes) {
-        if (n->GetId() == startNodeId) startNode = n.get();
-        if (n->GetId() == endNodeId) endNode = n.get();
-    }
+    if (!network) return false;
 
+    Node* startNode = network->FindNodeById(startNodeId);
+    Node* endNode = network->FindNodeById(endNodeId);
     if (!startNode || !endNode) return false;
 
     // --- ENFORCE STRICT SPAWN/DESPAWN NODES ---
@@ -514,25 +737,36 @@ bool TrafficManager::internalExecuteNodeSpawn(int startNodeId, int endNodeId, Ve
         return false;
     }
 
-    PathFinder pf(network);
-    std::vector<Node*> nodePath = pf.FindPath(startNode, endNode);
-    if (nodePath.empty()) return false;
-
-    std::deque<RoadSegment*> roadRoute;
-    for (size_t i = 0; i < nodePath.size() - 1; ++i) {
-        Node* u = nodePath[i];
-        Node* v = nodePath[i+1];
-        RoadSegment* connecting = nullptr;
-        const auto& allSegments = network->GetRoadSegments();
-        for (const auto& segPtr : allSegments) {
-            if (segPtr->GetStartNode() == u && segPtr->GetEndNode() == v) {
-                connecting = segPtr.get();
+    // Alternatives déjà connues pour ce couple : pas de nouvelle recherche
+    NodeSpawnRequest request{startNodeId, endNodeId, type, {}, findRouteSet(startNodeId, endNodeId)};
+    if (!request.routes) {
+        // Calcul déjà en cours pour le même couple : on partage son ticket
+        for (const auto& pending : pendingSharedSpawns) {
+            if (!pending.routes && pending.startNodeId == startNodeId && pending.endNodeId == endNodeId) {
+                request.ticket = pending.ticket;
                 break;
             }
         }
-        if (connecting) roadRoute.push_back(connecting);
+        if (!request.ticket.valid()) {
+            request.ticket = PathService::GetInstance().RequestRouteSet(*network, startNode, endNode, ROUTE_ALTERNATIVES);
+        }
     }
-    if (roadRoute.empty()) return false;
+
+    // Le véhicule attend dans la file jusqu'à ce que son itinéraire soit disponible (voir update)
+    pendingSharedSpawns.push_back(std::move(request));
+    return true; // Donnée acceptée pour le futur
+}
+
+std::shared_ptr<const RouteSet> TrafficManager::findRouteSet(int startNodeId, int endNodeId) {
+    if (!network || routeSetsVersion != network->GetTopologyVersion()) return nullptr;
+    auto it = routeSets.find(odKey(startNodeId, endNodeId));
+    return it == routeSets.end() ? nullptr : it->second;
+}
+
+bool TrafficManager::internalExecuteNodeSpawn(const NodeSpawnRequest& request, const std::deque<RoadSegment*>& roadRoute) {
+    const int startNodeId = request.startNodeId;
+    const int endNodeId = request.endNodeId;
+    const VehiculeType type = request.type;
 
     RoadSegment* firstRoad = roadRoute.front();
     int forwardLanes = firstRoad->GetLanes() / 2; 
@@ -0,0 +1,221 @@
+#include "Vehicules/VehicleRenderer.h"
+#include "Vehicules/Vehicule.h"
+#include "Vehicules/ModelManager.h"
+#include "raymath.h"
+#include "rlgl.h"
+
+namespace {
+    const char* kInstancingVs = R"(#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in vec4 vertexColor;
+in mat4 instanceTransform;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+out vec4 fragColor;
+void main() {
+    mat4 model = instanceTransform;
+    vec3 tint = vec3(model[0][3], model[1][3], model[2][3]);
+    model[0][3] = 0.0; model[1][3] = 0.0; model[2][3] = 0.0; model[3][3] = 1.0;
+    fragTexCoord = vertexTexCoord;
+    fragColor = vertexColor*vec4(tint, 1.0);
+    gl_Position = mvp*model*vec4(vertexPosition, 1.0);
+}
+)";
+
+    const char* kInstancingFs = R"(#version 330
+in vec2 fragTexCoord;
+in vec4 fragColor;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main() {
+    finalColor = texture(texture0, fragTexCoord)*colDiffuse*fragColor;
+}
+)";
+
+    void SetTint(Matrix& m, Color tint) {
+        m.m3 = tint.r / 255.0f;
+        m.m7 = tint.g / 255.0f;
+        m.m11 = tint.b / 255.0f;
+    }
+}
+
+VehicleRenderer::~VehicleRenderer() {
+    if (IsWindowReady()) Release();
+}
+
+Matrix VehicleRenderer::InstanceTransform(const Vehicule& v) {
+    const Model& model = v.getModel();
+    Vector3 pos = v.getPosition();
+    Matrix m;
+    if (model.meshCount == 0) {
+        // Cube de repli centré sur la position, sans rotation (DrawCube)
+        m = MatrixTranslate(pos.x, pos.y, pos.z);
+        SetTint(m, v.getDebugColor());
+        return m;
+    }
+    // Même composition que DrawModelEx : échelle, cap, translation, puis transformation du modèle
+    const float scale = v.getScale();
+    Matrix transform = MatrixMultiply(MatrixMultiply(MatrixScale(scale, scale, scale),
+                                                     MatrixRotateY(v.getRotationAngle() * DEG2RAD)),
+                                      MatrixTranslate(pos.x, pos.y + v.getRenderHeight(), pos.z));
+    m = MatrixMultiply(model.transform, transform);
+    SetTint(m, WHITE);
+    return m;
+}
+
+Matrix VehicleRenderer::BoxTransform(const Vehicule& v, const ModelLod& lod) {
+    // Cube de repli (2 x 2 x 4) étiré sur la boîte du modèle, puis placé comme le modèle
+    const Vector3 center = Vector3Scale(Vector3Add(lod.bounds.min, lod.bounds.max), 0.5f);
+    const Vector3 size = Vector3Subtract(lod.bounds.max, lod.bounds.min);
+    const float scale = v.getScale();
+    const Vector3 pos = v.getPosition();
+    Matrix m = MatrixMultiply(MatrixScale(size.x * 0.5f, size.y * 0.5f, size.z * 0.25f),
+                              MatrixTranslate(center.x, center.y, center.z));
+    m = MatrixMultiply(m, MatrixMultiply(MatrixMultiply(MatrixScale(scale, scale, scale),
+                                                        MatrixRotateY(v.getRotationAngle() * DEG2RAD)),
+                                         MatrixTranslate(pos.x, pos.y + v.getRenderHeight(), pos.z)));
+    SetTint(m, lod.color);
+    return m;
+}
+
+VehicleRenderer::Batch& VehicleRenderer::BatchFor(const Mesh* key, const Model& model) {
+    auto it = batchOf.find(key);
+    if (it == batchOf.end()) {
+        it = batchOf.emplace(key, batches.size()).first;
+        batches.emplace_back();
+    }
+    Batch& batch = batches[it->second];
+    if (batch.transforms.empty()) batch.model = key ? model : Model{}; // modèle recyclé à la même adresse
+    return batch;
+}
+
+template <class Vehicles>
+void VehicleRenderer::CollectAll(const Vehicles& vehicles, const Frustum* view) {
+    // Lots conservés d'une frame à l'autre (capacité des tampons), vidés ici
+    for (Batch& b : batches) b.transforms.clear();
+    individual.clear();
+    stats.Reset();
+    for (const auto& entry : vehicles) {
+        Vehicule& v = *entry;
+        if (view && !view->IntersectsSphere(v.getPosition(), kCullRadius)) {
+            ++stats.frustumCulled;
+            continue;
+        }
+        ++stats.drawn;
+        if (!v.isInstanceable()) {
+            individual.push_back(&v);
+            continue;
+        }
+        // Niveau de détail : modèle simplifié ou boîte (lot du cube), choisi par le véhicule
+        const ModelLod* lod = ModelManager::getInstance().getLod(v.getModel());
+        const LodLevel level = v.selectLod();
+        const bool box = lod && level == LodLevel::Box;
+        const Model& model = (lod && level == LodLevel::Simplified && lod->simplified.meshCount > 0)
+            ? lod->simplified : v.getModel();
+        const Mesh* key = (model.meshCount > 0 && !box) ? model.meshes : nullptr;
+        const Matrix transform = box ? BoxTransform(v, *lod) : InstanceTransform(v);
+        BatchFor(key, model).transforms.push_back(transform);
+
+        // Lampes : placées comme le modèle, teinte de la frame
+        const Model* lampModel = v.getLampModel();
+        if (!key || !lampModel || lampModel->meshCount == 0) continue;
+        Matrix base = transform;
+        SetTint(base, BLANK);
+        Batch& lamps = BatchFor(lampModel->meshes, *lampModel);
+        for (const Vehicule::Lamp& lamp : v.getLamps()) {
+            Matrix m = MatrixMultiply(MatrixTranslate(lamp.offset.x, lamp.offset.y, lamp.offset.z), base);
+            SetTint(m, lamp.color);
+            lamps.transforms.push_back(m);
+        }
+    }
+}
+
+void VehicleRenderer::Collect(const std::vector<std::unique_ptr<Vehicule>>& vehicles, const Frustum* view) {
+    CollectAll(vehicles, view);
+}
+
+void VehicleRenderer::Collect(const std::vector<Vehicule*>& vehicles, const Frustum* view) {
+    CollectAll(vehicles, view);
+}
+
+bool VehicleRenderer::EnsureResources() {
+    if (shaderFailed) return false;
+    if (!shaderLoaded) {
+        shader = LoadShaderFromMemory(kInstancingVs, kInstancingFs);
+        if (shader.id == 0 || shader.id == rlGetShaderIdDefault()) {
+            TraceLog(LOG_WARNING, "[VehicleRenderer] Shader d'instanciation indisponible : rendu individuel");
+            shaderFailed = true;
+            return false;
+        }
+        shader.locs[SHADER_LOC_MATRIX_MODEL] = GetShaderLocationAttrib(shader, "instanceTransform");
+        shaderLoaded = true;
+    }
+    if (!hasCube) {
+        cube = GenMeshCube(2.0f, 2.0f, 4.0f);
+        cubeMaterial = LoadMaterialDefault();
+        cubeMaterial.shader = shader;
+        hasCube = true;
+    }
+    return true;
+}
+
+template <class Vehicles>
+void VehicleRenderer::DrawAll(const Vehicles& vehicles, const Frustum* view) {
+    CollectAll(vehicles, view);
+    if (!EnsureResources()) {
+        for (const auto& v : vehicles) {
+            if (!view || view->IntersectsSphere(v->getPosition(), kCullRadius)) v->draw();
+        }
+        return;
+    }
+    for (const Batch& batch : batches) {
+        const int count = static_cast<int>(batch.transforms.size());
+        if (count == 0) continue;
+        if (batch.model.meshCount == 0) {
+            DrawMeshInstanced(cube, cubeMaterial, batch.transforms.data(), count);
+            continue;
+        }
+        for (int i = 0; i < batch.model.meshCount; ++i) {
+            Material material = batch.model.materials[batch.model.meshMaterial[i]];
+            material.shader = shader; // textures et couleurs du modèle, sommets instanciés
+            DrawMeshInstanced(batch.model.meshes[i], material, batch.transforms.data(), count);
+        }
+    }
+    for (Vehicule* v : individual) v->draw();
+}
+
+void VehicleRenderer::Draw(const std::vector<std::unique_ptr<Vehicule>>& vehicles, const Frustum* view) {
+    DrawAll(vehicles, view);
+}
+
+void VehicleRenderer::Draw(const std::vector<Vehicule*>& vehicles, const Frustum* view) {
+    DrawAll(vehicles, view);
+}
+
+void VehicleRenderer::Release() {
+    if (hasCube) {
+        UnloadMesh(cube);
+        cubeMaterial.shader = {}; // le shader est libéré une seule fois, ci-dessous
+        MemFree(cubeMaterial.maps);
+        hasCube = false;
+    }
+    if (shaderLoaded) UnloadShader(shader);
+    shaderLoaded = false;
+    shaderFailed = false;
+}
+
+int VehicleRenderer::GetInstanceCount() const {
+    int count = 0;
+    for (const Batch& b : batches) count += static_cast<int>(b.transforms.size());
+    return count;
+}
+
+int VehicleRenderer::GetDrawCallCount() const {
+    int count = static_cast<int>(individual.size());
+    for (const Batch& b : batches) {
+        if (!b.transforms.empty()) count += b.model.meshCount > 0 ? b.model.meshCount : 1;
+    }
+    return count;
+}
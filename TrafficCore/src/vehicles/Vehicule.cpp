@@ -1,4 +1,5 @@
 #include "Vehicules/Vehicule.h"
+#include "Vehicules/ModelManager.h"
 #include "Vehicules/TrafficManager.h"
 #include <cmath>
 #include <algorithm>
@@ -7,10 +8,9 @@ Vehicule::Vehicule(Vector3 startPos, float maxSpd, float accel, Model mdl, float
     : position(startPos),
       maxSpeed(maxSpd),
       acceleration(accel),
-      model(mdl),
+      model(ModelManager::getInstance().share(mdl)),
       scale(sc),
       debugColor(dColor),
-      ownModel(false),
       angle(0.0f)
 {
     currentSpeed = 0.0f;
@@ -21,14 +21,14 @@ Vehicule::Vehicule(Vector3 startPos, float maxSpd, float accel, Model mdl, float
     updateYOffset();
 }
 
-// Load Model from file path and take ownership
+// Model from file path, loaded once by ModelManager and shared with the other vehicles
 Vehicule::Vehicule(Vector3 startPos, float maxSpd, float accel, const std::string& modelPath, float sc, Color dColor)
     : position(startPos),
       maxSpeed(maxSpd),
       acceleration(accel),
+      model(ModelManager::getInstance().acquire(modelPath)),
       scale(sc),
       debugColor(dColor),
-      ownModel(false),
       angle(0.0f)
 {
     currentSpeed = 0.0f;
@@ -37,20 +37,18 @@ Vehicule::Vehicule(Vector3 startPos, float maxSpd, float accel, const std::strin
     state = State::ON_ROAD; // Default
     leader = nullptr;
 
-    // Support spaces in file names; use std::string to hold path
-    model = LoadModel(modelPath.c_str());
-    ownModel = (model.meshCount > 0);
     updateYOffset();
 }
 
-Vehicule::~Vehicule() {
-    if (ownModel && model.meshCount > 0) {
-        UnloadModel(model);
-    }
+Vehicule::~Vehicule() = default; // le handle rend sa référence au cache
+
+const std::vector<Vehicule::Lamp>& Vehicule::getLamps() const {
+    static const std::vector<Lamp> none;
+    return none;
 }
 
 bool Vehicule::hasLoadedModel() const {
-    return model.meshCount > 0;
+    return model.isLoaded();
 }
 
 // === NOUVELLE LOGIQUE PHYSIQUE ===
@@ -76,6 +74,7 @@ void Vehicule::setRoute(const std::deque<RoadSegment*>& newRoute) {
         currentRoad = route.front();
         route.pop_front();
         t_param = 0.0f;
+        roadTimer = 0.0f;
         state = State::ON_ROAD;
         position = currentRoad->GetTrafficLanePosition(currentLane, 0.0f);
         Vector3 dir = currentRoad->GetDirection();
@@ -86,12 +85,53 @@ void Vehicule::setRoute(const std::deque<RoadSegment*>& newRoute) {
     }
 }
 
+void Vehicule::leaveRoad() {
+    route.clear();
+    currentRoad = nullptr;
+    rabContext.active = false;
+    rabContext.nextRoad = nullptr;
+    transContext.nextRoad = nullptr;
+    state = State::ON_ROAD;
+    currentSpeed = 0.0f;
+    leader = nullptr;
+    pendingTraversals.clear();
+    isFinished = true;
+}
+
+RoadSegment* Vehicule::getCommittedRoad() const {
+    switch (state) {
+        case State::ENTER_ROUNDABOUT:
+        case State::IN_ROUNDABOUT:
+        case State::EXIT_ROUNDABOUT:
+            return rabContext.nextRoad;
+        case State::INTERSECTION_TRANSITION:
+            return transContext.nextRoad;
+        default:
+            return currentRoad;
+    }
+}
+
+void Vehicule::recordTraversal() {
+    if (currentRoad) pendingTraversals.push_back(Traversal{currentRoad, roadTimer});
+    roadTimer = 0.0f;
+}
+
+int Vehicule::nextRandom(int minValue, int maxValue) {
+    // xorshift32
+    randomState ^= randomState << 13;
+    randomState ^= randomState >> 17;
+    randomState ^= randomState << 5;
+    if (maxValue <= minValue) return minValue;
+    return minValue + static_cast<int>(randomState % static_cast<uint32_t>(maxValue - minValue + 1));
+}
+
 void Vehicule::setLane(int laneId) {
     currentLane = std::clamp(laneId, 0, 99);
 }
 
 void Vehicule::updatePhysics(float dt) {
     if (isFinished) return;
+    roadTimer += dt;
     
     // === SAFETY DISTANCE CHECK (Optimisée pour éviter les blocages) ===
     const float MINIMUM_SAFETY_DISTANCE = 22.0f;
@@ -99,7 +139,7 @@ void Vehicule::updatePhysics(float dt) {
     
     // isWaiting = false; // Managed by TrafficManager (do not reset here)
     if (leader != nullptr) {
-        Vector3 toLeader = Vector3Subtract(leader->getPosition(), position);
+        Vector3 toLeader = Vector3Subtract(leaderPosition, position);
         float distToLeader = Vector3Length(toLeader);
         
         Vector3 dir = {sinf(angle), 0, cosf(angle)};
@@ -173,6 +213,7 @@ void Vehicule::updatePhysics(float dt) {
         }
 
         if (t_param >= limitT) {
+            recordTraversal();
             if (headingToRoundabout) {
                 if (route.empty()) { isFinished = true; }
                 else {
@@ -216,7 +257,7 @@ void Vehicule::updatePhysics(float dt) {
                 // --- DISTRIBUTE TRAFFIC: Pick random lane on next road ---
                 int fwdLanes = nextRoad->GetLanes() / 2;
                 if (fwdLanes < 1) fwdLanes = 1;
-                currentLane = GetRandomValue(0, fwdLanes - 1);
+                currentLane = nextRandom(0, fwdLanes - 1);
 
                 transContext.startPos = position;
                 transContext.endPos = nextRoad->GetTrafficLanePosition(currentLane, 0.0f);
@@ -314,6 +355,7 @@ void Vehicule::updatePhysics(float dt) {
         
         rabContext.active = false;
         isWaiting = false;
+        roadTimer = 0.0f; // Le rond-point est couvert par le coût de manoeuvre du routage
 
         float roadLen = currentRoad ? currentRoad->GetLength() : 0.0f;
         if (roadLen > 1e-4f) {
@@ -363,6 +405,7 @@ void Vehicule::updatePhysics(float dt) {
             state = State::ON_ROAD;
             currentRoad = transContext.nextRoad;
             t_param = 0.0f;
+            roadTimer = 0.0f; // Idem pour la transition d'intersection
             position = transContext.endPos; // Final snap to exact start of next road
             
             // Align angle smoothly to the new road's direction
@@ -399,23 +442,33 @@ void Vehicule::updatePhysics(float dt) {
 }
 
 void Vehicule::draw() {
-    if (model.meshCount == 0) {
+    const Model& mdl = model.get();
+    if (mdl.meshCount == 0) {
         DrawCube(position, 2.0f, 2.0f, 4.0f, debugColor);
         DrawCubeWires(position, 2.1f, 2.1f, 4.1f, BLACK);
     } else {
         Vector3 renderPos = position;
-        renderPos.y += 0.03f + yOffset; 
-        DrawModelEx(model, renderPos, {0,1,0}, getRotationAngle(), {scale,scale,scale}, WHITE);
+        renderPos.y += getRenderHeight();
+        LodLevel level = selectLod();
+        DrawModelLod(mdl, ModelManager::getInstance().getLod(mdl), level, renderPos, getRotationAngle(), scale, WHITE);
     }
 }
 
+LodLevel Vehicule::selectLod() {
+    const ModelLod* lod = ModelManager::getInstance().getLod(model.get());
+    if (!lod) return lodLevel = LodLevel::Full;
+    Vector3 renderPos = {position.x, position.y + getRenderHeight(), position.z};
+    lodLevel = LodSelector::Select(*lod, renderPos, scale, lodLevel);
+    return lodLevel;
+}
+
 void Vehicule::normalizeSize(float targetLength) {
-    if (model.meshCount == 0) {
+    if (!model.hasBounds()) {
         scale = 2.5f; // Fallback for debug cube
         return;
     }
 
-    BoundingBox box = GetModelBoundingBox(model);
+    BoundingBox box = model.getBounds();
     float w = box.max.x - box.min.x;
     float h = box.max.y - box.min.y;
     float l = box.max.z - box.min.z;
@@ -0,0 +1,21 @@
+#ifndef TEST_FILES_H
+#define TEST_FILES_H
+
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+// Fichiers temporaires partagés par les tests (inclus depuis tests/*.cpp)
+
+inline void WriteFile(const std::filesystem::path& path, const std::string& content) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out << content;
+}
+
+inline std::string ReadFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+#endif // TEST_FILES_H
@@ -0,0 +1,30 @@
+#ifndef TEST_GEOMETRY_H
+#define TEST_GEOMETRY_H
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "RoadNetwork.h"
+
+// Références géométriques brutes partagées par les tests (inclus depuis tests/*.cpp)
+
+inline float PlanarDistance(Vector3 a, Vector3 b) {
+    return std::sqrt((a.x - b.x) * (a.x - b.x) + (a.z - b.z) * (a.z - b.z));
+}
+
+// Distance (plan XZ) au tracé rendu par la géométrie
+inline float BruteSegmentDistance(const RoadSegment& s, Vector3 p) {
+    auto points = s.GetGeometry()->GetPoints();
+    float best = std::numeric_limits<float>::infinity();
+    for (size_t i = 1; i < points.size(); ++i) {
+        Vector3 a = points[i - 1], b = points[i];
+        float abx = b.x - a.x, abz = b.z - a.z;
+        float lenSq = abx * abx + abz * abz;
+        float u = lenSq > 0.0f ? ((p.x - a.x) * abx + (p.z - a.z) * abz) / lenSq : 0.0f;
+        u = std::max(0.0f, std::min(1.0f, u));
+        best = std::min(best, PlanarDistance(p, {a.x + abx * u, 0.0f, a.z + abz * u}));
+    }
+    return best;
+}
+
+#endif // TEST_GEOMETRY_H
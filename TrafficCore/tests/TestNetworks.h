@@ -0,0 +1,52 @@
+#ifndef TEST_NETWORKS_H
+#define TEST_NETWORKS_H
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+#include "CityGenerator.h"
+#include "RoadNetwork.h"
+#include "RoutingGraph.h"
+
+// Réseaux de test partagés par les tests (inclus depuis tests/*.cpp)
+
+// Grille NxN bidirectionnelle, noeuds espacés de 100 ; la première ligne peut être une avenue
+// plus large (avenueLanes voies)
+inline void BuildGrid(RoadNetwork& network, std::vector<Node*>& nodes, int n, int avenueLanes = 2) {
+    for (int z = 0; z < n; ++z)
+        for (int x = 0; x < n; ++x)
+            nodes.push_back(network.AddNode({x * 100.0f, 0, z * 100.0f}));
+    for (int z = 0; z < n; ++z) {
+        int lanes = (z == 0) ? avenueLanes : 2;
+        for (int x = 0; x < n; ++x) {
+            Node* a = nodes[z * n + x];
+            if (x + 1 < n) { network.AddRoadSegment(a, nodes[z * n + x + 1], lanes, false); network.AddRoadSegment(nodes[z * n + x + 1], a, lanes, false); }
+            if (z + 1 < n) { network.AddRoadSegment(a, nodes[(z + 1) * n + x], 2, false); network.AddRoadSegment(nodes[(z + 1) * n + x], a, 2, false); }
+        }
+    }
+}
+
+// Ville générée (CityGenerator) dans un réseau vide
+inline void BuildCity(RoadNetwork& network, CityParams::Layout layout, int nodes, uint32_t seed) {
+    CityParams p;
+    p.layout = layout;
+    p.nodeCount = nodes;
+    p.seed = seed;
+    CityGenerator::Build(CityGenerator::Generate(p), network);
+}
+
+// Coût d'un itinéraire (segments) : parcours + manoeuvres aux noeuds intermédiaires
+inline float RouteSeconds(const RoutingGraph& graph, const EdgeWeights& weights, const std::vector<int>& route) {
+    float total = 0.0f;
+    for (size_t i = 0; i < route.size(); ++i) {
+        total += weights.seconds[route[i]];
+        if (i > 0) {
+            uint16_t m = graph.GetMovement(graph.ArcOfSegment(route[i - 1]), graph.ArcOfSegment(route[i]));
+            assert(!RoutingGraph::IsForbidden(m));
+            total += RoutingGraph::MovementSeconds(m);
+        }
+    }
+    return total;
+}
+
+#endif // TEST_NETWORKS_H
@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+#include "TestNetworks.h"
+
+void test_nearest_matches_brute_force() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    const int N = 8;
+    BuildGrid(network, nodes, N, 4);
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+
+    std::vector<int> sources = {
+        graph->IndexOf(nodes[0]), graph->IndexOf(nodes[N - 1]),
+        graph->IndexOf(nodes[N * (N - 1)]), graph->IndexOf(nodes[N * N / 2 + 3])
+    };
+
+    for (int t = 0; t < N * N; t += 5) {
+        int target = graph->IndexOf(nodes[t]);
+        auto match = PathFinder::SearchNearestSource(*graph, *weights, sources, target);
+        assert(match.source >= 0);
+
+        // Référence : une recherche A* par unité
+        float best = std::numeric_limits<float>::infinity();
+        for (int s : sources) {
+            if (s == target) { best = 0.0f; break; }
+            auto route = PathFinder::Search(*graph, *weights, s, target);
+            if (!route.empty()) best = std::min(best, RouteSeconds(*graph, *weights, route));
+        }
+        assert(std::fabs(match.seconds - best) < 1e-3f);
+
+        if (match.source != target) {
+            assert(graph->GetSegment(match.route.front())->GetStartNode() == graph->GetNode(match.source));
+            assert(graph->GetSegment(match.route.back())->GetEndNode() == graph->GetNode(target));
+            assert(std::fabs(RouteSeconds(*graph, *weights, match.route) - match.seconds) < 1e-3f);
+        } else {
+            assert(match.route.empty() && match.seconds == 0.0f);
+        }
+    }
+    std::cout << "Nearest unit tests passed!" << std::endl;
+}
+
+void test_travel_time_beats_distance() {
+    // L'unité A est plus proche à vol d'oiseau mais ses routes sont fermées
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 5, 4);
+    Node* target = nodes[12]; // centre
+    Node* unitA = nodes[11];
+    Node* unitB = nodes[4];
+    for (const auto& seg : network.GetRoadSegments()) {
+        if (seg->GetStartNode() == unitA) network.SetSegmentClosed(seg.get(), true);
+    }
+
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+    auto match = PathFinder::SearchNearestSource(*graph, *weights,
+                                                 {graph->IndexOf(unitA), graph->IndexOf(unitB)}, graph->IndexOf(target));
+    assert(match.source == graph->IndexOf(unitB));
+
+    // Personne ne peut partir : aucun résultat
+    match = PathFinder::SearchNearestSource(*graph, *weights, {graph->IndexOf(unitA)}, graph->IndexOf(target));
+    assert(match.source == -1);
+
+    std::cout << "Travel time dispatch tests passed!" << std::endl;
+}
+
+void test_nearest_node_snap() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 4, 4);
+    auto graph = network.GetRoutingGraph();
+    auto index = network.GetSpatialIndex();
+    assert(graph->GetNode(index->NearestNode({210.0f, 0.0f, 95.0f})) == nodes[1 * 4 + 2]);
+    assert(graph->GetNode(index->NearestNode({-50.0f, 0.0f, -50.0f})) == nodes[0]);
+
+    RoadNetwork empty;
+    assert(empty.GetSpatialIndex()->NearestNode({0, 0, 0}) == -1);
+    std::cout << "Nearest node tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running emergency dispatch tests..." << std::endl;
+    test_nearest_matches_brute_force();
+    test_travel_time_beats_distance();
+    test_nearest_node_snap();
+    std::cout << "All emergency dispatch tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+#include "Isochrone.h"
+#include "TestNetworks.h"
+
+void test_unbounded_matches_point_to_point() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 6);
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+    int source = graph->IndexOf(nodes[7]);
+
+    ReachResult all = Isochrone::Compute(*graph, *weights, {source}, std::numeric_limits<float>::max());
+    assert(all.GetReachedNodeCount() == graph->GetNodeCount());
+    assert(all.nodeSeconds[source] == 0.0f);
+
+    // Même temps qu'une recherche source -> cible
+    for (int t = 0; t < graph->GetNodeCount(); ++t) {
+        auto match = PathFinder::SearchNearestSource(*graph, *weights, {source}, t);
+        assert(std::fabs(all.nodeSeconds[t] - match.seconds) < 1e-3f);
+    }
+    std::cout << "Unbounded isochrone tests passed!" << std::endl;
+}
+
+void test_budget_and_partial_segments() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 8);
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+    int source = graph->IndexOf(nodes[0]);
+
+    ReachResult all = Isochrone::Compute(*graph, *weights, {source}, std::numeric_limits<float>::max());
+    float budget = all.nodeSeconds[graph->IndexOf(nodes[3])] + 0.5f * weights->seconds[0];
+    ReachResult bounded = Isochrone::Compute(*graph, *weights, {source}, budget);
+
+    for (int v = 0; v < graph->GetNodeCount(); ++v) {
+        assert(bounded.IsNodeReached(v) == (all.nodeSeconds[v] <= budget));
+        if (bounded.IsNodeReached(v)) assert(bounded.nodeSeconds[v] == all.nodeSeconds[v]);
+    }
+    assert(bounded.GetReachedNodeCount() < all.GetReachedNodeCount());
+
+    // Segments : couverts, entamés (temps exact au-delà du budget) ou non atteints
+    int partial = 0;
+    for (size_t s = 0; s < bounded.segmentSeconds.size(); ++s) {
+        float c = bounded.SegmentCoverage((int)s);
+        if (c > 0.0f && c < 1.0f) {
+            ++partial;
+            assert(bounded.segmentSeconds[s] == all.segmentSeconds[s]);
+        }
+        if (c == 1.0f) assert(bounded.segmentSeconds[s] <= budget);
+    }
+    assert(partial > 0);
+    std::cout << "Bounded isochrone tests passed!" << std::endl;
+}
+
+void test_multi_source() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 6);
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+    int a = graph->IndexOf(nodes[0]);
+    int b = graph->IndexOf(nodes[35]);
+    const float unbounded = std::numeric_limits<float>::max();
+
+    ReachResult fromA = Isochrone::Compute(*graph, *weights, {a}, unbounded);
+    ReachResult fromB = Isochrone::Compute(*graph, *weights, {b}, unbounded);
+    ReachResult both = Isochrone::Compute(*graph, *weights, {a, b}, unbounded);
+    for (int v = 0; v < graph->GetNodeCount(); ++v) {
+        assert(both.nodeSeconds[v] == std::min(fromA.nodeSeconds[v], fromB.nodeSeconds[v]));
+    }
+    std::cout << "Multi-source isochrone tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running isochrone tests..." << std::endl;
+    test_unbounded_matches_point_to_point();
+    test_budget_and_partial_segments();
+    test_multi_source();
+    std::cout << "All isochrone tests passed!" << std::endl;
+    return 0;
+}
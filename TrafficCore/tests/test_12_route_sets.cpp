@@ -0,0 +1,94 @@
+#include <iostream>
+#include <cassert>
+#include <set>
+#include <vector>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+#include "PathService.h"
+#include "RouteSet.h"
+#include "TestNetworks.h"
+
+void test_alternatives() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 6);
+    auto graph = network.GetRoutingGraph();
+    auto weights = network.GetEdgeWeights();
+    int from = graph->IndexOf(nodes[0]);
+    int to = graph->IndexOf(nodes[35]);
+
+    auto set = RouteSet::Build(*graph, *weights, from, to, 4);
+    assert(set->topologyVersion == graph->GetVersion());
+    assert(set->routes.size() >= 2 && set->routes.size() <= 4);
+
+    float best = RouteSet::RouteSeconds(*graph, *weights, PathFinder::Search(*graph, *weights, from, to));
+    assert(RouteSet::RouteSeconds(*graph, *weights, set->routes[0]) == best);
+
+    std::set<std::vector<int>> distinct(set->routes.begin(), set->routes.end());
+    assert(distinct.size() == set->routes.size());
+    for (const auto& route : set->routes) {
+        assert(graph->GetSegment(route.front())->GetStartNode() == nodes[0]);
+        assert(graph->GetSegment(route.back())->GetEndNode() == nodes[35]);
+        assert(RouteSet::RouteSeconds(*graph, *weights, route) <= best * RouteSet::kMaxStretch);
+        // Sans boucle
+        std::set<Node*> visited = {nodes[0]};
+        for (int seg : route) assert(visited.insert(graph->GetSegment(seg)->GetEndNode()).second);
+    }
+    std::cout << "Alternative route tests passed!" << std::endl;
+}
+
+void test_logit_choice() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 6);
+    auto graph = network.GetRoutingGraph();
+    auto set = RouteSet::Build(*graph, *network.GetEdgeWeights(), graph->IndexOf(nodes[0]), graph->IndexOf(nodes[35]), 4);
+    assert(set->routes.size() >= 2);
+
+    // Plusieurs itinéraires tirés : le trafic se répartit
+    std::mt19937 rng;
+    std::vector<int> counts(set->routes.size(), 0);
+    for (int i = 0; i < 400; ++i) counts[set->Choose(*graph, *network.GetEdgeWeights(), rng)]++;
+    int used = 0;
+    for (int c : counts) used += (c > 0);
+    assert(used >= 2);
+
+    // Même graine, mêmes tirages
+    std::mt19937 a, b;
+    for (int i = 0; i < 20; ++i) {
+        assert(set->Choose(*graph, *network.GetEdgeWeights(), a) == set->Choose(*graph, *network.GetEdgeWeights(), b));
+    }
+
+    // Un segment du premier itinéraire ferme : il n'est plus jamais tiré
+    network.SetSegmentClosed(graph->GetSegment(set->routes[0][1]), true);
+    for (int i = 0; i < 100; ++i) {
+        int choice = set->Choose(*graph, *network.GetEdgeWeights(), rng);
+        assert(choice != 0);
+    }
+    std::cout << "Logit choice tests passed!" << std::endl;
+}
+
+void test_async_route_set() {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    BuildGrid(network, nodes, 5);
+    PathService service(2);
+
+    RouteSetTicket ticket = service.RequestRouteSet(network, nodes[0], nodes[24], 3);
+    auto set = ticket.get();
+    assert(set && !set->routes.empty() && set->routes.size() <= 3);
+    assert(set->topologyVersion == network.GetTopologyVersion());
+
+    RouteSetTicket invalid = service.RequestRouteSet(network, nodes[3], nodes[3], 3);
+    assert(PathService::IsReady(invalid) && invalid.get() == nullptr);
+    std::cout << "Async route set tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running route set tests..." << std::endl;
+    test_alternatives();
+    test_logit_choice();
+    test_async_route_set();
+    std::cout << "All route set tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <limits>
+#include <string>
+#include "core/JsonReader.h"
+#include "core/MappedFile.h"
+#include "MapLoader.h"
+
+void test_values() {
+    JsonReader r(R"( { "a": 12, "b": -3.5e2, "s": "x\"y", "t": true, "n": null,
+                       "arr": [1, [2, {"deep": [3]}], "z"], "last": 7 } )");
+    int a = 0, last = 0;
+    double b = 0.0;
+    bool t = false;
+    std::string_view s, key;
+    assert(r.BeginObject());
+    while (r.NextMember(key)) {
+        if (key == "a") assert(r.ReadInt(a));
+        else if (key == "b") assert(r.ReadNumber(b));
+        else if (key == "s") assert(r.ReadString(s));
+        else if (key == "t") assert(r.ReadBool(t));
+        else if (key == "n") assert(r.ReadNull());
+        else if (key == "last") assert(r.ReadInt(last));
+        else assert(r.Skip());
+    }
+    assert(r.Finish());
+    assert(a == 12 && b == -350.0 && t && last == 7);
+    assert(s == "x\\\"y"); // brut, dans le texte source
+    assert(JsonReader::Unescape(s) == "x\"y");
+    assert(JsonReader::Unescape("caf\\u00e9\\n") == "caf\xC3\xA9\n");
+
+    // Entier écrit en décimal : tronqué
+    JsonReader d("[3.0, 1e3]");
+    int x = 0, y = 0;
+    assert(d.BeginArray() && d.NextElement() && d.ReadInt(x) && d.NextElement() && d.ReadInt(y));
+    assert(!d.NextElement() && d.Finish());
+    assert(x == 3 && y == 1000);
+
+    std::cout << "JSON value tests passed!" << std::endl;
+}
+
+void test_error_positions() {
+    // Virgule manquante ligne 3
+    JsonReader r("{\n  \"a\": 1,\n  \"b\": 2\n  \"c\": 3\n}");
+    std::string_view key;
+    int v;
+    assert(r.BeginObject());
+    while (r.NextMember(key)) r.ReadInt(v);
+    assert(r.HasError());
+    assert(r.GetError().find("ligne 4, colonne 3") == 0);
+
+    // Type inattendu
+    JsonReader t("{\"id\": \"abc\"}");
+    assert(t.BeginObject() && t.NextMember(key));
+    assert(!t.ReadInt(v));
+    assert(t.GetError().find("colonne 8") != std::string::npos);
+
+    // Chaîne non terminée, contenu après la racine
+    JsonReader u("[\"abc");
+    assert(u.BeginArray() && u.NextElement() && !u.Skip());
+    JsonReader w("{} x");
+    assert(w.Skip() && !w.Finish());
+
+    std::cout << "JSON error tests passed!" << std::endl;
+}
+
+void test_mapped_file_and_loader() {
+    const char* path = "test_json_reader.json";
+    {
+        std::ofstream out(path);
+        out << "{ \"topology\": { \"routes\": [ {\"from\": 2, \"to\": 1, \"visible\": \"false\"} ],\n"
+               "  \"nodes\": [ {\"id\": 1, \"position\": [0, 0]}, {\"id\": 2, \"position\": [50, 0], \"type\": \"roundabout\"} ] },\n"
+               "  \"vehicle_types\": { \"BUS\": { \"max_speed\": 40.0, \"color\": \"#3366CC\" } } }";
+    }
+    MappedFile file(path);
+    assert(file.IsOpen() && file.Size() > 0 && file.View().front() == '{');
+
+    // Routes déclarées avant les noeuds : résolues à la fin de la topologie
+    RoadNetwork network;
+    assert(MapLoader::LoadFromFile(path, network));
+    assert(network.GetNodeCount() == 2 && network.GetRoadSegmentCount() == 1);
+    assert(network.FindNodeById(2)->GetType() == ROUNDABOUT);
+    assert(!network.GetRoadSegments()[0]->IsVisible());
+    file.Close();
+    std::remove(path);
+
+    MappedFile missing;
+    assert(!missing.Open("does_not_exist.json") && !missing.GetError().empty());
+
+    RoadNetwork broken;
+    std::string error;
+    assert(!MapLoader::LoadFromMemory("{ \"topology\": { \"nodes\": [ {\"id\": } ] } }", broken, &error));
+    assert(error.find("ligne 1") == 0);
+
+    std::cout << "Mapped loader tests passed!" << std::endl;
+}
+
+// Id au-delà de RoadNetwork::kMaxNodeId : noeud ignoré, au chargement comme au rechargement
+void test_out_of_range_node_id() {
+    const char* json = "{ \"topology\": { \"nodes\": [ {\"id\": 2147483647, \"position\": [0, 0]},\n"
+                       "  {\"position\": [50, 0]} ] } }";
+    RoadNetwork network;
+    assert(MapLoader::LoadFromMemory(json, network));
+    assert(network.GetNodeCount() == 1 && network.FindNodeById(1));
+    assert(!network.FindNodeById(std::numeric_limits<int>::max()));
+
+    MapLoader::ReloadStats stats;
+    assert(MapLoader::ReloadFromMemory(json, network, &stats));
+    assert(stats.nodesAdded == 0 && stats.nodesRemoved == 0 && network.GetNodeCount() == 1);
+
+    std::cout << "Out of range node id tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running JSON reader tests..." << std::endl;
+    test_values();
+    test_error_positions();
+    test_mapped_file_and_loader();
+    test_out_of_range_node_id();
+    std::cout << "All JSON reader tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+#include "RoadNetwork.h"
+#include "MapBinary.h"
+#include "MapLoader.h"
+#include "PathFinder.h"
+
+// Anneau de 4 carrefours autour d'un rond-point central, routes courbes vers le rond-point
+static void BuildRoundaboutRing(RoadNetwork& network) {
+    Node* center = network.AddNodeWithId(10, {0, 0.2f, 0}, ROUNDABOUT, 40.0f);
+    Node* arms[4];
+    const Vector3 dirs[4] = {{300, 0.2f, 0}, {0, 0.2f, 300}, {-300, 0.2f, 0}, {0, 0.2f, -300}};
+    for (int i = 0; i < 4; ++i) {
+        arms[i] = network.AddNodeWithId(20 + i, dirs[i], i % 2 ? TRAFFIC_LIGHT : SIMPLE_INTERSECTION, 10.0f);
+        network.AddRoadSegment(arms[i], center, 2, true);
+        network.AddRoadSegment(center, arms[i], 2, true);
+    }
+    for (int i = 0; i < 4; ++i) {
+        network.AddRoadSegment(arms[i], arms[(i + 1) % 4], 4, false);
+    }
+    network.GetRoadSegments().back()->SetVisible(false);
+    network.AddTurnRestriction(20, 10, 21);
+    network.SetUTurnsAllowed(true);
+}
+
+void test_round_trip() {
+    RoadNetwork source;
+    BuildRoundaboutRing(source);
+    std::string bytes = MapBinary::Serialize(source);
+    assert(MapBinary::IsBinary(bytes));
+
+    RoadNetwork loaded;
+    std::string error;
+    assert(MapBinary::Load(bytes, loaded, &error));
+    assert(loaded.GetNodeCount() == source.GetNodeCount());
+    assert(loaded.GetRoadSegmentCount() == source.GetRoadSegmentCount());
+    assert(loaded.AreUTurnsAllowed());
+    assert(loaded.GetTurnRestrictions().size() == 1);
+
+    for (int i = 0; i < source.GetNodeCount(); ++i) {
+        const Node& a = *source.GetNodes()[i];
+        const Node& b = *loaded.GetNodes()[i];
+        assert(a.GetId() == b.GetId() && a.GetType() == b.GetType() && a.GetRadius() == b.GetRadius());
+        assert(loaded.FindNodeById(a.GetId()) == &b);
+    }
+
+    // Géométrie figée : mêmes points de contrôle, même longueur, mêmes trottoirs
+    for (int i = 0; i < source.GetRoadSegmentCount(); ++i) {
+        const RoadSegment& a = *source.GetRoadSegments()[i];
+        const RoadSegment& b = *loaded.GetRoadSegments()[i];
+        assert(b.GetStartNode()->GetId() == a.GetStartNode()->GetId());
+        assert(b.GetEndNode()->GetId() == a.GetEndNode()->GetId());
+        assert(a.GetLanes() == b.GetLanes() && a.IsVisible() == b.IsVisible());
+        assert(a.GetControlPointCount() == b.GetControlPointCount());
+        assert(a.GetLength() == b.GetLength());
+        assert(a.GetSidewalks().size() == b.GetSidewalks().size());
+        for (size_t k = 0; k < a.GetSidewalks().size(); ++k) {
+            assert(a.GetSidewalks()[k].path.size() == b.GetSidewalks()[k].path.size());
+        }
+    }
+    assert(source.GetRoadSegments()[0]->GetControlPointCount() == 4);  // courbe vers le rond-point
+    assert(source.GetRoadSegments()[8]->GetControlPointCount() == 2);  // tronçon droit
+    assert(!loaded.GetRoadSegments()[11]->IsVisible());
+
+    std::cout << "Binary round trip tests passed!" << std::endl;
+}
+
+void test_adopted_graph() {
+    RoadNetwork source;
+    BuildRoundaboutRing(source);
+    RoadNetwork loaded;
+    assert(MapBinary::Load(MapBinary::Serialize(source), loaded));
+
+    // Graphe relu tel quel : identique au graphe reconstruit, manoeuvre interdite comprise
+    auto a = source.GetRoutingGraph();
+    auto b = loaded.GetRoutingGraph();
+    assert(b->GetVersion() == loaded.GetTopologyVersion());
+    assert(a->GetEdgeCount() == b->GetEdgeCount() && a->GetMovementCount() == b->GetMovementCount());
+    for (int e = 0; e < a->GetEdgeCount(); ++e) {
+        assert(a->EdgeSegment(e) == b->EdgeSegment(e) && a->EdgeTarget(e) == b->EdgeTarget(e));
+        int v = a->EdgeTarget(e);
+        for (int f = a->EdgeBegin(v); f < a->EdgeEnd(v); ++f) {
+            assert(a->GetMovement(e, f) == b->GetMovement(e, f));
+        }
+    }
+
+    PathFinder pfa(&source);
+    PathFinder pfb(&loaded);
+    for (int from = 20; from < 24; ++from) {
+        for (int to = 20; to < 24; ++to) {
+            auto ra = pfa.FindRoute(source.FindNodeById(from), source.FindNodeById(to));
+            auto rb = pfb.FindRoute(loaded.FindNodeById(from), loaded.FindNodeById(to));
+            assert(ra.size() == rb.size());
+            for (size_t i = 0; i < ra.size(); ++i) assert(ra[i]->GetIndex() == rb[i]->GetIndex());
+        }
+    }
+
+    std::cout << "Adopted routing graph tests passed!" << std::endl;
+}
+
+void test_file_and_rejects() {
+    RoadNetwork source;
+    BuildRoundaboutRing(source);
+    const char* path = "test_binary_map.scmap";
+    assert(MapBinary::Write(source, path));
+    RoadNetwork loaded;
+    assert(MapLoader::LoadFromFile(path, loaded)); // détection par signature
+    std::remove(path);
+    assert(loaded.GetRoadSegmentCount() == source.GetRoadSegmentCount());
+
+    std::string bytes = MapBinary::Serialize(source);
+    std::string error;
+
+    // Fichier tronqué
+    RoadNetwork truncated;
+    assert(!MapBinary::Load(std::string_view(bytes).substr(0, bytes.size() / 2), truncated, &error));
+    assert(!error.empty());
+
+    // Version inconnue : refus explicite plutôt qu'une lecture décalée
+    std::string future = bytes;
+    future[8] = static_cast<char>(MapBinary::kVersion + 1);
+    RoadNetwork stale;
+    assert(!MapBinary::Load(future, stale, &error));
+    assert(error.find("version") != std::string::npos);
+
+    // Réseau de destination non vide
+    assert(!MapBinary::Load(bytes, loaded, &error));
+
+    std::cout << "Binary file tests passed!" << std::endl;
+}
+
+// Ids au-delà de RoadNetwork::kMaxNodeId refusés : nextNodeId = id + 1 déborderait
+void test_node_id_limit() {
+    const int limit = std::numeric_limits<int>::max();
+    RoadNetwork network;
+    assert(!network.AddNodeWithId(limit, {0, 0.2f, 0}));
+    Node* last = network.AddNodeWithId(RoadNetwork::kMaxNodeId, {100, 0.2f, 0});
+    assert(last && last->GetId() == RoadNetwork::kMaxNodeId);
+    assert(!network.AddNode({200, 0.2f, 0})); // plus d'id automatique disponible
+    assert(network.GetNodeCount() == 1);
+
+    // Carte compilée dont un id a été remplacé par INT_MAX : chargement refusé
+    RoadNetwork source;
+    const int marker = 0x5A5A5A5A;
+    source.AddRoadSegment(source.AddNodeWithId(1, {0, 0.2f, 0}), source.AddNodeWithId(marker, {300, 0.2f, 0}), 2, false);
+    std::string bytes = MapBinary::Serialize(source);
+    char markerBytes[sizeof(int)], limitBytes[sizeof(int)];
+    std::memcpy(markerBytes, &marker, sizeof(int));
+    std::memcpy(limitBytes, &limit, sizeof(int));
+    size_t at = bytes.find(std::string(markerBytes, sizeof(int)));
+    assert(at != std::string::npos);
+    bytes.replace(at, sizeof(int), limitBytes, sizeof(int));
+
+    RoadNetwork loaded;
+    std::string error;
+    assert(!MapBinary::Load(bytes, loaded, &error));
+    assert(error.find("hors limites") != std::string::npos);
+
+    std::cout << "Node id limit tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running binary map tests..." << std::endl;
+    test_round_trip();
+    test_adopted_graph();
+    test_file_and_rejects();
+    test_node_id_limit();
+    std::cout << "All binary map tests passed!" << std::endl;
+    return 0;
+}
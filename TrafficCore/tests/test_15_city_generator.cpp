@@ -0,0 +1,117 @@
+#include <iostream>
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include "CityGenerator.h"
+#include "MapBinary.h"
+#include "MapLoader.h"
+#include "PathFinder.h"
+#include "RoadNetwork.h"
+
+static CityParams Params(CityParams::Layout layout, int nodes, uint32_t seed = 7) {
+    CityParams p;
+    p.layout = layout;
+    p.nodeCount = nodes;
+    p.seed = seed;
+    return p;
+}
+
+static bool SamePlan(const CityPlan& a, const CityPlan& b) {
+    if (a.nodes.size() != b.nodes.size() || a.roads.size() != b.roads.size()) return false;
+    for (size_t i = 0; i < a.nodes.size(); ++i) {
+        if (a.nodes[i].x != b.nodes[i].x || a.nodes[i].z != b.nodes[i].z || a.nodes[i].type != b.nodes[i].type) return false;
+    }
+    for (size_t i = 0; i < a.roads.size(); ++i) {
+        if (a.roads[i].from != b.roads[i].from || a.roads[i].to != b.roads[i].to || a.roads[i].lanes != b.roads[i].lanes) return false;
+    }
+    return a.spawnNodeIds == b.spawnNodeIds;
+}
+
+void test_layouts() {
+    const CityParams::Layout layouts[3] = {CityParams::Layout::Grid, CityParams::Layout::Radial,
+                                           CityParams::Layout::RandomPlanar};
+    for (auto layout : layouts) {
+        CityPlan plan = CityGenerator::Generate(Params(layout, 900));
+        // Taille proche de la cible, les trois types de carrefour et les deux gabarits de rue
+        assert(std::abs(static_cast<int>(plan.nodes.size()) - 900) <= 45);
+        assert(plan.CountNodes(ROUNDABOUT) > 0 && plan.CountNodes(TRAFFIC_LIGHT) > 0);
+        assert(plan.CountNodes(SIMPLE_INTERSECTION) > 0);
+        bool twoLanes = false, fourLanes = false;
+        for (const auto& r : plan.roads) {
+            twoLanes |= r.lanes == 2;
+            fourLanes |= r.lanes == 4;
+        }
+        assert(twoLanes && fourLanes);
+        assert(plan.spawnNodeIds.size() >= 6);
+
+        // Déterministe pour une graine donnée
+        assert(SamePlan(plan, CityGenerator::Generate(Params(layout, 900))));
+    }
+    assert(!SamePlan(CityGenerator::Generate(Params(CityParams::Layout::RandomPlanar, 900, 1)),
+                     CityGenerator::Generate(Params(CityParams::Layout::RandomPlanar, 900, 2))));
+    std::cout << "Layout tests passed!" << std::endl;
+}
+
+void test_connected_network() {
+    const CityParams::Layout layouts[3] = {CityParams::Layout::Grid, CityParams::Layout::Radial,
+                                           CityParams::Layout::RandomPlanar};
+    for (auto layout : layouts) {
+        CityPlan plan = CityGenerator::Generate(Params(layout, 400));
+        RoadNetwork network;
+        assert(CityGenerator::Build(plan, network));
+        assert(network.GetNodeCount() == static_cast<int>(plan.nodes.size()));
+        assert(network.GetRoadSegmentCount() == static_cast<int>(plan.roads.size()));
+        assert(network.GetSpawnNodeIds() == plan.spawnNodeIds);
+
+        // Tous les noeuds de flux communiquent entre eux
+        PathFinder pf(&network);
+        for (int from : plan.spawnNodeIds) {
+            for (int to : plan.spawnNodeIds) {
+                if (from == to) continue;
+                auto route = pf.FindRoute(network.FindNodeById(from), network.FindNodeById(to));
+                assert(!route.empty());
+            }
+        }
+    }
+    std::cout << "Connected network tests passed!" << std::endl;
+}
+
+void test_json_output() {
+    CityPlan plan = CityGenerator::Generate(Params(CityParams::Layout::Radial, 200));
+    const char* path = "test_city.json";
+    assert(CityGenerator::WriteJson(plan, path));
+    RoadNetwork network;
+    assert(MapLoader::LoadFromFile(path, network));
+    std::remove(path);
+
+    assert(network.GetNodeCount() == static_cast<int>(plan.nodes.size()));
+    assert(network.GetRoadSegmentCount() == static_cast<int>(plan.roads.size()));
+    for (const auto& n : plan.nodes) {
+        Node* loaded = network.FindNodeById(n.id);
+        assert(loaded && loaded->GetType() == n.type && loaded->GetRadius() == n.radius);
+    }
+    // Noeuds de flux relus depuis scenario.spawn_points, puis conservés par la carte compilée
+    assert(!plan.spawnNodeIds.empty() && network.GetSpawnNodeIds() == plan.spawnNodeIds);
+    RoadNetwork compiled;
+    assert(MapBinary::Load(MapBinary::Serialize(network), compiled));
+    assert(compiled.GetSpawnNodeIds() == plan.spawnNodeIds);
+    std::cout << "JSON output tests passed!" << std::endl;
+}
+
+void test_large_plan() {
+    // Plan seul (sans géométrie) : 250 000 noeuds
+    CityPlan plan = CityGenerator::Generate(Params(CityParams::Layout::Grid, 250000));
+    assert(plan.nodes.size() == 500 * 500);
+    assert(plan.roads.size() == 2 * 2 * 500 * 499);
+    std::cout << "Large plan tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running city generator tests..." << std::endl;
+    test_layouts();
+    test_connected_network();
+    test_json_output();
+    test_large_plan();
+    std::cout << "All city generator tests passed!" << std::endl;
+    return 0;
+}
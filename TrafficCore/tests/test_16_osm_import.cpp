@@ -0,0 +1,150 @@
+#include <iostream>
+#include <cassert>
+#include <string>
+#include "core/XmlReader.h"
+#include "OsmImporter.h"
+#include "PathFinder.h"
+#include "RoadNetwork.h"
+
+// Carrefour à feux C (le feu est posé 5 m avant, sur la branche nord), une bretelle à 8 m de C
+// (fusionnée), un rond-point au sud, un sens unique, un chemin piéton et une référence hors extrait
+static const char* kExtract = R"(<?xml version="1.0" encoding="UTF-8"?>
+<osm version="0.6" generator="test">
+  <!-- emprise <bounds> ignoree -->
+  <bounds minlat="47.99" minlon="1.99" maxlat="48.01" maxlon="2.01"/>
+  <node id="1" lat="48.0" lon="1.997"/>
+  <node id="2" lat="48.0" lon="2.003"/>
+  <node id="100" lat="48.0" lon="2.0"/>
+  <node id="101" lat="48.00005" lon="2.0"><tag k="highway" v="traffic_signals"/></node>
+  <node id="102" lat="48.0015" lon="2.0"/>
+  <node id="3" lat="48.003" lon="2.0"/>
+  <node id="4" lat="48.003" lon="2.002"/>
+  <node id="110" lat="48.0" lon="2.000107"/>
+  <node id="7" lat="47.999" lon="2.0015"/>
+  <node id="6" lat="48.001" lon="1.999"/>
+  <node id="200" lat="47.99715" lon="2.0"/>
+  <node id="201" lat="47.997" lon="2.000224"/>
+  <node id="202" lat="47.99685" lon="2.0"/>
+  <node id="203" lat="47.997" lon="1.999776"/>
+  <node id="5" lat="47.994" lon="2.0"/>
+  <way id="10"><nd ref="1"/><nd ref="100"/><nd ref="2"/>
+    <tag k="highway" v="primary"/><tag k="lanes" v="4"/><tag k="name" v="Rue &quot;Principale&quot; &gt; A"/></way>
+  <way id="11"><nd ref="100"/><nd ref="101"/><nd ref="102"/><nd ref="3"/><tag k="highway" v="residential"/></way>
+  <way id="12"><nd ref="3"/><nd ref="4"/><tag k="highway" v="residential"/><tag k='oneway' v='yes'/></way>
+  <way id="13"><nd ref="100"/><nd ref="200"/><tag k="highway" v="secondary"/></way>
+  <way id="14"><nd ref="200"/><nd ref="201"/><nd ref="202"/><nd ref="203"/><nd ref="200"/>
+    <tag k="highway" v="secondary"/><tag k="junction" v="roundabout"/></way>
+  <way id="15"><nd ref="202"/><nd ref="5"/><tag k="highway" v="tertiary"/></way>
+  <way id="16"><nd ref="110"/><nd ref="7"/><tag k="highway" v="residential"/></way>
+  <way id="17"><nd ref="100"/><nd ref="6"/><tag k="highway" v="footway"/></way>
+  <way id="18"><nd ref="7"/><nd ref="999"/><tag k="highway" v="residential"/></way>
+  <relation id="50"><member type="way" ref="10" role=""/><tag k="type" v="route"/></relation>
+</osm>
+)";
+
+void test_xml_reader() {
+    XmlReader r("<?xml version='1.0'?><!-- c --><a x=\"1 > 0\" y='2'><b/>texte<c k=\"v\"></c></a>");
+    std::string_view v;
+    assert(r.Next() == XmlEvent::StartElement && r.Name() == "a" && !r.IsSelfClosing());
+    assert(r.Attribute("x", v) && v == "1 > 0");
+    assert(r.Attribute("y", v) && v == "2");
+    assert(!r.Attribute("z", v));
+    assert(r.Next() == XmlEvent::StartElement && r.Name() == "b" && r.IsSelfClosing());
+    assert(r.Next() == XmlEvent::StartElement && r.Name() == "c" && r.Attribute("k", v) && v == "v");
+    assert(r.Next() == XmlEvent::EndElement && r.Name() == "c");
+    assert(r.Next() == XmlEvent::EndElement && r.Name() == "a");
+    assert(r.Next() == XmlEvent::End);
+
+    XmlReader bad("<a><b x=\"1\"");
+    assert(bad.Next() == XmlEvent::StartElement);
+    assert(bad.Next() == XmlEvent::Invalid && bad.HasError());
+    assert(bad.GetError().find("ligne 1") == 0);
+    std::cout << "XmlReader tests passed!" << std::endl;
+}
+
+void test_import() {
+    RoadNetwork network;
+    OsmImportStats stats;
+    std::string error;
+    assert(OsmImporter::ImportMemory(kExtract, network, OsmImportOptions(), &stats, &error));
+    assert(stats.osmNodes == 15 && stats.osmWays == 9);
+    assert(stats.drivableWays == 8); // chemin piéton écarté
+    assert(stats.roundabouts == 1 && stats.trafficLights == 1);
+
+    // W, C (+ bretelle fusionnée), E, N, NE, rond-point, S, noeud 7
+    assert(network.GetNodeCount() == 8);
+    // Double sens : 6 rues x 2 (retour invisible) + 1 sens unique
+    assert(network.GetRoadSegmentCount() == 13);
+    int invisible = 0, wide = 0;
+    for (const auto& s : network.GetRoadSegments()) {
+        if (!s->IsVisible()) ++invisible;
+        if (s->GetLanes() == 4) ++wide;
+    }
+    assert(invisible == 6);
+    assert(wide == 4); // lanes=4 en double sens : 2 voies par sens
+
+    Node* crossing = nullptr;
+    Node* roundabout = nullptr;
+    for (const auto& n : network.GetNodes()) {
+        if (n->GetType() == TRAFFIC_LIGHT) crossing = n.get();
+        if (n->GetType() == ROUNDABOUT) roundabout = n.get();
+    }
+    assert(crossing && roundabout);
+    assert(crossing->GetConnectedRoads().size() == 10);
+    assert(roundabout->GetRadius() > 50.0f && roundabout->GetRadius() < 100.0f); // ~17 m x 4,5
+
+    // Le carrefour à feux rejoint le sud en traversant le rond-point
+    PathFinder pf(&network);
+    Node* south = nullptr;
+    for (const auto& n : network.GetNodes()) {
+        if (!south || n->GetPosition().z > south->GetPosition().z) south = n.get();
+    }
+    auto route = pf.FindRoute(crossing, south);
+    assert(route.size() == 2 && route.front()->GetEndNode() == roundabout);
+
+    std::cout << "OSM import tests passed!" << std::endl;
+}
+
+// Feu sur le dernier noeud référencé du fichier : ses tags viennent après que tous les noeuds sont trouvés
+static const char* kLastSignal = R"(<osm version="0.6">
+  <node id="1" lat="48.0" lon="1.998"/>
+  <node id="2" lat="48.0" lon="2.002"/>
+  <node id="4" lat="48.002" lon="2.0"/>
+  <node id="3" lat="48.0" lon="2.0"><tag k="highway" v="traffic_signals"/></node>
+  <way id="10"><nd ref="1"/><nd ref="3"/><nd ref="2"/><tag k="highway" v="residential"/></way>
+  <way id="11"><nd ref="3"/><nd ref="4"/><tag k="highway" v="residential"/></way>
+</osm>
+)";
+
+void test_last_node_signal() {
+    RoadNetwork network;
+    OsmImportStats stats;
+    assert(OsmImporter::ImportMemory(kLastSignal, network, OsmImportOptions(), &stats, nullptr));
+    assert(stats.trafficLights == 1 && network.GetNodeCount() == 4);
+    int lights = 0;
+    for (const auto& n : network.GetNodes()) {
+        if (n->GetType() == TRAFFIC_LIGHT) ++lights;
+    }
+    assert(lights == 1);
+    std::cout << "Last node signal tests passed!" << std::endl;
+}
+
+void test_rejects() {
+    RoadNetwork network;
+    std::string error;
+    assert(!OsmImporter::ImportFile("ville.osm.pbf", network, OsmImportOptions(), nullptr, &error));
+    assert(error.find("pbf") != std::string::npos);
+    assert(!OsmImporter::ImportMemory("<osm><way id=\"1\"><nd ref=\"2\"", network, OsmImportOptions(), nullptr, &error));
+    assert(!error.empty());
+    std::cout << "OSM reject tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running OSM import tests..." << std::endl;
+    test_xml_reader();
+    test_import();
+    test_last_node_signal();
+    test_rejects();
+    std::cout << "All OSM import tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,144 @@
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "CityGenerator.h"
+#include "MapBinary.h"
+#include "RoadNetwork.h"
+#include "SpatialIndex.h"
+#include "TestGeometry.h"
+#include "TestNetworks.h"
+
+static std::vector<Vector3> QueryPoints(int count) {
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coord(-2000.0f, 12000.0f);
+    std::vector<Vector3> points;
+    for (int i = 0; i < count; ++i) points.push_back({coord(rng), 0.0f, coord(rng)});
+    return points;
+}
+
+void test_nearest_matches_brute_force() {
+    const CityParams::Layout layouts[2] = {CityParams::Layout::Grid, CityParams::Layout::RandomPlanar};
+    for (auto layout : layouts) {
+        RoadNetwork network;
+        BuildCity(network, layout, 600, 11);
+        auto index = network.GetSpatialIndex();
+        assert(index->GetNodeCount() == network.GetNodeCount());
+
+        for (Vector3 q : QueryPoints(200)) {
+            float bruteNode = std::numeric_limits<float>::infinity();
+            for (const auto& n : network.GetNodes()) bruteNode = std::min(bruteNode, PlanarDistance(q, n->GetPosition()));
+            int found = index->NearestNode(q);
+            assert(found >= 0);
+            assert(PlanarDistance(q, network.GetNodes()[found]->GetPosition()) == bruteNode);
+
+            float bruteSegment = std::numeric_limits<float>::infinity();
+            for (const auto& s : network.GetRoadSegments()) bruteSegment = std::min(bruteSegment, BruteSegmentDistance(*s, q));
+            SegmentMatch match = index->NearestSegment(q);
+            assert(match.segment >= 0);
+            assert(std::fabs(match.distance - bruteSegment) < 0.5f);
+            assert(std::fabs(PlanarDistance(q, match.position) - match.distance) < 0.01f);
+            assert(match.t >= 0.0f && match.t <= 1.0f);
+        }
+    }
+    std::cout << "Nearest node/segment tests passed!" << std::endl;
+}
+
+void test_range_queries() {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Radial, 500, 11);
+    auto index = network.GetSpatialIndex();
+    std::vector<int> found;
+    for (Vector3 q : QueryPoints(50)) {
+        const float radius = 900.0f;
+        index->QueryNodes(q, radius, found);
+        std::sort(found.begin(), found.end());
+        std::vector<int> expected;
+        for (int i = 0; i < network.GetNodeCount(); ++i) {
+            if (PlanarDistance(q, network.GetNodes()[i]->GetPosition()) <= radius) expected.push_back(i);
+        }
+        assert(found == expected);
+
+        index->QuerySegments(q, radius, found);
+        for (const auto& s : network.GetRoadSegments()) {
+            float d = BruteSegmentDistance(*s, q);
+            bool listed = std::binary_search(found.begin(), found.end(), s->GetIndex());
+            if (d < radius - 0.5f) assert(listed);
+            if (d > radius + 0.5f) assert(!listed);
+        }
+    }
+    std::cout << "Range query tests passed!" << std::endl;
+}
+
+void test_lane_and_direction() {
+    // Rue à double sens : aller visible, retour invisible sur le même tracé
+    RoadNetwork network;
+    Node* a = network.AddNode({0.0f, 0.0f, 0.0f});
+    Node* b = network.AddNode({400.0f, 0.0f, 0.0f});
+    RoadSegment* forward = network.AddRoadSegment(a, b, 2, false);
+    RoadSegment* back = network.AddRoadSegment(b, a, 2, false);
+    back->SetVisible(false);
+    Node* c = network.AddNode({400.0f, 0.0f, 400.0f});
+    RoadSegment* wide = network.AddRoadSegment(b, c, 4, false);
+    auto index = network.GetSpatialIndex();
+
+    SegmentMatch m = index->NearestSegment(forward->GetTrafficLanePosition(0, 0.25f));
+    assert(m.segment == forward->GetIndex() && m.lane == 0);
+    assert(std::fabs(m.t - 0.25f) < 0.01f);
+    // Voie retour de l'aller = voie aller du retour
+    m = index->NearestSegment(forward->GetTrafficLanePosition(1, 0.25f));
+    assert(m.segment == back->GetIndex() && m.lane == 0);
+    assert(std::fabs(m.t - 0.75f) < 0.01f);
+
+    for (int lane = 0; lane < 4; ++lane) {
+        m = index->NearestSegment(wide->GetTrafficLanePosition(lane, 0.5f));
+        assert(m.segment == wide->GetIndex() && m.lane == lane);
+    }
+
+    // Hors de portée, réseau vide
+    assert(index->NearestSegment({200.0f, 0.0f, -300.0f}, 100.0f).segment == -1);
+    assert(index->NearestSegment({200.0f, 0.0f, -300.0f}).segment >= 0);
+    RoadNetwork empty;
+    assert(empty.GetSpatialIndex()->NearestSegment({0, 0, 0}).segment == -1);
+    std::vector<int> found;
+    empty.GetSpatialIndex()->QueryNodes({0, 0, 0}, 10.0f, found);
+    assert(found.empty());
+
+    // Topologie modifiée : nouvel index
+    network.AddNode({-500.0f, 0.0f, 0.0f});
+    assert(network.GetSpatialIndex() != index);
+    assert(network.GetSpatialIndex()->NearestNode({-480.0f, 0.0f, 0.0f}) == 3);
+    std::cout << "Lane matching tests passed!" << std::endl;
+}
+
+void test_compiled_map_index() {
+    RoadNetwork source;
+    BuildCity(source, CityParams::Layout::RandomPlanar, 400, 11);
+    RoadNetwork loaded;
+    std::string error;
+    assert(MapBinary::Load(MapBinary::Serialize(source), loaded, &error));
+
+    auto built = source.GetSpatialIndex();
+    auto adopted = loaded.GetSpatialIndex();
+    assert(adopted->GetPieceCount() == built->GetPieceCount());
+    for (Vector3 q : QueryPoints(100)) {
+        assert(adopted->NearestNode(q) == built->NearestNode(q));
+        SegmentMatch x = built->NearestSegment(q);
+        SegmentMatch y = adopted->NearestSegment(q);
+        assert(x.segment == y.segment && x.lane == y.lane && x.t == y.t);
+    }
+    std::cout << "Compiled map index tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running spatial index tests..." << std::endl;
+    test_nearest_matches_brute_force();
+    test_range_queries();
+    test_lane_and_direction();
+    test_compiled_map_index();
+    std::cout << "All spatial index tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include "CityGenerator.h"
+#include "NetworkPartition.h"
+#include "PathFinder.h"
+#include "RoadNetwork.h"
+#include "TestNetworks.h"
+#include "Vehicules/TrafficManager.h"
+#include "Vehicules/VehiculeFactory.h"
+
+void test_partition() {
+    const CityParams::Layout layouts[2] = {CityParams::Layout::Grid, CityParams::Layout::RandomPlanar};
+    for (auto layout : layouts) {
+        RoadNetwork network;
+        BuildCity(network, layout, 1600, 3);
+        auto partition = NetworkPartition::Build(network, 8, network.GetTopologyVersion());
+        assert(partition->GetRegionCount() == 8);
+
+        // Couverture complète, poids équilibrés
+        size_t nodes = 0, segments = 0;
+        float total = 0.0f;
+        for (int r = 0; r < 8; ++r) {
+            nodes += partition->GetRegionNodes(r).size();
+            segments += partition->GetRegionSegments(r).size();
+            total += partition->GetRegionWeight(r);
+        }
+        assert(nodes == static_cast<size_t>(network.GetNodeCount()));
+        assert(segments == static_cast<size_t>(network.GetRoadSegmentCount()));
+        for (int r = 0; r < 8; ++r) {
+            assert(partition->GetRegionWeight(r) <= total / 8 * 1.25f);
+            assert(partition->GetRegionWeight(r) >= total / 8 * 0.75f);
+        }
+
+        // Régions compactes : peu de segments coupés, chacun porté par une frontière déclarée
+        int cut = 0;
+        const auto& boundaries = partition->GetBoundaries();
+        for (const auto& s : network.GetRoadSegments()) {
+            int from = partition->RegionOfNode(network.GetRoutingGraph()->IndexOf(s->GetStartNode()));
+            int to = partition->RegionOfSegment(s->GetIndex());
+            assert(to == partition->RegionOfNode(network.GetRoutingGraph()->IndexOf(s->GetEndNode())));
+            if (from != to) {
+                ++cut;
+                assert(std::binary_search(boundaries.begin(), boundaries.end(), std::make_pair(from, to)));
+            }
+        }
+        assert(cut == partition->GetCutSegmentCount());
+        assert(cut < network.GetRoadSegmentCount() / 10);
+    }
+
+    // Plus de régions que de noeuds
+    RoadNetwork tiny;
+    Node* a = tiny.AddNode({0, 0, 0});
+    Node* b = tiny.AddNode({300, 0, 0});
+    tiny.AddRoadSegment(a, b, 2);
+    auto partition = NetworkPartition::Build(tiny, 8, tiny.GetTopologyVersion());
+    assert(partition->GetRegionCount() == 2 && partition->GetCutSegmentCount() == 1);
+    assert(NetworkPartition::Build(RoadNetwork(), 4, 1)->GetRegionCount() == 1);
+    std::cout << "Partition tests passed!" << std::endl;
+}
+
+// Même scénario simulé avec regionCount régions ; positions finales
+static std::vector<Vector3> Simulate(int regionCount, int& handoffs) {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Grid, 400, 3);
+    TrafficManager manager;
+    manager.setRoadNetwork(&network);
+    manager.setRegionCount(regionCount);
+
+    PathFinder finder(&network);
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> pick(0, network.GetNodeCount() - 1);
+    while (manager.getVehicleCount() < 150) {
+        Node* from = network.GetNodes()[pick(rng)].get();
+        Node* to = network.GetNodes()[pick(rng)].get();
+        auto route = finder.FindRoute(from, to);
+        if (route.size() < 3) continue;
+        auto car = VehiculeFactory::createVehicule(VehiculeType::CAR, route.front()->GetTrafficLanePosition(0, 0.0f));
+        car->setRoute(route);
+        manager.addVehicle(std::move(car));
+    }
+
+    handoffs = 0;
+    for (int step = 0; step < 400; ++step) {
+        network.Update(1.0f / 30.0f);
+        manager.update(1.0f / 30.0f);
+        handoffs += manager.getLastHandoffCount();
+    }
+    assert(manager.getRegionCount() == regionCount);
+    std::vector<Vector3> positions;
+    for (const auto& v : manager.getVehicles()) positions.push_back(v->getPosition());
+    return positions;
+}
+
+void test_parallel_stepping_is_deterministic() {
+    int serialHandoffs = 0, parallelHandoffs = 0;
+    std::vector<Vector3> serial = Simulate(1, serialHandoffs);
+    std::vector<Vector3> parallel = Simulate(4, parallelHandoffs);
+    assert(serialHandoffs == 0 && parallelHandoffs > 0);
+    assert(serial.size() == parallel.size());
+    for (size_t i = 0; i < serial.size(); ++i) {
+        assert(serial[i].x == parallel[i].x && serial[i].y == parallel[i].y && serial[i].z == parallel[i].z);
+    }
+    std::cout << "Parallel stepping tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running region partition tests..." << std::endl;
+    test_partition();
+    test_parallel_stepping_is_deterministic();
+    std::cout << "All region partition tests passed!" << std::endl;
+    return 0;
+}
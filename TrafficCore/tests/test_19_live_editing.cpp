@@ -0,0 +1,227 @@
+#include <iostream>
+#include <cassert>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+#include "CityGenerator.h"
+#include "NetworkPartition.h"
+#include "PathFinder.h"
+#include "RoadNetwork.h"
+#include "RoutingGraph.h"
+#include "raymath.h"
+#include "SpatialIndex.h"
+#include "TestGeometry.h"
+#include "TestNetworks.h"
+#include "Vehicules/TrafficManager.h"
+#include "Vehicules/VehiculeFactory.h"
+
+// Instantané corrigé identique à une reconstruction complète
+static void AssertSameGraph(const RoutingGraph& patched, const RoutingGraph& built) {
+    assert(patched.GetNodeCount() == built.GetNodeCount());
+    assert(patched.GetEdgeCount() == built.GetEdgeCount());
+    assert(patched.GetMovementCount() == built.GetMovementCount());
+    for (int v = 0; v < built.GetNodeCount(); ++v) {
+        assert(patched.GetNode(v) == built.GetNode(v));
+        assert(patched.IndexOf(built.GetNode(v)) == v);
+        assert(patched.EdgeBegin(v) == built.EdgeBegin(v) && patched.EdgeEnd(v) == built.EdgeEnd(v));
+        assert(patched.InEdgeBegin(v) == built.InEdgeBegin(v) && patched.InEdgeEnd(v) == built.InEdgeEnd(v));
+    }
+    for (int e = 0; e < built.GetEdgeCount(); ++e) {
+        assert(patched.EdgeTarget(e) == built.EdgeTarget(e));
+        assert(patched.EdgeSegment(e) == built.EdgeSegment(e));
+        assert(patched.EdgeSource(e) == built.EdgeSource(e));
+        assert(patched.InEdge(e) == built.InEdge(e));
+        assert(patched.ArcOfSegment(built.EdgeSegment(e)) == e);
+        const int v = built.EdgeTarget(e);
+        for (int f = built.EdgeBegin(v); f < built.EdgeEnd(v); ++f) {
+            assert(patched.GetMovement(e, f) == built.GetMovement(e, f));
+        }
+    }
+}
+
+static void AssertSpatialMatchesBruteForce(const RoadNetwork& network) {
+    auto index = network.GetSpatialIndex();
+    assert(index->GetNodeCount() == network.GetNodeCount());
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> coord(-500.0f, 6000.0f);
+    std::vector<int> found;
+    for (int i = 0; i < 150; ++i) {
+        Vector3 q = {coord(rng), 0.0f, coord(rng)};
+        float bruteNode = std::numeric_limits<float>::infinity();
+        for (const auto& n : network.GetNodes()) bruteNode = std::min(bruteNode, PlanarDistance(q, n->GetPosition()));
+        int node = index->NearestNode(q);
+        assert(node >= 0 && PlanarDistance(q, network.GetNodes()[node]->GetPosition()) == bruteNode);
+
+        float bruteSegment = std::numeric_limits<float>::infinity();
+        for (const auto& s : network.GetRoadSegments()) bruteSegment = std::min(bruteSegment, BruteSegmentDistance(*s, q));
+        SegmentMatch match = index->NearestSegment(q);
+        assert(match.segment >= 0 && match.segment < network.GetRoadSegmentCount());
+        assert(std::fabs(match.distance - bruteSegment) < 0.5f);
+
+        const float radius = 400.0f;
+        index->QueryNodes(q, radius, found);
+        std::sort(found.begin(), found.end());
+        std::vector<int> expected;
+        for (int k = 0; k < network.GetNodeCount(); ++k) {
+            if (PlanarDistance(q, network.GetNodes()[k]->GetPosition()) <= radius) expected.push_back(k);
+        }
+        assert(found == expected);
+
+        index->QuerySegments(q, radius, found);
+        for (const auto& s : network.GetRoadSegments()) {
+            float d = BruteSegmentDistance(*s, q);
+            bool listed = std::binary_search(found.begin(), found.end(), s->GetIndex());
+            if (d < radius - 0.5f) assert(listed);
+            if (d > radius + 0.5f) assert(!listed);
+        }
+    }
+}
+
+void test_patched_snapshots_match_rebuild() {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Grid, 900, 7);
+    network.GetRoutingGraph();
+    network.GetSpatialIndex();
+    auto partition = NetworkPartition::Build(network, 4, network.GetTopologyVersion());
+
+    // Quelques éditions de chaque sorte, snapshots corrigés entre deux lots
+    std::mt19937 rng(21);
+    for (int round = 0; round < 6; ++round) {
+        auto pickNode = [&]() { return network.GetNodes()[rng() % network.GetNodeCount()].get(); };
+        auto pickSegment = [&]() { return network.GetRoadSegments()[rng() % network.GetRoadSegmentCount()].get(); };
+
+        assert(network.RemoveRoadSegment(pickSegment()));
+        assert(network.RemoveRoadSegment(pickSegment()));
+        Node* doomed = pickNode();
+        const int doomedId = doomed->GetId();
+        assert(network.RemoveNode(doomed));
+        assert(network.FindNodeById(doomedId) == nullptr && network.GetNodeIndex(doomed) < 0);
+        assert(!network.RemoveNode(doomed));
+
+        Node* moved = pickNode();
+        assert(network.MoveNode(moved, Vector3Add(moved->GetPosition(), {35.0f, 0.0f, -20.0f})));
+        assert(network.SetNodeShape(pickNode(), ROUNDABOUT, 18.0f));
+        assert(network.SetSegmentLanes(pickSegment(), 4));
+
+        Node* a = pickNode();
+        Node* added = network.AddNode(Vector3Add(a->GetPosition(), {60.0f, 0.0f, 60.0f}));
+        network.AddRoadSegment(a, added, 2);
+        network.AddRoadSegment(added, a, 2);
+        if (!a->GetConnectedRoads().empty()) {
+            RoadSegment* in = a->GetConnectedRoads().front();
+            Node* from = in->GetStartNode() == a ? in->GetEndNode() : in->GetStartNode();
+            network.AddTurnRestriction(from->GetId(), a->GetId(), added->GetId());
+        }
+
+        for (int k = 0; k < network.GetNodeCount(); ++k) assert(network.GetNodeIndex(network.GetNodes()[k].get()) == k);
+        for (const auto& s : network.GetRoadSegments()) assert(network.IsLive(s.get()));
+
+        auto patched = network.GetRoutingGraph();
+        AssertSameGraph(*patched, *RoutingGraph::Build(network, network.GetTopologyVersion()));
+        assert(network.GetSpatialIndex()->IsPatched());
+        AssertSpatialMatchesBruteForce(network);
+
+        std::vector<int> nodeSlots, segmentSlots;
+        assert(network.GetEditsSince(partition->GetVersion(), nodeSlots, segmentSlots));
+        partition = NetworkPartition::Patch(*partition, network, nodeSlots, network.GetTopologyVersion());
+        size_t nodes = 0, segments = 0;
+        for (int r = 0; r < partition->GetRegionCount(); ++r) {
+            nodes += partition->GetRegionNodes(r).size();
+            segments += partition->GetRegionSegments(r).size();
+        }
+        assert(partition->GetRegionCount() == 4);
+        assert(nodes == static_cast<size_t>(network.GetNodeCount()));
+        assert(segments == static_cast<size_t>(network.GetRoadSegmentCount()));
+        for (const auto& s : network.GetRoadSegments()) {
+            assert(partition->RegionOfSegment(s->GetIndex()) == partition->RegionOfNode(network.GetNodeIndex(s->GetEndNode())));
+        }
+        network.ReleaseRetired();
+    }
+
+    // Journal dépassé (demi-tours : toutes les manoeuvres) : reconstruction complète
+    std::vector<int> nodeSlots, segmentSlots;
+    const uint64_t before = network.GetTopologyVersion();
+    network.SetUTurnsAllowed(true);
+    assert(!network.GetEditsSince(before, nodeSlots, segmentSlots));
+    AssertSameGraph(*network.GetRoutingGraph(), *RoutingGraph::Build(network, network.GetTopologyVersion()));
+    assert(!network.GetSpatialIndex()->IsPatched());
+    std::cout << "Patched snapshot tests passed!" << std::endl;
+}
+
+static bool Contains(const TrafficManager& manager, const Vehicule* v) {
+    for (const auto& owned : manager.getVehicles()) {
+        if (owned.get() == v) return true;
+    }
+    return false;
+}
+
+void test_vehicles_follow_edits() {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Grid, 400, 7);
+    TrafficManager manager;
+    manager.setRoadNetwork(&network);
+    manager.setRegionCount(2);
+
+    PathFinder finder(&network);
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> pick(0, network.GetNodeCount() - 1);
+    while (manager.getVehicleCount() < 40) {
+        auto route = finder.FindRoute(network.GetNodes()[pick(rng)].get(), network.GetNodes()[pick(rng)].get());
+        if (route.size() < 6) continue;
+        auto car = VehiculeFactory::createVehicule(VehiculeType::CAR, route.front()->GetTrafficLanePosition(0, 0.0f));
+        car->setRoute(route);
+        manager.addVehicle(std::move(car));
+    }
+    for (int step = 0; step < 10; ++step) {
+        network.Update(1.0f / 30.0f);
+        manager.update(1.0f / 30.0f);
+    }
+
+    // Segment engagé retiré : le véhicule quitte la simulation
+    Vehicule* evicted = manager.getVehicles()[0].get();
+    assert(evicted->getCommittedRoad());
+    assert(network.RemoveRoadSegment(evicted->getCommittedRoad()));
+
+    // Segment à venir retiré : détour, suite de l'itinéraire conservée
+    Vehicule* rerouted = nullptr;
+    for (const auto& v : manager.getVehicles()) {
+        const auto& remaining = v->getRemainingRoute();
+        if (v.get() != evicted && remaining.size() >= 3 && network.IsLive(v->getCommittedRoad())) {
+            rerouted = v.get();
+            break;
+        }
+    }
+    assert(rerouted);
+    RoadSegment* last = rerouted->getRemainingRoute().back();
+    assert(network.RemoveRoadSegment(rerouted->getRemainingRoute()[1]));
+
+    network.Update(1.0f / 30.0f);
+    manager.update(1.0f / 30.0f);
+    network.ReleaseRetired();
+    assert(!Contains(manager, evicted));
+    assert(Contains(manager, rerouted));
+    const auto& remaining = rerouted->getRemainingRoute();
+    assert(!remaining.empty() && remaining.back() == last);
+    const RoadSegment* previous = rerouted->getCommittedRoad();
+    for (const RoadSegment* s : remaining) {
+        assert(network.IsLive(s));
+        assert(s->GetStartNode() == previous->GetEndNode());
+        previous = s;
+    }
+
+    for (int step = 0; step < 60; ++step) {
+        network.Update(1.0f / 30.0f);
+        manager.update(1.0f / 30.0f);
+    }
+    std::cout << "Vehicle edit tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running live editing tests..." << std::endl;
+    test_patched_snapshots_match_rebuild();
+    test_vehicles_follow_edits();
+    std::cout << "All live editing tests passed!" << std::endl;
+    return 0;
+}
@@ -2,6 +2,9 @@
 #include <cassert>
 #include "RoadNetwork.h"
 #include "PathFinder.h"
+#include "MapLoader.h"
+#include <cstdio>
+#include <fstream>
 
 void test_nodes() {
     RoadNetwork network;
@@ -50,10 +53,64 @@ void test_pathfinding() {
     std::cout << "Pathfinding tests passed!" << std::endl;
 }
 
+void test_node_ids() {
+    RoadNetwork network;
+    // Ids imposés : compacts, épars, puis numérotation automatique après le plus grand
+    Node* a = network.AddNodeWithId(10, {0, 0, 0});
+    Node* b = network.AddNodeWithId(5000000, {100, 0, 0});
+    Node* c = network.AddNode({200, 0, 0});
+    assert(a && b && c);
+    assert(c->GetId() == 5000001);
+    assert(network.FindNodeById(10) == a);
+    assert(network.FindNodeById(5000000) == b);
+    assert(network.FindNodeById(5000001) == c);
+    assert(network.FindNodeById(11) == nullptr);
+    assert(network.FindNodeById(-3) == nullptr);
+
+    // Id déjà pris : refusé
+    assert(network.AddNodeWithId(10, {300, 0, 0}) == nullptr);
+    assert(network.GetNodeCount() == 3);
+
+    network.Clear();
+    assert(network.FindNodeById(10) == nullptr);
+    assert(network.AddNode({0, 0, 0})->GetId() == 1);
+
+    std::cout << "Node id index tests passed!" << std::endl;
+}
+
+void test_map_ids() {
+    const char* path = "test_map_ids.json";
+    {
+        std::ofstream out(path);
+        out << R"({"topology": {
+            "nodes": [ {"id": 7, "pos": [0, 0, 0]}, {"id": 42, "pos": [100, 0, 0]}, {"id": 3, "pos": [100, 0, 100]} ],
+            "routes": [ {"from": 7, "to": 42, "lanes": 2}, {"from": 42, "to": 3, "lanes": 2}, {"from": 3, "to": 99} ]
+        }})";
+    }
+    RoadNetwork network;
+    assert(MapLoader::LoadFromFile(path, network));
+    std::remove(path);
+
+    // Les ids du fichier sont conservés et les routes relient les bons noeuds
+    assert(network.GetNodeCount() == 3);
+    assert(network.GetRoadSegmentCount() == 2); // 3 -> 99 : noeud inconnu
+    Node* n7 = network.FindNodeById(7);
+    Node* n42 = network.FindNodeById(42);
+    assert(n7 && n42 && network.FindNodeById(3));
+    assert(n42->GetPosition().x == 100.0f);
+    assert(network.GetRoadSegments()[0]->GetStartNode() == n7);
+    assert(network.GetRoadSegments()[0]->GetEndNode() == n42);
+    assert(network.AddNode({0, 0, 0})->GetId() == 43);
+
+    std::cout << "Map id tests passed!" << std::endl;
+}
+
 int main() {
     std::cout << "Running RoadNetwork tests..." << std::endl;
     test_nodes();
     test_segments();
+    test_node_ids();
+    test_map_ids();
     test_pathfinding();
     std::cout << "All RoadNetwork tests passed!" << std::endl;
     return 0;
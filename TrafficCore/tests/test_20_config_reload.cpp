@@ -0,0 +1,142 @@
+#include <iostream>
+#include <cassert>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include "core/FileWatcher.h"
+#include "MapLoader.h"
+#include "RoadNetwork.h"
+#include "Vehicules/VehiculeFactory.h"
+
+static const char* kBefore = R"({
+  "topology": {
+    "nodes": [
+      {"id": 1, "position": [0, 0]},
+      {"id": 2, "position": [200, 0], "type": "traffic_light"},
+      {"id": 3, "position": [200, 200]},
+      {"id": 4, "position": [0, 200]}
+    ],
+    "routes": [
+      {"from": 1, "to": 2, "lanes": 2}, {"from": 2, "to": 1, "lanes": 2},
+      {"from": 2, "to": 3, "lanes": 2}, {"from": 3, "to": 4, "lanes": 2},
+      {"from": 4, "to": 1, "lanes": 2}
+    ],
+    "turn_restrictions": [ {"from": 1, "via": 2, "to": 3} ]
+  },
+  "vehicle_types": { "BUS": { "max_speed": 40.0 } }
+})";
+
+// Rond-point au noeud 2, noeud 3 déplacé, noeud 4 retiré, noeud 5 ajouté, voies modifiées
+static const char* kAfter = R"({
+  "topology": {
+    "nodes": [
+      {"id": 1, "position": [0, 0]},
+      {"id": 2, "position": [200, 0], "type": "roundabout", "radius": 20},
+      {"id": 3, "position": [260, 200]},
+      {"id": 5, "position": [-100, 100]}
+    ],
+    "routes": [
+      {"from": 1, "to": 2, "lanes": 3}, {"from": 2, "to": 1, "lanes": 2},
+      {"from": 2, "to": 3, "lanes": 2}, {"from": 3, "to": 5, "lanes": 1},
+      {"from": 5, "to": 1, "lanes": 1}
+    ],
+    "turn_restrictions": [ {"from": 2, "via": 3, "to": 5} ],
+    "allow_u_turns": true
+  },
+  "vehicle_types": { "BUS": { "max_speed": 55.0 } }
+})";
+
+// Même réseau que s'il avait été chargé depuis le texte
+static void AssertSameNetwork(const RoadNetwork& a, const RoadNetwork& b) {
+    assert(a.GetNodeCount() == b.GetNodeCount() && a.GetRoadSegmentCount() == b.GetRoadSegmentCount());
+    for (const auto& n : b.GetNodes()) {
+        const Node* m = a.FindNodeById(n->GetId());
+        assert(m && m->GetType() == n->GetType() && m->GetRadius() == n->GetRadius());
+        assert(m->GetPosition().x == n->GetPosition().x && m->GetPosition().z == n->GetPosition().z);
+    }
+    for (const auto& s : b.GetRoadSegments()) {
+        bool found = false;
+        for (const auto& t : a.GetRoadSegments()) {
+            if (t->GetStartNode()->GetId() == s->GetStartNode()->GetId() &&
+                t->GetEndNode()->GetId() == s->GetEndNode()->GetId() && t->GetLanes() == s->GetLanes()) {
+                found = true;
+            }
+        }
+        assert(found);
+    }
+    assert(a.GetTurnRestrictions().size() == b.GetTurnRestrictions().size());
+    assert(a.AreUTurnsAllowed() == b.AreUTurnsAllowed());
+}
+
+void test_reload_diff() {
+    RoadNetwork network;
+    assert(MapLoader::LoadFromMemory(kBefore, network));
+    network.GetRoutingGraph();
+    network.GetSpatialIndex();
+    const Node* kept = network.FindNodeById(1);
+    const RoadSegment* untouched = network.GetRoadSegments()[1].get(); // 2 -> 1
+
+    MapLoader::ReloadStats stats;
+    assert(MapLoader::ReloadFromMemory(kAfter, network, &stats));
+    assert(stats.nodesAdded == 1 && stats.nodesRemoved == 1 && stats.nodesChanged == 2);
+    assert(stats.segmentsAdded == 2 && stats.segmentsRemoved == 2 && stats.segmentsChanged == 1);
+    assert(stats.restrictionsChanged == 2 && stats.uTurnsChanged && stats.vehicleTypesChanged == 1);
+    assert(VehiculeFactory::getDefaultParams(VehiculeType::BUS).maxSpeed == 55.0f);
+
+    // Éléments inchangés conservés (véhicules et instantanés les désignent toujours)
+    assert(network.FindNodeById(1) == kept && network.IsLive(untouched));
+    RoadNetwork fresh;
+    assert(MapLoader::LoadFromMemory(kAfter, fresh));
+    AssertSameNetwork(network, fresh);
+    assert(network.GetSpatialIndex()->GetNodeCount() == network.GetNodeCount());
+    assert(network.GetRoutingGraph()->GetNodeCount() == network.GetNodeCount());
+    network.ReleaseRetired();
+
+    // Deuxième passage : rien à faire
+    assert(MapLoader::ReloadFromMemory(kAfter, network, &stats));
+    assert(stats.IsEmpty());
+
+    // Texte invalide : réseau intact
+    const uint64_t version = network.GetTopologyVersion();
+    std::string error;
+    assert(!MapLoader::ReloadFromMemory("{ \"topology\": { \"nodes\": [ {\"id\": 1,", network, &stats, &error));
+    assert(!error.empty() && network.GetTopologyVersion() == version);
+    AssertSameNetwork(network, fresh);
+    std::cout << "Reload diff tests passed!" << std::endl;
+}
+
+void test_file_watcher() {
+    const char* path = "test_config_reload.json";
+    std::ofstream(path) << kBefore;
+    FileWatcher watcher;
+    assert(watcher.Watch(path));
+    assert(!watcher.Poll());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::ofstream(path) << kAfter;
+    bool changed = false;
+    for (int i = 0; i < 300 && !changed; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        changed = watcher.Poll();
+    }
+    assert(changed);
+    assert(!watcher.Poll()); // signalé une seule fois
+
+    RoadNetwork network;
+    assert(MapLoader::LoadFromMemory(kBefore, network));
+    MapLoader::ReloadStats stats;
+    assert(MapLoader::ReloadFromFile(path, network, &stats) && !stats.IsEmpty());
+    watcher.Close();
+    std::remove(path);
+    std::cout << "File watcher tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running configuration reload tests..." << std::endl;
+    test_reload_diff();
+    test_file_watcher();
+    std::cout << "All configuration reload tests passed!" << std::endl;
+    return 0;
+}
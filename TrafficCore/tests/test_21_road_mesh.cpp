@@ -0,0 +1,100 @@
+#include <iostream>
+#include <cassert>
+#include "RoadMesh.h"
+#include "RoadNetwork.h"
+#include "TestNetworks.h"
+#include "geometry/RoadMeshBuilder.h"
+
+// Toutes les faces horizontales tournées vers le haut (culling des faces arrière)
+static void AssertFacingUp(const RoadMeshBuilder& b) {
+    const auto& v = b.GetVertices();
+    for (size_t t = 0; t + 9 <= v.size(); t += 9) {
+        float ux = v[t + 3] - v[t], uz = v[t + 5] - v[t + 2];
+        float wx = v[t + 6] - v[t], wz = v[t + 8] - v[t + 2];
+        float ny = uz * wx - ux * wz;
+        assert(ny >= -1e-3f);
+    }
+}
+
+// Même contenu qu'une cuisson complète du réseau courant
+static void AssertMatchesFreshBake(const RoadMesh& mesh, const RoadNetwork& network) {
+    RoadMesh fresh;
+    fresh.Sync(network);
+    assert(mesh.GetVertexCount() == fresh.GetVertexCount());
+    assert(mesh.GetDrawCallCount() == fresh.GetDrawCallCount());
+}
+
+void test_builder() {
+    RoadMeshBuilder b;
+    b.Triangle({0, 0, 0}, {0, 0, 1}, {1, 0, 0}, WHITE);
+    b.Triangle({0, 0, 0}, {1, 0, 0}, {0, 0, 1}, WHITE);
+    b.Quad({0, 0, 0}, {4, 0, 0}, {4, 0, 4}, {0, 0, 4}, GRAY);
+    b.Line({0, 0, 0}, {10, 0, 10}, WHITE);
+    b.Line({3, 0, 3}, {3, 0, 3}, WHITE); // dégénérée : ignorée
+    assert(b.GetVertexCount() == 3 + 3 + 6 + 6);
+    AssertFacingUp(b);
+    assert(b.GetColors().size() == static_cast<size_t>(b.GetVertexCount()) * 4);
+
+    RoadNetwork network;
+    Node* a = network.AddNode({0, 0, 0}, ROUNDABOUT, 30.0f);
+    Node* c = network.AddNode({300, 0, 40});
+    network.AddRoadSegment(a, c, 2)->Bake(b);
+    network.AddRoadSegment(c, a, 4, false)->Bake(b);
+    network.AddIntersection(a)->Bake(b);
+    network.AddIntersection(c)->Bake(b);
+    assert(b.GetVertexCount() > 1000);
+    std::cout << "Mesh builder tests passed!" << std::endl;
+}
+
+void test_tiles_follow_edits() {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Grid, 900, 5);
+    for (const auto& node : network.GetNodes()) network.AddIntersection(node.get());
+
+    RoadMesh mesh;
+    const int tiles = mesh.Sync(network);
+    assert(tiles > 1 && tiles == mesh.GetTileCount());
+    assert(mesh.GetDrawCallCount() <= tiles && mesh.GetDrawCallCount() < network.GetRoadSegmentCount() / 20);
+    assert(mesh.Sync(network) == 0);
+    AssertMatchesFreshBake(mesh, network);
+
+    // Édition locale : une ou deux tuiles recuites
+    RoadSegment* widened = network.GetRoadSegments()[network.GetRoadSegmentCount() / 2].get();
+    assert(network.SetSegmentLanes(widened, widened->GetLanes() + 2));
+    const int rebuilt = mesh.Sync(network);
+    assert(rebuilt >= 1 && rebuilt <= 4);
+    AssertMatchesFreshBake(mesh, network);
+
+    RoadSegment* hidden = nullptr;
+    for (const auto& s : network.GetRoadSegments()) {
+        if (s->IsVisible()) hidden = s.get();
+    }
+    assert(hidden && network.SetSegmentVisible(hidden, false));
+    const int before = mesh.GetVertexCount();
+    assert(mesh.Sync(network) >= 1 && mesh.GetVertexCount() < before);
+    AssertMatchesFreshBake(mesh, network);
+
+    // Retrait avec échange du dernier emplacement, déplacement, rond-point
+    assert(network.RemoveNode(network.GetNodes()[10].get()));
+    Node* moved = network.GetNodes()[20].get();
+    Vector3 pos = moved->GetPosition();
+    assert(network.MoveNode(moved, {pos.x + 700.0f, pos.y, pos.z}));
+    assert(network.SetNodeShape(network.GetNodes()[30].get(), ROUNDABOUT, 25.0f));
+    assert(mesh.Sync(network) < mesh.GetTileCount());
+    AssertMatchesFreshBake(mesh, network);
+    network.ReleaseRetired();
+
+    // Journal dépassé : tout est recuit
+    network.SetUTurnsAllowed(true);
+    assert(mesh.Sync(network) == mesh.GetTileCount());
+    AssertMatchesFreshBake(mesh, network);
+    std::cout << "Road mesh tile tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running road mesh tests..." << std::endl;
+    test_builder();
+    test_tiles_follow_edits();
+    std::cout << "All road mesh tests passed!" << std::endl;
+    return 0;
+}
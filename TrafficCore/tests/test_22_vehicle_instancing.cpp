@@ -0,0 +1,68 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "raymath.h"
+#include "RoadNetwork.h"
+#include "Vehicules/Bus.h"
+#include "Vehicules/Car.h"
+#include "Vehicules/Emergencyvehicle.h"
+#include "Vehicules/VehicleRenderer.h"
+
+static bool Near(float a, float b) { return std::fabs(a - b) < 1e-4f; }
+
+void test_batches_by_model() {
+    // Modèle partagé factice (pas de contexte graphique) : seuls les pointeurs comptent
+    Mesh meshes[2] = {};
+    Material materials[1] = {};
+    int meshMaterial[2] = {0, 0};
+    Model shared = {};
+    shared.transform = MatrixIdentity();
+    shared.meshCount = 2;
+    shared.meshes = meshes;
+    shared.materialCount = 1;
+    shared.materials = materials;
+    shared.meshMaterial = meshMaterial;
+
+    RoadNetwork network;
+    std::vector<std::unique_ptr<Vehicule>> vehicles;
+    for (int i = 0; i < 500; ++i) {
+        vehicles.push_back(std::make_unique<Car>(Vector3{i * 10.0f, 0.0f, 5.0f}, shared, i));
+    }
+    auto cube = std::make_unique<Bus>(Vector3{3.0f, 1.0f, 4.0f}, Model{});
+    cube->setDebugColor({255, 0, 51, 255});
+    vehicles.push_back(std::move(cube));
+    vehicles.push_back(std::make_unique<EmergencyVehicle>(Vector3{0, 0, 0}, EmergencyType::AMBULANCE, Model{}, &network));
+
+    VehicleRenderer renderer;
+    renderer.Collect(vehicles);
+    assert(renderer.GetBatches().size() == 4);
+    assert(renderer.GetInstanceCount() == 504);
+    assert(renderer.GetIndividual().empty());
+    // 2 maillages pour 500 voitures, 1 cube instancié, carrosserie et lampes de l'ambulance procédurale
+    assert(renderer.GetDrawCallCount() == 5);
+
+    // Matrices : translation et cap de DrawModelEx, teinte dans la dernière ligne
+    vehicles[7]->setScale(2.0f);
+    renderer.Collect(vehicles);
+    const Matrix& m = renderer.GetBatches()[0].transforms[7];
+    assert(Near(m.m12, 70.0f) && Near(m.m14, 5.0f) && Near(m.m13, vehicles[7]->getRenderHeight()));
+    assert(Near(m.m0, 2.0f) && Near(m.m3, 1.0f) && Near(m.m7, 1.0f) && Near(m.m11, 1.0f));
+    const Matrix& c = renderer.GetBatches()[1].transforms[0];
+    assert(Near(c.m12, 3.0f) && Near(c.m13, 1.0f) && Near(c.m14, 4.0f));
+    assert(Near(c.m3, 1.0f) && Near(c.m7, 0.0f) && Near(c.m11, 0.2f));
+
+    // Frame suivante : lots vidés, réutilisés
+    vehicles.resize(10);
+    renderer.Collect(vehicles);
+    assert(renderer.GetInstanceCount() == 10 && renderer.GetDrawCallCount() == 2);
+    std::cout << "Instancing batch tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running vehicle instancing tests..." << std::endl;
+    test_batches_by_model();
+    std::cout << "All vehicle instancing tests passed!" << std::endl;
+    return 0;
+}
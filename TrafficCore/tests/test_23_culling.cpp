@@ -0,0 +1,152 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include "raymath.h"
+#include "RoadNetwork.h"
+#include "TestNetworks.h"
+#include "geometry/Frustum.h"
+#include "geometry/RenderGrid.h"
+#include "Vehicules/Car.h"
+#include "Vehicules/VehicleRenderer.h"
+
+static Camera3D MakeCamera(Vector3 position, Vector3 target) {
+    Camera3D camera = {};
+    camera.position = position;
+    camera.target = target;
+    camera.up = {0.0f, 1.0f, 0.0f};
+    camera.fovy = 60.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+    return camera;
+}
+
+// Point dans la pyramide, calculé dans le repère de la caméra
+static bool InsidePyramid(const Camera3D& c, float aspect, Vector3 p) {
+    Vector3 forward = Vector3Normalize(Vector3Subtract(c.target, c.position));
+    Vector3 right = Vector3Normalize(Vector3CrossProduct(forward, c.up));
+    Vector3 up = Vector3CrossProduct(right, forward);
+    Vector3 d = Vector3Subtract(p, c.position);
+    float z = Vector3DotProduct(d, forward);
+    float tanV = std::tan(c.fovy * DEG2RAD * 0.5f);
+    return z >= Frustum::kNearPlane && z <= Frustum::kFarPlane &&
+           std::fabs(Vector3DotProduct(d, right)) <= z * tanV * aspect &&
+           std::fabs(Vector3DotProduct(d, up)) <= z * tanV;
+}
+
+void test_frustum() {
+    const float aspect = 16.0f / 9.0f;
+    Camera3D camera = MakeCamera({0.0f, 150.0f, 200.0f}, {0.0f, 0.0f, 0.0f});
+    Frustum view = Frustum::FromCamera(camera, aspect);
+    assert(view.IntersectsSphere({0.0f, 0.0f, 0.0f}, 0.0f));
+    assert(!view.IntersectsSphere({0.0f, 150.0f, 400.0f}, 10.0f)); // derrière
+    assert(!view.IntersectsSphere({0.0f, -900.0f, -1500.0f}, 10.0f)); // au-delà du plan lointain
+    assert(view.IntersectsSphere({0.0f, 150.0f, 220.0f}, 30.0f));    // à cheval sur le plan proche
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> coord(-1200.0f, 1200.0f);
+    int inside = 0;
+    for (int i = 0; i < 20000; ++i) {
+        Vector3 p = {coord(rng), coord(rng) * 0.3f, coord(rng)};
+        bool expected = InsidePyramid(camera, aspect, p);
+        assert(view.IntersectsSphere(p, 0.0f) == expected);
+        assert(view.IntersectsBox({p, p}) == expected);
+        inside += expected ? 1 : 0;
+    }
+    assert(inside > 100);
+
+    // Boîte qui enjambe la pyramide sans qu'aucun coin n'y soit : gardée
+    assert(view.IntersectsBox({{-2000.0f, -1.0f, -10.0f}, {2000.0f, 1.0f, 10.0f}}));
+    assert(view.DistanceTo({{-10.0f, 0.0f, -10.0f}, {10.0f, 200.0f, 10.0f}}) == 190.0f);
+
+    Camera3D ortho = camera;
+    ortho.projection = CAMERA_ORTHOGRAPHIC;
+    ortho.fovy = 100.0f;
+    Frustum flat = Frustum::FromCamera(ortho, 1.0f);
+    assert(flat.IntersectsSphere({40.0f, 0.0f, 0.0f}, 0.0f));
+    assert(!flat.IntersectsSphere({60.0f, 0.0f, 0.0f}, 5.0f));
+
+    BoundingBox unit = {{-1.0f, 0.0f, -1.0f}, {1.0f, 2.0f, 1.0f}};
+    BoundingBox moved = TransformBounds(unit, MatrixMultiply(MatrixScale(3.0f, 3.0f, 3.0f), MatrixTranslate(10.0f, 0.0f, 0.0f)));
+    assert(std::fabs(moved.min.x - 7.0f) < 1e-4f && std::fabs(moved.max.x - 13.0f) < 1e-4f);
+    assert(std::fabs(moved.max.y - 6.0f) < 1e-4f);
+    std::cout << "Frustum tests passed!" << std::endl;
+}
+
+void test_render_grid() {
+    RenderGrid grid;
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coord(-1500.0f, 1500.0f);
+    std::uniform_real_distribution<float> size(1.0f, 40.0f);
+    for (int i = 0; i < 3000; ++i) {
+        Vector3 c = {coord(rng), 0.0f, coord(rng)};
+        float s = size(rng);
+        grid.Add({{c.x - s, 0.0f, c.z - s}, {c.x + s, s * 2.0f, c.z + s}}, i % 3 == 0 ? 300.0f : 0.0f);
+    }
+    assert(grid.GetCount() == 3000 && grid.GetCellCount() > 50);
+
+    const Camera3D camera = MakeCamera({0.0f, 150.0f, 200.0f}, {0.0f, 0.0f, 0.0f});
+    const Frustum view = Frustum::FromCamera(camera, 16.0f / 9.0f);
+    std::vector<int> visible;
+    grid.Query(view, visible);
+    const CullStats& stats = grid.GetStats();
+    assert(stats.drawn == static_cast<int>(visible.size()));
+    assert(stats.drawn + stats.GetCulled() == grid.GetCount());
+    assert(stats.frustumCulled > 0 && stats.distanceCulled > 0 && stats.drawn > 0);
+
+    // Même résultat qu'un test exhaustif, objet par objet
+    RenderGrid copy;
+    std::mt19937 again(5);
+    std::vector<BoundingBox> boxes;
+    for (int i = 0; i < 3000; ++i) {
+        Vector3 c = {coord(again), 0.0f, coord(again)};
+        float s = size(again);
+        boxes.push_back({{c.x - s, 0.0f, c.z - s}, {c.x + s, s * 2.0f, c.z + s}});
+    }
+    std::vector<int> expected;
+    for (int i = 0; i < 3000; ++i) {
+        if (i % 3 == 0 && view.DistanceTo(boxes[i]) > 300.0f) continue;
+        if (view.IntersectsBox(boxes[i])) expected.push_back(i);
+    }
+    assert(visible == expected);
+    std::cout << "Render grid tests passed!" << std::endl;
+}
+
+void test_tiles_and_vehicles() {
+    RoadNetwork network;
+    BuildCity(network, CityParams::Layout::Grid, 900, 5);
+
+    // Vue rasante sur un coin de la ville : la plupart des tuiles sont hors champ
+    Vector3 corner = network.GetNodes()[0]->GetPosition();
+    Frustum view = Frustum::FromCamera(MakeCamera(Vector3Add(corner, {-50.0f, 80.0f, -50.0f}), corner), 16.0f / 9.0f);
+    network.Draw(&view);
+    const CullStats& tiles = network.GetRoadMesh().GetCullStats();
+    assert(tiles.drawn >= 1 && tiles.frustumCulled > 0);
+    assert(tiles.drawn + tiles.frustumCulled == network.GetRoadMesh().GetDrawCallCount());
+    network.Draw();
+    assert(network.GetRoadMesh().GetCullStats().drawn == network.GetRoadMesh().GetDrawCallCount());
+
+    std::vector<std::unique_ptr<Vehicule>> vehicles;
+    for (int i = 0; i < 200; ++i) {
+        vehicles.push_back(std::make_unique<Car>(Vector3{corner.x + i * 25.0f, 0.0f, corner.z + i * 25.0f}, Model{}, i));
+    }
+    VehicleRenderer renderer;
+    renderer.Collect(vehicles, &view);
+    const CullStats& cars = renderer.GetCullStats();
+    assert(cars.drawn + cars.frustumCulled == 200);
+    assert(cars.drawn > 0 && cars.frustumCulled > 0);
+    assert(renderer.GetInstanceCount() == cars.drawn);
+    renderer.Collect(vehicles);
+    assert(renderer.GetInstanceCount() == 200 && renderer.GetCullStats().GetCulled() == 0);
+    std::cout << "Tile and vehicle culling tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running culling tests..." << std::endl;
+    test_frustum();
+    test_render_grid();
+    test_tiles_and_vehicles();
+    std::cout << "All culling tests passed!" << std::endl;
+    return 0;
+}
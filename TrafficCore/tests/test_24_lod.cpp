@@ -0,0 +1,189 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "raymath.h"
+#include "geometry/MeshSimplifier.h"
+#include "Vehicules/Car.h"
+#include "Vehicules/ModelLod.h"
+#include "Vehicules/ModelManager.h"
+#include "Vehicules/VehicleRenderer.h"
+
+// Terrain ondulé de n x n quads, indexé comme les maillages glTF de raylib
+static Mesh MakeTerrain(int n, bool indexed) {
+    std::vector<Vector3> grid;
+    for (int j = 0; j <= n; ++j) {
+        for (int i = 0; i <= n; ++i) grid.push_back({(float)i, std::sin(i * 0.3f) * std::cos(j * 0.2f), (float)j});
+    }
+    std::vector<int> tris;
+    for (int j = 0; j < n; ++j) {
+        for (int i = 0; i < n; ++i) {
+            int a = j * (n + 1) + i, b = a + 1, c = a + n + 1, d = c + 1;
+            tris.insert(tris.end(), {a, c, b, b, c, d});
+        }
+    }
+    Mesh mesh = {};
+    mesh.triangleCount = (int)tris.size() / 3;
+    mesh.vertexCount = indexed ? (int)grid.size() : (int)tris.size();
+    mesh.vertices = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.normals = (float*)MemAlloc(mesh.vertexCount * 3 * sizeof(float));
+    mesh.texcoords = (float*)MemAlloc(mesh.vertexCount * 2 * sizeof(float));
+    auto put = [&](int slot, Vector3 p) {
+        mesh.vertices[3 * slot] = p.x;
+        mesh.vertices[3 * slot + 1] = p.y;
+        mesh.vertices[3 * slot + 2] = p.z;
+        mesh.normals[3 * slot + 1] = 1.0f;
+        mesh.texcoords[2 * slot] = p.x / n;
+        mesh.texcoords[2 * slot + 1] = p.z / n;
+    };
+    if (indexed) {
+        for (size_t i = 0; i < grid.size(); ++i) put((int)i, grid[i]);
+        mesh.indices = (unsigned short*)MemAlloc(tris.size() * sizeof(unsigned short));
+        for (size_t i = 0; i < tris.size(); ++i) mesh.indices[i] = (unsigned short)tris[i];
+    } else {
+        for (size_t i = 0; i < tris.size(); ++i) put((int)i, grid[tris[i]]);
+    }
+    return mesh;
+}
+
+static void FreeMesh(Mesh& m) {
+    MemFree(m.vertices);
+    MemFree(m.normals);
+    MemFree(m.texcoords);
+    MemFree(m.colors);
+    MemFree(m.indices);
+    m = {};
+}
+
+static void AssertValid(const Mesh& m) {
+    assert(m.vertexCount > 0 && m.triangleCount > 0);
+    for (int t = 0; t < m.triangleCount; ++t) {
+        int v[3];
+        for (int k = 0; k < 3; ++k) {
+            v[k] = m.indices ? m.indices[3 * t + k] : 3 * t + k;
+            assert(v[k] >= 0 && v[k] < m.vertexCount);
+        }
+        assert(v[0] != v[1] && v[1] != v[2] && v[0] != v[2]);
+    }
+    for (int i = 0; i < m.vertexCount; ++i) {
+        // Normales unitaires, sommets dans la boîte d'origine
+        assert(std::fabs(m.normals[3 * i + 1] - 1.0f) < 1e-4f);
+        assert(m.vertices[3 * i] >= 0.0f && m.vertices[3 * i] <= 64.0f);
+    }
+}
+
+void test_simplifier() {
+    for (bool indexed : {true, false}) {
+        Mesh terrain = MakeTerrain(64, indexed);
+        Mesh coarse = MeshSimplifier::Simplify(terrain, 8);
+        AssertValid(coarse);
+        assert(coarse.triangleCount * 20 < terrain.triangleCount);
+        assert(coarse.indices && coarse.texcoords);
+        Mesh fine = MeshSimplifier::Simplify(terrain, 64);
+        AssertValid(fine);
+        assert(fine.triangleCount > coarse.triangleCount * 10);
+        FreeMesh(coarse);
+        FreeMesh(fine);
+        FreeMesh(terrain);
+    }
+    Mesh empty = {};
+    assert(MeshSimplifier::Simplify(empty).vertexCount == 0);
+    std::cout << "Mesh simplifier tests passed!" << std::endl;
+}
+
+void test_selection_hysteresis() {
+    LodSelector::ClearView();
+    assert(LodSelector::Select(LodSelector::ScreenSize({0, 0, 1000}, 1.0f), LodLevel::Full) == LodLevel::Full);
+
+    const float t1 = LodSelector::kSimplifiedBelow, t2 = LodSelector::kBoxBelow, k = LodSelector::kHysteresis;
+    assert(LodSelector::Select(t1 * 2.0f, LodLevel::Full) == LodLevel::Full);
+    assert(LodSelector::Select(t1 * 0.9f, LodLevel::Full) == LodLevel::Simplified);
+    assert(LodSelector::Select(t2 * 0.5f, LodLevel::Full) == LodLevel::Box);
+    // Bande d'hystérésis : le niveau courant est conservé
+    assert(LodSelector::Select(t1 * 1.1f, LodLevel::Simplified) == LodLevel::Simplified);
+    assert(LodSelector::Select(t1 * k * 1.05f, LodLevel::Simplified) == LodLevel::Full);
+    assert(LodSelector::Select(t2 * 1.1f, LodLevel::Box) == LodLevel::Box);
+    assert(LodSelector::Select(t2 * k * 1.05f, LodLevel::Box) == LodLevel::Simplified);
+    assert(LodSelector::Select(t1 * k * 2.0f, LodLevel::Box) == LodLevel::Full);
+
+    // Taille à l'écran : inversement proportionnelle à la distance
+    Camera3D camera = {};
+    camera.position = {0, 0, 0};
+    camera.target = {0, 0, 1};
+    camera.up = {0, 1, 0};
+    camera.fovy = 60.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+    LodSelector::SetView(camera, 900);
+    const float near = LodSelector::ScreenSize({0, 0, 50}, 2.0f);
+    const float far = LodSelector::ScreenSize({0, 0, 100}, 2.0f);
+    assert(std::fabs(near - 2.0f * far) < 1e-3f);
+    assert(std::fabs(near - 2.0f / (50.0f * std::tan(30.0f * DEG2RAD)) * 900.0f) < 1e-3f);
+    LodSelector::ClearView();
+    std::cout << "LOD selection tests passed!" << std::endl;
+}
+
+void test_vehicle_levels() {
+    Mesh meshes[1] = {MakeTerrain(48, true)};
+    int meshMaterial[1] = {0};
+    Model shared = {};
+    shared.transform = MatrixIdentity();
+    shared.meshCount = 1;
+    shared.meshes = meshes;
+    shared.meshMaterial = meshMaterial;
+
+    ModelManager& mm = ModelManager::getInstance();
+    const ModelLod* lod = mm.buildLod(shared);
+    assert(lod && mm.getLod(shared) == lod && mm.buildLod(shared) == lod);
+    assert(lod->simplified.meshCount == 1 && lod->simplifiedTriangles * 4 < lod->fullTriangles);
+    assert(lod->simplified.meshMaterial[0] == 0);
+    assert(lod->bounds.max.x >= lod->bounds.min.x);
+
+    // Trois voitures : proche, moyenne, lointaine
+    std::vector<std::unique_ptr<Vehicule>> vehicles;
+    for (float z : {60.0f, 2000.0f, 20000.0f}) vehicles.push_back(std::make_unique<Car>(Vector3{0, 0, z}, shared, 0));
+    Camera3D camera = {};
+    camera.position = {0, 30, 0};
+    camera.target = {0, 30, 1};
+    camera.up = {0, 1, 0};
+    camera.fovy = 60.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+    LodSelector::SetView(camera, 900);
+
+    VehicleRenderer renderer;
+    renderer.Collect(vehicles);
+    assert(vehicles[0]->getLodLevel() == LodLevel::Full);
+    assert(vehicles[1]->getLodLevel() == LodLevel::Simplified);
+    assert(vehicles[2]->getLodLevel() == LodLevel::Box);
+    int batches = 0;
+    for (const auto& b : renderer.GetBatches()) {
+        if (b.transforms.empty()) continue;
+        ++batches;
+        if (b.model.meshCount == 0) {
+            // Boîte : teinte de la couleur moyenne, cube étiré
+            assert(std::fabs(b.transforms[0].m3 - lod->color.r / 255.0f) < 1e-4f);
+        } else {
+            assert(b.model.meshes == meshes || b.model.meshes == lod->simplified.meshes);
+        }
+    }
+    assert(batches == 3 && renderer.GetInstanceCount() == 3);
+
+    // Sans vue : tout revient au modèle complet
+    LodSelector::ClearView();
+    renderer.Collect(vehicles);
+    for (const auto& v : vehicles) assert(v->getLodLevel() == LodLevel::Full);
+    vehicles.clear();
+    mm.releaseLod(shared);
+    assert(!mm.getLod(shared));
+    FreeMesh(meshes[0]);
+    std::cout << "Vehicle LOD tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running LOD tests..." << std::endl;
+    test_simplifier();
+    test_selection_hysteresis();
+    test_vehicle_levels();
+    std::cout << "All LOD tests passed!" << std::endl;
+    return 0;
+}
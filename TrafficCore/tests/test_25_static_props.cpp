@@ -0,0 +1,123 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "raymath.h"
+#include "RoadNetwork.h"
+#include "StaticProps.h"
+#include "Vehicules/ModelManager.h"
+
+static bool SameColor(Color a, Color b) {
+    return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+static bool Inside(Vector3 p, const BoundingBox& box) {
+    return p.x >= box.min.x && p.x <= box.max.x && p.y >= box.min.y && p.y <= box.max.y &&
+           p.z >= box.min.z && p.z <= box.max.z;
+}
+
+void test_light_props() {
+    RoadNetwork network;
+    Node* light = network.AddNode({0, 0, 0}, TRAFFIC_LIGHT);
+    Node* plain = network.AddNode({200, 0, 0});
+    network.AddRoadSegment(light, plain, 2);
+
+    TrafficLightProp props[4];
+    assert(plain->GetLightProps(props) == 0);
+    assert(light->GetLightProps(props) == 4);
+    const BoundingBox bounds = light->GetLightBounds();
+    for (const TrafficLightProp& p : props) {
+        assert(Inside(p.pole, bounds) && Inside(p.box, bounds));
+        assert(p.box.y > p.pole.y && p.box.y < p.pole.y + Node::kPoleHeight);
+        // Lampes sur la face tournée vers l'extérieur du boîtier
+        const float along = p.faceX ? p.lampOffset.x : p.lampOffset.z;
+        assert(std::fabs(along) > 0.5f && (p.faceX ? p.lampOffset.z : p.lampOffset.x) == 0.0f);
+    }
+
+    // Seules les couleurs changent avec l'état du feu
+    Color before[3], after[3];
+    light->GetLampColors(before);
+    light->SetEmergencyOverride(true, 5.0f);
+    light->GetLampColors(after);
+    assert(SameColor(after[0], RED) || SameColor(after[2], GREEN));
+    assert(!SameColor(before[0], after[0]) || !SameColor(before[2], after[2]));
+    std::cout << "Traffic light prop tests passed!" << std::endl;
+}
+
+void test_baked_lights() {
+    RoadNetwork network;
+    std::vector<Node*> row;
+    for (int i = 0; i < 12; ++i) {
+        row.push_back(network.AddNode({i * 600.0f, 0, 0}, i % 3 == 0 ? TRAFFIC_LIGHT : SIMPLE_INTERSECTION));
+        if (i > 0) network.AddRoadSegment(row[i - 1], row[i], 2, false);
+    }
+    for (Node* node : row) network.AddIntersection(node);
+
+    RoadMesh mesh;
+    mesh.Sync(network);
+    assert(mesh.GetLightCount() == 4);
+    assert(!mesh.DrawLights()); // pas de contexte OpenGL : rendu un par un
+
+    // Le feu retiré disparaît des instances de sa tuile, les autres restent
+    assert(network.SetNodeShape(row[3], SIMPLE_INTERSECTION, row[3]->GetRadius()));
+    assert(mesh.Sync(network) >= 1 && mesh.GetLightCount() == 3);
+    assert(network.SetNodeShape(row[4], TRAFFIC_LIGHT, row[4]->GetRadius()));
+    mesh.Sync(network);
+    assert(mesh.GetLightCount() == 4);
+    std::cout << "Baked traffic light tests passed!" << std::endl;
+}
+
+void test_static_props() {
+    Mesh meshes[1] = {GenMeshCube(2.0f, 4.0f, 2.0f)};
+    int meshMaterial[1] = {0};
+    Model tree = {};
+    tree.transform = MatrixIdentity();
+    tree.meshCount = 1;
+    tree.meshes = meshes;
+    tree.meshMaterial = meshMaterial;
+    Model bench = tree;
+    const ModelLod* lod = ModelManager::getInstance().buildLod(tree);
+    assert(lod);
+
+    // Caméra à l'origine, regard vers +Z
+    Camera3D camera = {};
+    camera.position = {0, 10, 0};
+    camera.target = {0, 10, 1};
+    camera.up = {0, 1, 0};
+    camera.fovy = 60.0f;
+    camera.projection = CAMERA_PERSPECTIVE;
+    const Frustum view = Frustum::FromCamera(camera, 16.0f / 9.0f);
+
+    StaticProps props;
+    for (int i = 0; i < 10; ++i) props.Add(tree, lod, {i * 10.0f + 5.0f, 0, 100}, i * 36.0f, 3.0f, 450.0f); // une case
+    for (int i = 0; i < 5; ++i) props.Add(bench, nullptr, {i * 4.0f, 0, 110}, 0.0f, 1.0f);                   // même case, autre modèle
+    for (int i = 0; i < 6; ++i) props.Add(tree, lod, {i * 10.0f, 0, -300}, 0.0f, 3.0f, 450.0f);              // derrière
+    for (int i = 0; i < 4; ++i) props.Add(tree, lod, {i * 10.0f, 0, 900}, 0.0f, 3.0f, 450.0f);               // trop loin
+    assert(props.GetCount() == 25 && props.GetBatchCount() == 4);
+    assert(props.GetBatchSize(0) == 10 && props.GetBatchSize(1) == 5);
+
+    std::vector<int> visible;
+    props.QueryBatches(view, visible);
+    assert(visible.size() == 2 && visible[0] == 0 && visible[1] == 1);
+    const CullStats& stats = props.GetStats();
+    assert(stats.drawn == 15 && stats.frustumCulled == 6 && stats.distanceCulled == 4);
+
+    // Sans instanciation : objet par objet, mêmes objets écartés
+    props.Draw(view);
+    assert(props.GetStats().drawn == 15 && props.GetStats().GetCulled() == 10);
+    assert(props.GetDrawCallCount() == 15);
+    props.Clear();
+    assert(props.GetCount() == 0 && props.GetBatchCount() == 0);
+
+    ModelManager::getInstance().releaseLod(tree);
+    UnloadMesh(meshes[0]);
+    std::cout << "Static prop batching tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running static prop tests..." << std::endl;
+    test_light_props();
+    test_baked_lights();
+    test_static_props();
+    std::cout << "All static prop tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <cassert>
+#include <memory>
+#include <vector>
+#include "raymath.h"
+#include "Vehicules/Bus.h"
+#include "Vehicules/Car.h"
+#include "Vehicules/ModelManager.h"
+#include "Vehicules/Truck.h"
+
+void test_path_cache() {
+    ModelManager& mm = ModelManager::getInstance();
+    const int before = mm.getCachedCount();
+    assert(before == 0);
+    {
+        // Un fichier par chemin, quel que soit le nombre de véhicules (échec de chargement compris)
+        std::vector<std::unique_ptr<Vehicule>> fleet;
+        for (int i = 0; i < 20; ++i) fleet.push_back(std::make_unique<Bus>(Vector3{i * 10.0f, 0, 0}));
+        for (int i = 0; i < 5; ++i) fleet.push_back(std::make_unique<Truck>(Vector3{i * 10.0f, 0, 20}));
+        assert(mm.getCachedCount() == before + 2);
+        const ModelHandle& bus = fleet[0]->getModelHandle();
+        assert(bus.getPath() == "assets/models/bus bleu.glb");
+        assert(bus.useCount() == 20 && fleet[20]->getModelHandle().useCount() == 5);
+
+        ModelHandle copy = bus;
+        assert(bus.useCount() == 21);
+        ModelHandle moved = std::move(copy);
+        assert(bus.useCount() == 21 && copy.useCount() == 0);
+        fleet.resize(10);
+        assert(moved.useCount() == 11);
+    }
+    // Plus de véhicules : les modèles restent en cache jusqu'à releaseUnused()
+    assert(mm.getCachedCount() == before + 2);
+    ModelHandle again = mm.acquire("assets/models/bus bleu.glb");
+    assert(again.useCount() == 1 && mm.getCachedCount() == before + 2);
+    assert(mm.releaseUnused() == 1 && mm.getCachedCount() == 1); // camion seul
+    again = ModelHandle();
+    assert(mm.releaseUnused() == 1 && mm.getCachedCount() == 0);
+    std::cout << "Model path cache tests passed!" << std::endl;
+}
+
+void test_shared_models() {
+    Mesh meshes[1] = {GenMeshCube(2.0f, 1.0f, 4.0f)};
+    int meshMaterial[1] = {0};
+    Model shared = {};
+    shared.transform = MatrixIdentity();
+    shared.meshCount = 1;
+    shared.meshes = meshes;
+    shared.meshMaterial = meshMaterial;
+
+    ModelManager& mm = ModelManager::getInstance();
+    std::vector<std::unique_ptr<Vehicule>> cars;
+    for (int i = 0; i < 8; ++i) cars.push_back(std::make_unique<Car>(Vector3{i * 5.0f, 0, 0}, shared, i));
+    const ModelHandle& handle = cars[0]->getModelHandle();
+    assert(handle.isLoaded() && handle.getPath().empty() && handle.useCount() == 8);
+    assert(cars[7]->getModel().meshes == meshes);
+    assert(mm.share(shared).useCount() == 9);
+    assert(handle.useCount() == 8); // temporaire rendu aussitôt
+
+    // Model vide : pas d'entrée, boîte de repli
+    auto cube = std::make_unique<Bus>(Vector3{0, 0, 0}, Model{});
+    assert(!cube->hasLoadedModel() && cube->getModelHandle().useCount() == 0);
+
+    // unloadAll() : les handles vivants restent valides
+    ModelHandle kept = mm.acquire("assets/models/truck.glb");
+    mm.unloadAll();
+    assert(mm.getCachedCount() == 0 && kept.useCount() == 1 && !kept.isLoaded());
+    kept = ModelHandle();
+
+    cars.clear();
+    ModelHandle fresh = mm.share(shared);
+    assert(fresh.useCount() == 1);
+    fresh = ModelHandle();
+    UnloadMesh(meshes[0]);
+    std::cout << "Shared model tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running model cache tests..." << std::endl;
+    test_path_cache();
+    test_shared_models();
+    std::cout << "All model cache tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,120 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include "core/AssetManager.h"
+#include "TestFiles.h"
+#include "Vehicules/Bus.h"
+#include "Vehicules/ModelManager.h"
+
+namespace fs = std::filesystem;
+
+static fs::path MakeAssetDir() {
+    fs::path dir = fs::temp_directory_path() / "smartcity_asset_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    WriteFile(dir / "bus bleu.glb", "glTF-bus");
+    WriteFile(dir / "truck.glb", "glTF-truck");
+    WriteFile(dir / "Taxi (1).glb", "glTF-taxi");
+    WriteFile(dir / "abribus_bus_stop.glb", "glTF-stop");
+    WriteFile(dir / "Tree.glb", "glTF-tree");
+    WriteFile(dir / "notes.txt", "ignored");
+    return dir;
+}
+
+void test_manifest() {
+    assert(AssetManifest::Classify("bus bleu.glb") == "BUS");
+    assert(AssetManifest::Classify("abribus_bus_stop_bus_station.glb") == "SCENERY");
+    assert(AssetManifest::Classify("truck.glb") == "TRUCK");
+    assert(AssetManifest::Classify("Convertible.glb") == "CAR");
+    assert(AssetManifest::Classify("Plant Big.glb") == "SCENERY");
+
+    const fs::path dir = MakeAssetDir();
+    AssetManifest manifest;
+    assert(!manifest.Open((dir / "missing").string()));
+    assert(manifest.Open(dir.string()));
+    assert(manifest.GetCount() == 5 && manifest.GetRescanned() == 5 && manifest.IsDirty());
+    assert(manifest.GetPaths("BUS").size() == 1 && manifest.GetPaths("SCENERY").size() == 2);
+
+    // Chemin relatif ou absolu vers le même fichier ; autre dossier : inconnu
+    const std::string bus = manifest.GetPaths("BUS")[0];
+    assert(manifest.Find(bus) && manifest.Find((dir / "." / "bus bleu.glb").string()) == manifest.Find(bus));
+    assert(!manifest.Find("assets/models/bus bleu.glb") || fs::equivalent(dir, "assets/models"));
+    assert(!manifest.Find(bus)->hasBounds);
+    manifest.SetBounds(bus, {{-1, 0, -2}, {1, 3, 2}});
+    assert(manifest.Save() && !manifest.IsDirty());
+
+    // Relecture : rien à revisiter, boîtes conservées
+    AssetManifest again;
+    assert(again.Open(dir.string()));
+    assert(again.GetRescanned() == 0 && !again.IsDirty() && again.GetCount() == 5);
+    const AssetInfo* info = again.Find(bus);
+    assert(info && info->hasBounds && info->bounds.max.y == 3.0f && info->category == "BUS");
+
+    // Fichier modifié, ajouté, retiré
+    WriteFile(dir / "truck.glb", "glTF-truck-v2");
+    WriteFile(dir / "Large Building 0.glb", "glTF-building");
+    fs::remove(dir / "Tree.glb");
+    assert(again.Open(dir.string()));
+    assert(again.GetRescanned() == 2 && again.IsDirty() && again.GetCount() == 5);
+    assert(again.Find(bus)->hasBounds);
+    fs::remove_all(dir);
+    std::cout << "Asset manifest tests passed!" << std::endl;
+}
+
+void test_streaming() {
+    const fs::path dir = MakeAssetDir();
+    AssetManager assets;
+    assert(assets.OpenManifest(dir.string()));
+    const std::string bus = (dir / "bus bleu.glb").string();
+    const std::string tree = (dir / "Tree.glb").string();
+
+    int delivered = 0;
+    auto onReady = [&](const std::string& path, Model model) {
+        assert(path == bus || path == tree);
+        if (model.meshCount > 0) UnloadModel(model);
+        ++delivered;
+    };
+    assert(assets.Request(bus, onReady));
+    assert(!assets.Request(bus, onReady)); // déjà en attente
+    assert(assets.Request(tree, onReady));
+    assert(assets.IsPending(bus) && assets.GetPendingCount() == 2);
+    while (assets.GetPendingCount() > 0) assets.Update(0.0f); // au moins un modèle par appel
+    assert(delivered == 2 && !assets.IsPending(bus));
+
+    // ModelManager : décor en tâche de fond, véhicule en tâche de fond si sa boîte est connue
+    ModelManager& mm = ModelManager::getInstance();
+    mm.setAssetManager(&assets);
+    {
+        ModelHandle scenery = mm.acquireAsync(tree);
+        assert(scenery.isPending() && !scenery.isLoaded() && !scenery.hasBounds());
+        assert(mm.acquireAsync(tree).useCount() == 2 && assets.GetPendingCount() == 1);
+
+        ModelHandle unknown = mm.acquire((dir / "truck.glb").string()); // boîte inconnue : synchrone
+        assert(!unknown.isPending());
+
+        assets.GetManifest().SetBounds(bus, {{-1, 0, -4}, {1, 3, 4}});
+        Bus vehicle({0, 0, 0}, bus);
+        const ModelHandle& handle = vehicle.getModelHandle();
+        assert(handle.isPending() && handle.hasBounds() && !vehicle.hasLoadedModel());
+        vehicle.normalizeSize(16.0f);
+        assert(std::fabs(vehicle.getScale() - 2.0f) < 1e-4f); // taille du manifeste, avant chargement
+
+        assert(assets.Finish() == 2);
+        assert(!scenery.isPending() && !handle.isPending());
+    }
+    mm.setAssetManager(nullptr);
+    assert(mm.releaseUnused() == 3 && mm.getCachedCount() == 0);
+    fs::remove_all(dir);
+    std::cout << "Asset streaming tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running asset streaming tests..." << std::endl;
+    test_manifest();
+    test_streaming();
+    std::cout << "All asset streaming tests passed!" << std::endl;
+    return 0;
+}
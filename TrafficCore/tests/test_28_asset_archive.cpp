@@ -0,0 +1,158 @@
+#include <iostream>
+#include <cassert>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "raymath.h"
+#include "core/AssetManager.h"
+#include "core/ModelArchive.h"
+#include "TestFiles.h"
+#include "Vehicules/ModelManager.h"
+
+namespace fs = std::filesystem;
+
+// Deux maillages : cube indexé, triangle coloré sans indices ; deux matériaux
+static Model MakeModel() {
+    Model model = {};
+    model.transform = MatrixIdentity();
+    model.meshCount = 2;
+    model.meshes = (Mesh*)MemAlloc(2 * sizeof(Mesh));
+    model.meshes[0] = GenMeshCube(2.0f, 1.0f, 4.0f);
+    Mesh& tri = model.meshes[1];
+    tri.vertexCount = 3;
+    tri.triangleCount = 1;
+    tri.vertices = (float*)MemAlloc(9 * sizeof(float));
+    tri.colors = (unsigned char*)MemAlloc(12);
+    for (int i = 0; i < 9; ++i) tri.vertices[i] = (float)i;
+    for (int i = 0; i < 12; ++i) tri.colors[i] = (unsigned char)(i * 20);
+    model.materialCount = 2;
+    model.materials = (Material*)MemAlloc(2 * sizeof(Material));
+    model.materials[0] = LoadMaterialDefault();
+    model.materials[1] = LoadMaterialDefault();
+    model.materials[1].maps[MATERIAL_MAP_ALBEDO].color = {10, 20, 30, 255};
+    model.meshMaterial = (int*)MemAlloc(2 * sizeof(int));
+    model.meshMaterial[1] = 1;
+    return model;
+}
+
+static bool SameArray(const void* a, const void* b, size_t bytes) {
+    return (!a && !b) || (a && b && std::memcmp(a, b, bytes) == 0);
+}
+
+static void AssertSameMesh(const Mesh& a, const Mesh& b) {
+    assert(a.vertexCount == b.vertexCount && a.triangleCount == b.triangleCount);
+    const size_t n = a.vertexCount;
+    assert(SameArray(a.vertices, b.vertices, n * 3 * sizeof(float)));
+    assert(SameArray(a.normals, b.normals, n * 3 * sizeof(float)));
+    assert(SameArray(a.texcoords, b.texcoords, n * 2 * sizeof(float)));
+    assert(SameArray(a.colors, b.colors, n * 4));
+    assert(SameArray(a.indices, b.indices, a.triangleCount * 3 * sizeof(unsigned short)));
+}
+
+void test_round_trip() {
+    Model source = MakeModel();
+    const fs::path file = fs::temp_directory_path() / "smartcity_archive_test.scpak";
+    std::string error;
+    assert(ModelArchive::Write({{"Taxi (1).glb", &source, 1234, 42}, {"empty.glb", nullptr, 0, 0}},
+                               file.string(), &error));
+
+    ModelArchive archive;
+    assert(archive.Open(file.string()));
+    assert(archive.GetCount() == 1 && archive.Find("Taxi (1).glb") == 0 && archive.Find("empty.glb") == -1);
+    assert(archive.GetName(0) == "Taxi (1).glb");
+    assert(archive.IsCurrent(0, 1234, 42) && !archive.IsCurrent(0, 1235, 42) && !archive.IsCurrent(1, 1234, 42));
+
+    // Tableaux recopiés à l'identique, matériaux et affectations conservés
+    Model loaded = archive.Load(0);
+    assert(loaded.meshCount == 2 && loaded.materialCount == 2);
+    AssertSameMesh(source.meshes[0], loaded.meshes[0]);
+    AssertSameMesh(source.meshes[1], loaded.meshes[1]);
+    assert(!loaded.meshes[1].indices && loaded.meshes[1].colors);
+    assert(loaded.meshMaterial[0] == 0 && loaded.meshMaterial[1] == 1);
+    const Color c = loaded.materials[1].maps[MATERIAL_MAP_ALBEDO].color;
+    assert(c.r == 10 && c.g == 20 && c.b == 30 && c.a == 255);
+    assert(archive.Load(1).meshCount == 0 && archive.Load(-1).meshCount == 0);
+
+    // Tableaux alignés sur 16 octets dans le fichier
+    const std::string bytes = ReadFile(file);
+    assert(bytes.size() % 16 == 0 && bytes.compare(0, 5, "SCPAK") == 0);
+    archive.Close();
+    assert(!archive.IsOpen() && archive.Find("Taxi (1).glb") == -1);
+    std::cout << "Archive round trip tests passed!" << std::endl;
+}
+
+void test_invalid_archives() {
+    const fs::path file = fs::temp_directory_path() / "smartcity_archive_test.scpak";
+    const std::string bytes = ReadFile(file);
+    const fs::path bad = fs::temp_directory_path() / "smartcity_archive_bad.scpak";
+    ModelArchive archive;
+
+    assert(!archive.Open((fs::temp_directory_path() / "smartcity_missing.scpak").string()));
+    WriteFile(bad, "glTF binaire");
+    assert(!archive.Open(bad.string()) && archive.GetError().find("signature") != std::string::npos);
+    WriteFile(bad, bytes.substr(0, bytes.size() / 2));
+    assert(!archive.Open(bad.string()) && archive.GetError().find("tronque") != std::string::npos);
+    std::string version = bytes;
+    version[8] = 9;
+    WriteFile(bad, version);
+    assert(!archive.Open(bad.string()) && archive.GetError().find("version") != std::string::npos);
+    assert(!archive.IsOpen() && archive.GetCount() == 0);
+    fs::remove(bad);
+    fs::remove(file);
+    std::cout << "Invalid archive tests passed!" << std::endl;
+}
+
+void test_packed_loading() {
+    const fs::path dir = fs::temp_directory_path() / "smartcity_archive_assets";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+    WriteFile(dir / "Taxi (1).glb", "glTF-taxi");
+    WriteFile(dir / "truck.glb", "glTF-truck");
+
+    AssetManager assets;
+    assert(assets.OpenManifest(dir.string()));
+    assert(!assets.OpenArchive((dir / ModelArchive::kFileName).string()));
+    const AssetInfo* taxi = assets.GetManifest().Find((dir / "Taxi (1).glb").string());
+    assert(taxi);
+    Model source = MakeModel();
+    assert(ModelArchive::Write({{taxi->name, &source, taxi->size, taxi->writeTime}},
+                               (dir / ModelArchive::kFileName).string()));
+    assert(assets.OpenArchive((dir / ModelArchive::kFileName).string()));
+
+    // Modèle de l'archive : chargé sans passer par LoadModel ni par le thread d'E/S
+    ModelManager& mm = ModelManager::getInstance();
+    mm.setAssetManager(&assets);
+    {
+        ModelHandle handle = mm.acquireAsync((dir / "Taxi (1).glb").string());
+        assert(handle.isLoaded() && !handle.isPending() && handle.hasBounds());
+        assert(handle.get().meshCount == 2 && assets.GetPendingCount() == 0);
+        assert(mm.getLod(handle.get()));
+        // Absent de l'archive : chargement en tâche de fond comme avant
+        ModelHandle truck = mm.acquireAsync((dir / "truck.glb").string());
+        assert(truck.isPending() && assets.GetPendingCount() == 1);
+        assets.Finish();
+    }
+    mm.setAssetManager(nullptr);
+    mm.releaseUnused();
+
+    // .glb modifié depuis l'empaquetage : l'archive ne le sert plus
+    WriteFile(dir / "Taxi (1).glb", "glTF-taxi-v2");
+    AssetManager changed;
+    assert(changed.OpenManifest(dir.string()) && changed.OpenArchive((dir / ModelArchive::kFileName).string()));
+    Model model = {};
+    assert(!changed.LoadPacked((dir / "Taxi (1).glb").string(), model) && model.meshCount == 0);
+    assert(!changed.LoadPacked((dir / "truck.glb").string(), model));
+    fs::remove_all(dir);
+    std::cout << "Packed loading tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running asset archive tests..." << std::endl;
+    test_round_trip();
+    test_invalid_archives();
+    test_packed_loading();
+    std::cout << "All asset archive tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,124 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <memory>
+#include <vector>
+#include "raymath.h"
+#include "Vehicules/EmergencyModels.h"
+#include "Vehicules/Emergencyvehicle.h"
+#include "Vehicules/ModelManager.h"
+#include "Vehicules/VehicleRenderer.h"
+
+static bool Same(Color a, Color b) { return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a; }
+static bool Near(float a, float b) { return std::fabs(a - b) < 1e-3f; }
+
+void test_baked_models() {
+    // Un maillage à couleurs par sommet par type, lampes repérées à part
+    const EmergencyType types[3] = {EmergencyType::AMBULANCE, EmergencyType::FIRE_TRUCK, EmergencyType::POLICE};
+    const size_t lampCounts[3] = {2, 4, 2};
+    for (int i = 0; i < 3; ++i) {
+        const EmergencyModel& baked = EmergencyModels::Get(types[i]);
+        assert(baked.body.meshCount == 1 && baked.body.materialCount == 1);
+        const Mesh& mesh = baked.body.meshes[0];
+        assert(mesh.vertexCount > 0 && mesh.vertexCount == mesh.triangleCount * 3);
+        assert(mesh.vertices && mesh.colors && !mesh.indices);
+        assert(baked.lamps.size() == lampCounts[i]);
+        // Cuit une seule fois : même modèle au second appel
+        assert(EmergencyModels::Get(types[i]).body.meshes == baked.body.meshes);
+    }
+    // Lampes au-dessus de la carrosserie
+    const EmergencyModel& police = EmergencyModels::Get(EmergencyType::POLICE);
+    BoundingBox box = GetMeshBoundingBox(police.body.meshes[0]);
+    for (const Vector3& lamp : police.lamps) assert(lamp.y > box.max.y - 0.2f);
+    const Model& lamp = EmergencyModels::GetLampModel();
+    assert(lamp.meshCount == 1 && lamp.meshes[0].vertexCount == 36);
+    assert(&EmergencyModels::GetLampModel() == &lamp);
+    std::cout << "Baked model tests passed!" << std::endl;
+}
+
+void test_siren_lamps() {
+    EmergencyVehicle ambulance({0, 0, 0}, EmergencyType::AMBULANCE, Model{}, nullptr);
+    const EmergencyModel& baked = EmergencyModels::Get(EmergencyType::AMBULANCE);
+    assert(ambulance.isInstanceable());
+    assert(ambulance.getModel().meshes == baked.body.meshes);
+    assert(ambulance.getLampModel() == &EmergencyModels::GetLampModel());
+    assert(ambulance.getLamps().size() == 2);
+    const Vector3 offset = ambulance.getLamps()[0].offset;
+    assert(Near(offset.x, baked.lamps[0].x) && Near(offset.y, baked.lamps[0].y) && Near(offset.z, baked.lamps[0].z));
+
+    // Sirène active : rouge et bleu alternent
+    assert(Same(ambulance.getLamps()[0].color, RED) && !Same(ambulance.getLamps()[1].color, BLUE));
+    ambulance.update(0.1f);
+    assert(!Same(ambulance.getLamps()[0].color, RED) && Same(ambulance.getLamps()[1].color, BLUE));
+    // Sirène coupée : couleurs éteintes fixes
+    ambulance.completeMission();
+    ambulance.update(0.1f);
+    assert(Same(ambulance.getLamps()[0].color, MAROON) && Same(ambulance.getLamps()[1].color, DARKBLUE));
+
+    // Modèle externe : pas de lampes instanciées, dessiné seul
+    Mesh mesh = {};
+    Material material = {};
+    int meshMaterial = 0;
+    Model external = {};
+    external.transform = MatrixIdentity();
+    external.meshCount = 1;
+    external.meshes = &mesh;
+    external.materialCount = 1;
+    external.materials = &material;
+    external.meshMaterial = &meshMaterial;
+    EmergencyVehicle truck({0, 0, 0}, EmergencyType::FIRE_TRUCK, external, nullptr);
+    assert(!truck.isInstanceable() && !truck.getLampModel() && truck.getLamps().empty());
+    std::cout << "Siren lamp tests passed!" << std::endl;
+}
+
+void test_instanced_fleet() {
+    std::vector<std::unique_ptr<EmergencyVehicle>> fleet;
+    std::vector<Vehicule*> vehicles;
+    for (int i = 0; i < 100; ++i) {
+        const EmergencyType type = (i % 2 == 0) ? EmergencyType::AMBULANCE : EmergencyType::POLICE;
+        fleet.push_back(std::make_unique<EmergencyVehicle>(Vector3{i * 10.0f, 0.0f, 0.0f}, type, Model{}, nullptr));
+        vehicles.push_back(fleet.back().get());
+    }
+
+    // Deux carrosseries et un lot de lampes partagé : 3 appels pour 100 véhicules
+    VehicleRenderer renderer;
+    renderer.Collect(vehicles);
+    assert(renderer.GetIndividual().empty());
+    assert(renderer.GetBatches().size() == 3);
+    assert(renderer.GetInstanceCount() == 100 + 200);
+    assert(renderer.GetDrawCallCount() == 3);
+
+    const VehicleRenderer::Batch* lamps = nullptr;
+    for (const auto& batch : renderer.GetBatches()) {
+        if (batch.model.meshes == EmergencyModels::GetLampModel().meshes) lamps = &batch;
+        else assert(batch.transforms.size() == 50);
+    }
+    assert(lamps && lamps->transforms.size() == 200);
+    // Lampe gauche de la première ambulance : position du véhicule + décalage, teinte de la lampe
+    const Matrix& m = lamps->transforms[0];
+    const Vector3 p = Vector3Transform(fleet[0]->getLamps()[0].offset, VehicleRenderer::InstanceTransform(*fleet[0]));
+    assert(Near(m.m12, p.x) && Near(m.m13, p.y) && Near(m.m14, p.z));
+    assert(Near(m.m3, RED.r / 255.0f) && Near(m.m7, RED.g / 255.0f) && Near(m.m11, RED.b / 255.0f));
+    std::cout << "Instanced fleet tests passed!" << std::endl;
+}
+
+void test_release() {
+    const Mesh* meshes = EmergencyModels::Get(EmergencyType::POLICE).body.meshes;
+    EmergencyModels::Release();
+    // Modèles toujours valides pour les véhicules encore en vie, au même emplacement
+    const EmergencyModel& police = EmergencyModels::Get(EmergencyType::POLICE);
+    assert(police.body.meshes == meshes && police.body.meshes[0].vertexCount > 0);
+    assert(police.body.meshes[0].vertices && police.body.meshes[0].colors);
+    assert(ModelManager::getInstance().getLod(police.body));
+    std::cout << "Release tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running emergency model tests..." << std::endl;
+    test_baked_models();
+    test_siren_lamps();
+    test_instanced_fleet();
+    test_release();
+    std::cout << "All emergency model tests passed!" << std::endl;
+    return 0;
+}
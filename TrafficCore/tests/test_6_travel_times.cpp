@@ -0,0 +1,91 @@
+#include <iostream>
+#include <cassert>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+
+void test_smoothing() {
+    TravelTimeTable table;
+    table.AddSegment(2.0f, 150.0f);
+
+    assert(table.GetEstimate(0) == 2.0f);
+    table.Record(0, 4.0f);
+    // 2 + 0.2 * (4 - 2)
+    assert(table.GetEstimate(0) > 2.39f && table.GetEstimate(0) < 2.41f);
+
+    // Observation aberrante bornée à 50x le temps fluide
+    table.Record(0, 1e6f);
+    assert(table.GetEstimate(0) < 2.4f + 0.2f * 100.0f + 0.01f);
+
+    // Index invalide ignoré
+    table.Record(5, 3.0f);
+    table.Record(-1, 3.0f);
+    assert(table.GetSegmentCount() == 1);
+
+    std::cout << "Smoothing tests passed!" << std::endl;
+}
+
+void test_versions() {
+    RoadNetwork network;
+    Node* n1 = network.AddNode({0, 0, 0});
+    Node* n2 = network.AddNode({100, 0, 0});
+    RoadSegment* seg = network.AddRoadSegment(n1, n2, 2);
+    assert(seg->GetIndex() == 0);
+
+    auto before = network.GetEdgeWeights();
+    assert(before->seconds.size() == 1);
+
+    // Rien de nouveau : même table
+    network.PublishTravelTimes();
+    assert(network.GetEdgeWeights()->version == before->version);
+
+    network.RecordTraversal(seg, before->seconds[0] * 3.0f);
+    network.PublishTravelTimes();
+    auto after = network.GetEdgeWeights();
+    assert(after->version > before->version);
+    assert(after->seconds[0] > before->seconds[0]);
+
+    // L'ancien instantané reste intact pour un lecteur qui le détient encore
+    assert(before->seconds[0] == network.GetTravelTimes().GetFreeFlow(0));
+
+    std::cout << "Version tests passed!" << std::endl;
+}
+
+void test_congestion_reroute() {
+    RoadNetwork network;
+    Node* a = network.AddNode({0, 0, 0});
+    Node* b = network.AddNode({100, 0, 0});
+    Node* c = network.AddNode({100, 0, 60});
+    Node* d = network.AddNode({200, 0, 0});
+
+    RoadSegment* ab = network.AddRoadSegment(a, b, 2, false);
+    network.AddRoadSegment(b, d, 2, false);
+    network.AddRoadSegment(a, c, 2, false);
+    network.AddRoadSegment(c, d, 2, false);
+
+    PathFinder pf(&network);
+    auto path = pf.FindPath(a, d);
+    assert(path.size() == 3 && path[1] == b);
+
+    // Bouchon sur A-B
+    float ff = network.GetTravelTimes().GetFreeFlow(ab->GetIndex());
+    for (int i = 0; i < 20; ++i) network.RecordTraversal(ab, ff * 10.0f);
+
+    // Pas encore publié : le routage ne voit rien
+    path = pf.FindPath(a, d);
+    assert(path[1] == b);
+
+    network.PublishTravelTimes();
+    path = pf.FindPath(a, d);
+    assert(path.size() == 3 && path[1] == c);
+
+    std::cout << "Congestion reroute tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running TravelTimeTable tests..." << std::endl;
+    test_smoothing();
+    test_versions();
+    test_congestion_reroute();
+    std::cout << "All TravelTimeTable tests passed!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <cassert>
+#include <vector>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+#include "PathService.h"
+#include "TestNetworks.h"
+
+void test_routing_graph() {
+    RoadNetwork network;
+    Node* n1 = network.AddNode({0, 0, 0});
+    Node* n2 = network.AddNode({100, 0, 0});
+    network.AddRoadSegment(n1, n2, 2, false);
+
+    auto graph = network.GetRoutingGraph();
+    assert(graph->GetNodeCount() == 2);
+    assert(graph->GetEdgeCount() == 1);
+    assert(network.GetRoutingGraph() == graph); // cache réutilisé
+
+    // Sens unique : pas de chemin retour
+    PathFinder pf(&network);
+    assert(pf.FindRoute(n1, n2).size() == 1);
+    assert(pf.FindRoute(n2, n1).empty());
+
+    network.AddRoadSegment(n2, n1, 2, false);
+    assert(network.GetRoutingGraph() != graph); // topologie modifiée -> nouvel instantané
+    assert(graph->GetEdgeCount() == 1);         // l'ancien reste intact
+    assert(pf.FindRoute(n2, n1).size() == 1);
+
+    std::cout << "RoutingGraph tests passed!" << std::endl;
+}
+
+void test_async_matches_sync() {
+    // Grille 6x6 bidirectionnelle
+    RoadNetwork network;
+    std::vector<Node*> grid;
+    BuildGrid(network, grid, 6);
+
+    PathService service(3);
+    PathFinder pf(&network);
+
+    std::vector<RouteTicket> tickets;
+    std::vector<std::pair<Node*, Node*>> queries;
+    for (int i = 0; i < 40; ++i) {
+        Node* s = grid[(i * 7) % grid.size()];
+        Node* e = grid[(i * 13 + 5) % grid.size()];
+        queries.emplace_back(s, e);
+        tickets.push_back(service.RequestRoute(network, s, e));
+    }
+
+    for (size_t i = 0; i < tickets.size(); ++i) {
+        const RouteResult& r = tickets[i].get();
+        assert(r.topologyVersion == network.GetTopologyVersion());
+        auto expected = pf.FindRoute(queries[i].first, queries[i].second);
+        assert(r.route == expected);
+        if (queries[i].first != queries[i].second) {
+            assert(!r.route.empty());
+            assert(r.route.front()->GetStartNode() == queries[i].first);
+            assert(r.route.back()->GetEndNode() == queries[i].second);
+        }
+    }
+
+    // Requête invalide : ticket prêt tout de suite
+    RouteTicket same = service.RequestRoute(network, grid[0], grid[0]);
+    assert(PathService::IsReady(same));
+    assert(same.get().route.empty());
+
+    std::cout << "Async PathService tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running PathService tests..." << std::endl;
+    test_routing_graph();
+    test_async_matches_sync();
+    std::cout << "All PathService tests passed!" << std::endl;
+    return 0;
+}
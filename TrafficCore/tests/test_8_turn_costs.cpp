@@ -0,0 +1,106 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+
+// Croix à 4 branches autour d'un noeud central, routes dans les deux sens
+struct Cross {
+    RoadNetwork network;
+    Node* center;
+    Node* arms[4]; // +x, +z, -x, -z
+    RoadSegment* in[4];
+    RoadSegment* out[4];
+
+    Cross(NodeType type, float radius) {
+        center = network.AddNode({0, 0, 0}, type, radius);
+        const Vector3 dirs[4] = {{200, 0, 0}, {0, 0, 200}, {-200, 0, 0}, {0, 0, -200}};
+        for (int i = 0; i < 4; ++i) {
+            arms[i] = network.AddNode(dirs[i]);
+            in[i] = network.AddRoadSegment(arms[i], center, 2, false);
+            out[i] = network.AddRoadSegment(center, arms[i], 2, false);
+        }
+    }
+
+    float Movement(int from, int to) {
+        auto graph = network.GetRoutingGraph();
+        int c = graph->IndexOf(center);
+        int inArc = -1, outArc = -1;
+        for (int u = 0; u < graph->GetNodeCount(); ++u)
+            for (int e = graph->EdgeBegin(u); e < graph->EdgeEnd(u); ++e) {
+                if (graph->EdgeSegment(e) == in[from]->GetIndex()) inArc = e;
+                if (graph->EdgeSegment(e) == out[to]->GetIndex()) outArc = e;
+            }
+        assert(inArc >= 0 && outArc >= 0 && graph->EdgeTarget(inArc) == c);
+        uint16_t m = graph->GetMovement(inArc, outArc);
+        return RoutingGraph::IsForbidden(m) ? -1.0f : RoutingGraph::MovementSeconds(m);
+    }
+};
+
+void test_movement_table() {
+    Cross x(SIMPLE_INTERSECTION, 10.0f);
+    auto graph = x.network.GetRoutingGraph();
+    // Centre : 4 entrants x 4 sortants ; chaque bras : 1 x 1
+    assert(graph->GetMovementCount() == 16 + 4);
+
+    // Demi-tour interdit par défaut, autorisé sur option
+    assert(x.Movement(0, 0) < 0.0f);
+    x.network.SetUTurnsAllowed(true);
+    assert(x.Movement(0, 0) > 0.0f);
+
+    // Tout droit moins cher que les deux virages, le virage traversant est le plus cher.
+    // Depuis +x vers le centre : +z est le côté proche, -z coupe le flux opposé.
+    // Transition bornée à 0.5 s (rayon 10), + 0.3 s (proche) ou 1.5 s (traversant) par quart de tour
+    float straight = x.Movement(0, 2);
+    float nearTurn = x.Movement(0, 1);
+    float crossingTurn = x.Movement(0, 3);
+    assert(straight < nearTurn && nearTurn < crossingTurn);
+    const float quantum = RoutingGraph::kMovementQuantum;
+    assert(std::fabs(straight - 0.5f) <= quantum);
+    assert(std::fabs(nearTurn - 0.8f) <= quantum);
+    assert(std::fabs(crossingTurn - 2.0f) <= quantum);
+
+    // Miroir : depuis -x, le côté proche devient -z
+    assert(std::fabs(x.Movement(2, 3) - nearTurn) <= quantum);
+    assert(std::fabs(x.Movement(2, 1) - crossingTurn) <= quantum);
+
+    std::cout << "Movement table tests passed!" << std::endl;
+}
+
+void test_roundabout_sweep() {
+    Cross x(ROUNDABOUT, 40.0f);
+    // Demi-tour autorisé en rond-point, et c'est la sortie la plus longue
+    float uTurn = x.Movement(0, 0);
+    assert(uTurn > 0.0f);
+    for (int exitArm = 1; exitArm < 4; ++exitArm) {
+        assert(x.Movement(0, exitArm) < uTurn);
+    }
+    std::cout << "Roundabout sweep tests passed!" << std::endl;
+}
+
+void test_restriction_detour() {
+    Cross x(SIMPLE_INTERSECTION, 10.0f);
+    // Raccourci fermé pour la manoeuvre bras0 -> centre -> bras1 ; détour via un anneau extérieur
+    x.network.AddRoadSegment(x.arms[0], x.arms[3], 2, false);
+    x.network.AddRoadSegment(x.arms[3], x.center, 2, false);
+
+    PathFinder pf(&x.network);
+    auto route = pf.FindRoute(x.arms[0], x.arms[1]);
+    assert(route.size() == 2 && route.front() == x.in[0]);
+
+    x.network.AddTurnRestriction(x.arms[0]->GetId(), x.center->GetId(), x.arms[1]->GetId());
+    route = pf.FindRoute(x.arms[0], x.arms[1]);
+    assert(!route.empty() && route.front() != x.in[0]);
+    assert(route.back() == x.out[1]);
+
+    std::cout << "Turn restriction tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running turn cost tests..." << std::endl;
+    test_movement_table();
+    test_roundabout_sweep();
+    test_restriction_detour();
+    std::cout << "All turn cost tests passed!" << std::endl;
+    return 0;
+}
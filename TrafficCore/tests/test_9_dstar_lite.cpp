@@ -0,0 +1,152 @@
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <vector>
+#include "RoadNetwork.h"
+#include "PathFinder.h"
+#include "DStarLite.h"
+#include "TestNetworks.h"
+
+// Grille NxN de BuildGrid, noeuds désignés par colonne et ligne
+struct Grid {
+    RoadNetwork network;
+    std::vector<Node*> nodes;
+    int n;
+
+    explicit Grid(int n) : n(n) { BuildGrid(network, nodes, n); }
+    Node* At(int x, int z) { return nodes[z * n + x]; }
+};
+
+static bool Near(float a, float b) { return std::fabs(a - b) < 1e-3f * std::max(1.0f, b); }
+
+void test_initial_plan_matches_astar() {
+    Grid grid(6);
+    auto graph = grid.network.GetRoutingGraph();
+    auto weights = grid.network.GetEdgeWeights();
+    int from = graph->IndexOf(grid.At(0, 0));
+    int to = graph->IndexOf(grid.At(5, 4));
+
+    DStarLite planner(graph, weights, from, to);
+    assert(planner.ComputeShortestPath());
+    auto route = planner.ExtractRoute();
+    auto expected = PathFinder::Search(*graph, *weights, from, to);
+    assert(!route.empty());
+    assert(Near(RouteSeconds(*graph, *weights, route), RouteSeconds(*graph, *weights, expected)));
+    assert(Near(planner.GetRemainingSeconds(), RouteSeconds(*graph, *weights, route)));
+    assert(graph->GetSegment(route.back())->GetEndNode() == grid.At(5, 4));
+
+    std::cout << "Initial plan tests passed!" << std::endl;
+}
+
+void test_closure_repair() {
+    Grid grid(8);
+    auto graph = grid.network.GetRoutingGraph();
+    int from = graph->IndexOf(grid.At(0, 0));
+    int to = graph->IndexOf(grid.At(7, 7));
+
+    DStarLite planner(graph, grid.network.GetEdgeWeights(), from, to);
+    planner.ComputeShortestPath();
+    int fullSearch = planner.GetExpandedCount();
+    auto route = planner.ExtractRoute();
+
+    // Le véhicule s'engage sur le premier arc, puis une route plus loin sur l'itinéraire ferme
+    planner.MoveStart(graph->ArcOfSegment(route[0]));
+    RoadSegment* closed = graph->GetSegment(route[route.size() / 2]);
+    grid.network.SetSegmentClosed(closed, true);
+    assert(grid.network.IsSegmentClosed(closed));
+
+    auto weights = grid.network.GetEdgeWeights();
+    assert(std::isinf(weights->seconds[closed->GetIndex()]));
+    planner.UpdateWeights(weights);
+    assert(planner.GetWeightsVersion() == weights->version);
+    assert(planner.ComputeShortestPath());
+    int repair = planner.GetExpandedCount() - fullSearch;
+
+    auto detour = planner.ExtractRoute();
+    assert(!detour.empty());
+    for (int s : detour) assert(s != closed->GetIndex());
+
+    // Même coût qu'une recherche complète depuis la fin du premier arc
+    int restart = graph->IndexOf(graph->GetSegment(route[0])->GetEndNode());
+    auto expected = PathFinder::Search(*graph, *weights, restart, to);
+    std::vector<int> withFirst = {route[0]};
+    withFirst.insert(withFirst.end(), detour.begin(), detour.end());
+    std::vector<int> expectedWithFirst = {route[0]};
+    expectedWithFirst.insert(expectedWithFirst.end(), expected.begin(), expected.end());
+    assert(RouteSeconds(*graph, *weights, withFirst) <= RouteSeconds(*graph, *weights, expectedWithFirst) + 1e-3f);
+    assert(repair < fullSearch);
+
+    // Réouverture : l'itinéraire d'origine redevient optimal
+    grid.network.SetSegmentClosed(closed, false);
+    planner.UpdateWeights(grid.network.GetEdgeWeights());
+    planner.ComputeShortestPath();
+    auto reopened = grid.network.GetEdgeWeights();
+    float original = RouteSeconds(*graph, *reopened, route) - reopened->seconds[route[0]];
+    assert(Near(planner.GetRemainingSeconds(), original));
+
+    std::cout << "Closure repair tests passed!" << std::endl;
+}
+
+void test_speedup_repair() {
+    Grid grid(8);
+    auto graph = grid.network.GetRoutingGraph();
+    int from = graph->IndexOf(grid.At(0, 0));
+    int to = graph->IndexOf(grid.At(7, 7));
+
+    auto initial = grid.network.GetEdgeWeights();
+    DStarLite planner(graph, initial, from, to);
+    planner.ComputeShortestPath();
+    int fullSearch = planner.GetExpandedCount();
+    auto route = planner.ExtractRoute();
+
+    // Segment de l'itinéraire plus rapide que prévu : maxSpeed dépasse la valeur initiale, pas la borne
+    RoadSegment* fast = graph->GetSegment(route[route.size() / 2]);
+    const float fastest = grid.network.GetTravelTimes().GetFreeFlow(fast->GetIndex()) * TravelTimeTable::kMinFreeFlowRatio;
+    for (int i = 0; i < 10; ++i) grid.network.RecordTraversal(fast, fastest);
+    grid.network.PublishTravelTimes();
+    auto weights = grid.network.GetEdgeWeights();
+    assert(weights->maxSpeed > initial->maxSpeed);
+    assert(weights->speedBound == initial->speedBound);
+
+    planner.UpdateWeights(weights);
+    assert(planner.ComputeShortestPath());
+    int repair = planner.GetExpandedCount() - fullSearch;
+    auto expected = PathFinder::Search(*graph, *weights, from, to);
+    assert(Near(planner.GetRemainingSeconds(), RouteSeconds(*graph, *weights, expected)));
+    // Arbre conservé : bien moins d'états développés qu'une recherche neuve
+    DStarLite fresh(graph, weights, from, to);
+    fresh.ComputeShortestPath();
+    assert(repair * 4 < fresh.GetExpandedCount());
+
+    std::cout << "Speed-up repair tests passed!" << std::endl;
+}
+
+void test_unreachable() {
+    Grid grid(3);
+    auto graph = grid.network.GetRoutingGraph();
+    int from = graph->IndexOf(grid.At(0, 0));
+    int to = graph->IndexOf(grid.At(2, 2));
+
+    DStarLite planner(graph, grid.network.GetEdgeWeights(), from, to);
+    assert(planner.ComputeShortestPath());
+
+    // Destination isolée : ses deux accès ferment
+    for (const auto& seg : grid.network.GetRoadSegments()) {
+        if (seg->GetEndNode() == grid.At(2, 2)) grid.network.SetSegmentClosed(seg.get(), true);
+    }
+    planner.UpdateWeights(grid.network.GetEdgeWeights());
+    assert(!planner.ComputeShortestPath());
+    assert(planner.ExtractRoute().empty());
+
+    std::cout << "Unreachable goal tests passed!" << std::endl;
+}
+
+int main() {
+    std::cout << "Running D* Lite tests..." << std::endl;
+    test_initial_plan_matches_astar();
+    test_closure_repair();
+    test_speedup_repair();
+    test_unreachable();
+    std::cout << "All D* Lite tests passed!" << std::endl;
+    return 0;
+}
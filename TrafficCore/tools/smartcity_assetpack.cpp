@@ -0,0 +1,87 @@
+// smartcity-assetpack : regroupe les modèles d'un dossier d'assets en une archive (.scpak) projetée en
+// mémoire au démarrage de la simulation, au lieu de lire et d'analyser chaque .glb.
+// Usage : smartcity-assetpack [dossier] [sortie.scpak]
+// Par défaut : assets/models, archive ModelArchive::kFileName dans ce dossier. Le manifeste du dossier
+// est mis à jour au passage (boîtes englobantes). raylib n'envoie les textures qu'avec un contexte
+// OpenGL : une fenêtre cachée est ouverte le temps de l'empaquetage.
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "core/AssetManager.h"
+#include "core/ModelArchive.h"
+
+int main(int argc, char** argv) {
+    if (argc > 3) {
+        std::cerr << "Usage: smartcity-assetpack [dossier] [sortie.scpak]" << std::endl;
+        return 2;
+    }
+    const std::string directory = (argc >= 2) ? argv[1] : "assets/models";
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+
+    AssetManifest manifest;
+    if (!manifest.Open(directory)) {
+        std::cerr << "smartcity-assetpack: " << manifest.GetError() << std::endl;
+        return 1;
+    }
+    const std::string output = (argc == 3) ? argv[2] : manifest.GetDirectory() + "/" + ModelArchive::kFileName;
+
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(64, 64, "smartcity-assetpack");
+
+    std::vector<Model> models;
+    std::vector<ModelArchive::Source> sources;
+    models.reserve(manifest.GetAssets().size());
+    for (const AssetInfo& info : manifest.GetAssets()) {
+        const std::string path = manifest.GetDirectory() + "/" + info.name;
+        Model model = LoadModel(path.c_str());
+        if (model.meshCount <= 0) {
+            std::cerr << "smartcity-assetpack: " << path << " illisible, ignore" << std::endl;
+            continue;
+        }
+        if (model.boneCount > 0) {
+            std::cerr << "smartcity-assetpack: " << info.name << " : squelette non conserve" << std::endl;
+        }
+        manifest.SetBounds(path, GetModelBoundingBox(model));
+        models.push_back(model);
+        sources.push_back({info.name, nullptr, info.size, info.writeTime});
+    }
+    for (size_t i = 0; i < models.size(); ++i) sources[i].model = &models[i];
+    auto t1 = Clock::now();
+
+    std::string error;
+    const bool written = ModelArchive::Write(sources, output, &error);
+    for (Model& model : models) UnloadModel(model);
+    if (!written) {
+        CloseWindow();
+        std::cerr << "smartcity-assetpack: " << error << std::endl;
+        return 1;
+    }
+    auto t2 = Clock::now();
+
+    // Vérification : l'archive écrite se relit et chaque modèle se reconstruit
+    ModelArchive check;
+    bool valid = check.Open(output) && check.GetCount() == static_cast<int>(sources.size());
+    for (int i = 0; valid && i < check.GetCount(); ++i) {
+        Model model = check.Load(i);
+        valid = model.meshCount > 0;
+        UnloadModel(model);
+    }
+    auto t3 = Clock::now();
+    CloseWindow();
+    if (!valid) {
+        std::cerr << "smartcity-assetpack: relecture de " << output << " incoherente " << check.GetError() << std::endl;
+        return 1;
+    }
+    if (!manifest.Save()) std::cerr << "smartcity-assetpack: " << manifest.GetError() << std::endl;
+
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+    std::cout << output << " : " << check.GetCount() << " modeles sur " << manifest.GetCount() << std::endl;
+    std::cout << "  glTF " << ms(t0, t1) << " ms, ecriture " << ms(t1, t2) << " ms, relecture archive "
+              << ms(t2, t3) << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,74 @@
+// smartcity-mapc : compile une carte JSON en carte binaire (.scmap) chargée par projection mémoire.
+// Usage : smartcity-mapc <configuration.json|extrait.osm> [sortie.scmap]
+// Un extrait OpenStreetMap (.osm) est importé par OsmImporter avant compilation.
+// Sans sortie explicite, le fichier est écrit à côté de l'entrée avec l'extension .scmap.
+#include <chrono>
+#include <iostream>
+#include <string>
+#include "MapBinary.h"
+#include "MapLoader.h"
+#include "OsmImporter.h"
+#include "RoadNetwork.h"
+
+static std::string DefaultOutput(const std::string& input) {
+    size_t slash = input.find_last_of("/\\");
+    size_t dot = input.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) return input + ".scmap";
+    return input.substr(0, dot) + ".scmap";
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2 || argc > 3) {
+        std::cerr << "Usage: smartcity-mapc <configuration.json|extrait.osm> [sortie.scmap]" << std::endl;
+        return 2;
+    }
+    const std::string input = argv[1];
+    const std::string output = (argc == 3) ? argv[2] : DefaultOutput(input);
+
+    using Clock = std::chrono::steady_clock;
+    auto t0 = Clock::now();
+
+    RoadNetwork network;
+    std::string error;
+    const bool osm = input.size() > 4 && (input.compare(input.size() - 4, 4, ".osm") == 0
+                                         || input.compare(input.size() - 4, 4, ".pbf") == 0);
+    if (osm) {
+        OsmImportStats stats;
+        if (!OsmImporter::ImportFile(input, network, OsmImportOptions(), &stats, &error)) {
+            std::cerr << "smartcity-mapc: " << error << std::endl;
+            return 1;
+        }
+        std::cout << input << " : " << stats.osmNodes << " noeuds OSM, " << stats.drivableWays << " voies carrossables sur "
+                  << stats.osmWays << ", " << stats.roundabouts << " ronds-points, " << stats.trafficLights
+                  << " feux" << std::endl;
+    } else if (!MapLoader::LoadFromFile(input, network)) {
+        return 1;
+    }
+    auto t1 = Clock::now();
+
+    if (!MapBinary::Write(network, output, &error)) {
+        std::cerr << "smartcity-mapc: " << error << std::endl;
+        return 1;
+    }
+    auto t2 = Clock::now();
+
+    // Vérification : la carte écrite se recharge à l'identique
+    RoadNetwork check;
+    if (!MapLoader::LoadFromFile(output, check)
+        || check.GetNodeCount() != network.GetNodeCount()
+        || check.GetRoadSegmentCount() != network.GetRoadSegmentCount()) {
+        std::cerr << "smartcity-mapc: relecture de " << output << " incoherente" << std::endl;
+        return 1;
+    }
+    auto t3 = Clock::now();
+
+    auto ms = [](Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    };
+    std::cout << output << " : " << network.GetNodeCount() << " noeuds, "
+              << network.GetRoadSegmentCount() << " segments, "
+              << network.GetRoutingGraph()->GetMovementCount() << " manoeuvres" << std::endl;
+    std::cout << (osm ? "  import OSM " : "  JSON ") << ms(t0, t1) << " ms, ecriture " << ms(t1, t2) << " ms, relecture binaire "
+              << ms(t2, t3) << " ms" << std::endl;
+    return 0;
+}